@@ -23,13 +23,23 @@
 #if defined(USE_PETSC)
 #include <petsc.h>
 #include <mpi.h>
+#include <logog/include/logog.hpp>
 namespace ApplicationsLib
 {
 struct LinearSolverLibrarySetup final
 {
     LinearSolverLibrarySetup(int argc, char* argv[])
     {
+#ifdef _OPENMP
+        // Threads are used within the ranks, e.g., for the concurrent
+        // assembly; MPI is called by the master thread only.
+        int provided;
+        MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+        if (provided < MPI_THREAD_FUNNELED)
+            WARN("The MPI library does not support threads.");
+#else
         MPI_Init(&argc, &argv);
+#endif
         char help[] = "ogs6 with PETSc \n";
         PetscInitialize(&argc, &argv, nullptr, help);
     }
@@ -77,7 +77,12 @@ ProjectData::ProjectData(BaseLib::ConfigTree const& project_config,
         std::string const mesh_file = BaseLib::copyPathToFileName(
             mesh_param.getValue<std::string>(), project_directory);
 
-        MeshLib::Mesh* const mesh = MeshLib::IO::readMeshFromFile(mesh_file);
+        auto const memory_mapped =
+            //! \ogs_file_attr{prj__mesh__memory_mapped}
+            mesh_param.getConfigAttributeOptional<bool>("memory_mapped");
+
+        MeshLib::Mesh* const mesh = MeshLib::IO::readMeshFromFile(
+            mesh_file, memory_mapped && *memory_mapped);
         if (!mesh)
         {
             OGS_FATAL("Could not read mesh from \'%s\' file. No mesh added.",
@@ -294,6 +299,11 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
             //! \ogs_file_param{prj__processes__process__integration_order}
             process_config.getConfigParameter<int>("integration_order");
 
+        auto const concurrent_assembly =
+            //! \ogs_file_param{prj__processes__process__concurrent_assembly}
+            process_config.getConfigParameter<bool>("concurrent_assembly",
+                                                    false);
+
         std::unique_ptr<ProcessLib::Process> process;
 
         auto jacobian_assembler = ProcessLib::createJacobianAssembler(
@@ -457,6 +467,8 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
             OGS_FATAL("Unknown process type: %s", type.c_str());
         }
 
+        process->setConcurrentAssembly(concurrent_assembly);
+
         BaseLib::insertIfKeyUniqueElseError(_processes,
                                             name,
                                             std::move(process),
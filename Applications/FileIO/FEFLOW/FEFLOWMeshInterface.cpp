@@ -8,6 +8,7 @@
 
 #include "FEFLOWMeshInterface.h"
 
+#include <algorithm>
 #include <cctype>
 #include <memory>
 
@@ -17,10 +18,12 @@
 
 #include "BaseLib/FileTools.h"
 #include "BaseLib/StringTools.h"
+#include "BaseLib/TextTokenizer.h"
 
 #include "Applications/FileIO/FEFLOW/FEFLOWGeoInterface.h"
 #include "GeoLib/Point.h"
 #include "GeoLib/Polygon.h"
+#include "GeoLib/PreparedPolygon.h"
 
 #include "MeshLib/Elements/Elements.h"
 #include "MeshLib/Mesh.h"
@@ -130,19 +133,18 @@ MeshLib::Mesh* FEFLOWMeshInterface::readFEFLOWFile(const std::string& filename)
                 return nullptr;
             }
 
-            vec_elements.reserve(fem_dim.n_elements);
-            for (std::size_t i = 0; i < fem_dim.n_elements; i++)
-            {
-                std::getline(in, line_string);
-                vec_elements.push_back(
-                    readElement(fem_dim, eleType, line_string, vec_nodes));
-            }
+            auto const lines = readLines(in, fem_dim.n_elements);
+            vec_elements.resize(lines.size());
+            OPENMP_LOOP_TYPE const n_elements = lines.size();
+#pragma omp parallel for
+            for (OPENMP_LOOP_TYPE i = 0; i < n_elements; i++)
+                vec_elements[i] =
+                    readElement(fem_dim, eleType, lines[i], vec_nodes);
         }
         else if (line_string.compare("VARNODE") == 0)
         {
             assert(!vec_nodes.empty());
 
-            vec_elements.reserve(fem_dim.n_elements);
             if (fem_dim.n_nodes_of_element == 0) // mixed element case
                 if (!std::getline(in, line_string))
                 {
@@ -154,12 +156,12 @@ MeshLib::Mesh* FEFLOWMeshInterface::readFEFLOWFile(const std::string& filename)
                     return nullptr;
                 }
 
-            for (std::size_t i = 0; i < fem_dim.n_elements; i++)
-            {
-                std::getline(in, line_string);
-                vec_elements.push_back(
-                    readElement(line_string, vec_nodes));
-            }
+            auto const lines = readLines(in, fem_dim.n_elements);
+            vec_elements.resize(lines.size());
+            OPENMP_LOOP_TYPE const n_elements = lines.size();
+#pragma omp parallel for
+            for (OPENMP_LOOP_TYPE i = 0; i < n_elements; i++)
+                vec_elements[i] = readElement(lines[i], vec_nodes);
         }
         //....................................................................
         // COOR
@@ -247,43 +249,64 @@ MeshLib::Mesh* FEFLOWMeshInterface::readFEFLOWFile(const std::string& filename)
     return mesh.release();
 }
 
+std::vector<std::string> FEFLOWMeshInterface::readLines(
+    std::ifstream& in, std::size_t const n_lines)
+{
+    std::vector<std::string> lines(n_lines);
+    for (std::size_t i = 0; i < n_lines; ++i)
+    {
+        if (!std::getline(in, lines[i]))
+        {
+            lines.resize(i);
+            break;
+        }
+    }
+    return lines;
+}
+
 void FEFLOWMeshInterface::readNodeCoordinates(
     std::ifstream& in, std::vector<MeshLib::Node*>& vec_nodes)
 {
-    std::string line_string;
-    char dummy_char;  // for comma(,)
+    // read the lines containing the coordinates as strings
+    auto const lines = readLines(in, vec_nodes.size());
+    if (lines.size() != vec_nodes.size())
+    {
+        ERR("Could not read the node '%u'.",
+            static_cast<unsigned>(lines.size()));
+        for (auto * n : vec_nodes)
+            delete n;
+        return;
+    }
 
-    for (unsigned k = 0; k < vec_nodes.size(); ++k)
+    // parse the particular coordinates from the strings read above
+    std::vector<char> valid_nodes(vec_nodes.size(), 1);
+    OPENMP_LOOP_TYPE const n_nodes = vec_nodes.size();
+#pragma omp parallel for
+    for (OPENMP_LOOP_TYPE k = 0; k < n_nodes; ++k)
     {
-        // read the line containing the coordinates as string
-        if (!std::getline(in, line_string))
-        {
-            ERR("Could not read the node '%u'.", k);
-            for (auto * n : vec_nodes)
-                delete n;
-            return;
-        }
-        std::stringstream line_stream;
-        line_stream.str(line_string);
-        // parse the particular coordinates from the string read above
+        BaseLib::TextTokenizer line(lines[k]);
         for (std::size_t i(0); i < 3; ++i)
         {
-            if (!(line_stream >> (*vec_nodes[k])[i]))
-            {
-                ERR("Could not parse coordinate %u of node '%u'.", i, k);
-                for (auto* n : vec_nodes)
-                    delete n;
-                return;
-            }
-            if (!(line_stream >> dummy_char) && i < 2)  // read comma
+            if (!line.read((*vec_nodes[k])[i]))
             {
-                ERR("Could not parse node '%u'.", k);
-                for (auto* n : vec_nodes)
-                    delete n;
-                return;
+                valid_nodes[k] = 0;
+                break;
             }
+            line.skipSeparator(',');  // read comma
         }
     }
+
+    auto const invalid_node =
+        std::find(valid_nodes.begin(), valid_nodes.end(), 0);
+    if (invalid_node != valid_nodes.end())
+    {
+        ERR("Could not parse node '%u'.",
+            static_cast<unsigned>(
+                std::distance(valid_nodes.begin(), invalid_node)));
+        for (auto* n : vec_nodes)
+            delete n;
+        return;
+    }
 }
 
 void FEFLOWMeshInterface::readNodeCoordinates(
@@ -299,9 +322,7 @@ void FEFLOWMeshInterface::readNodeCoordinates(
     const std::size_t n_layers =
         (fem_class.dimension == 3) ? fem_class.n_layers3d + 1 : 1;
     std::string line_string;
-    std::stringstream line_stream;
     double x;
-    char dummy_char;  // for comma(,)
     // x, y
     for (unsigned k = 0; k < 2; k++)
     {
@@ -309,12 +330,14 @@ void FEFLOWMeshInterface::readNodeCoordinates(
         for (std::size_t i = 0; i < n_lines; i++)
         {
             getline(in, line_string);
-            line_stream.str(line_string);
+            BaseLib::TextTokenizer line(line_string);
             for (unsigned j = 0; j < 12; j++)
             {
                 if (i * 12 + j >= no_nodes_per_layer)
                     break;
-                line_stream >> x >> dummy_char;
+                if (!line.read(x))
+                    x = 0;
+                line.skipSeparator(',');
                 for (std::size_t l = 0; l < n_layers; l++)
                 {
                     const std::size_t n = i * 12 + l * no_nodes_per_layer + j;
@@ -325,7 +348,6 @@ void FEFLOWMeshInterface::readNodeCoordinates(
                         (*m_nod)[1] = x;
                 }
             }
-            line_stream.clear();
         }
     }
 }
@@ -448,10 +470,10 @@ void FEFLOWMeshInterface::readElevation(std::ifstream& in,
 MeshLib::Element* FEFLOWMeshInterface::readElement(
     std::string const& line, std::vector<MeshLib::Node*> const& nodes)
 {
-    std::stringstream ss(line);
+    BaseLib::TextTokenizer ss(line);
 
-    int ele_type;
-    ss >> ele_type;
+    int ele_type = 0;
+    ss.read(ele_type);
 
     MeshLib::MeshElemType elem_type;
     int n_nodes_of_element;
@@ -476,7 +498,7 @@ MeshLib::Element* FEFLOWMeshInterface::readElement(
 
     unsigned idx[8];
     for (std::size_t i = 0; i < n_nodes_of_element; ++i)
-        ss >> idx[i];
+        ss.read(idx[i]);
     MeshLib::Node** ele_nodes = new MeshLib::Node*[n_nodes_of_element];
 
     switch (elem_type)
@@ -513,11 +535,11 @@ MeshLib::Element* FEFLOWMeshInterface::readElement(
     const FEM_DIM& fem_dim, const MeshLib::MeshElemType elem_type,
     const std::string& line, const std::vector<MeshLib::Node*>& nodes)
 {
-    std::stringstream ss(line);
+    BaseLib::TextTokenizer ss(line);
 
     unsigned idx[8];
     for (std::size_t i = 0; i < fem_dim.n_nodes_of_element; ++i)
-        ss >> idx[i];
+        ss.read(idx[i]);
     MeshLib::Node** ele_nodes = new MeshLib::Node*[fem_dim.n_nodes_of_element];
 
     switch (elem_type)
@@ -663,19 +685,35 @@ void FEFLOWMeshInterface::setMaterialIDs(
     }
     else if (lines && !lines->empty())
     {
-        for (std::size_t i = 0; i < vec_elements.size(); ++i)
+        // the polygons are created and prepared once for all elements
+        std::vector<std::unique_ptr<GeoLib::Polygon>> polygons(lines->size());
+        std::vector<std::unique_ptr<GeoLib::PreparedPolygon>>
+            prepared_polygons(lines->size());
+        for (std::size_t j = 0; j < lines->size(); j++)
+        {
+            GeoLib::Polyline* poly = (*lines)[j];
+            if (!poly->isClosed())
+                continue;
+
+            polygons[j].reset(new GeoLib::Polygon(*poly, true));
+            prepared_polygons[j].reset(
+                new GeoLib::PreparedPolygon(*polygons[j]));
+        }
+
+        OPENMP_LOOP_TYPE const n_elements = vec_elements.size();
+#pragma omp parallel for
+        for (OPENMP_LOOP_TYPE i = 0; i < n_elements; ++i)
         {
             MeshLib::Element const* e = vec_elements[i];
             MeshLib::Node const gpt = e->getCenterOfGravity();
             std::size_t matId = 0;
-            for (std::size_t j = 0; j < lines->size(); j++)
+            for (std::size_t j = 0; j < prepared_polygons.size(); j++)
             {
-                GeoLib::Polyline* poly = (*lines)[j];
-                if (!poly->isClosed())
+                if (!prepared_polygons[j])
                     continue;
 
-                GeoLib::Polygon polygon(*poly, true);
-                if (polygon.isPntInPolygon(gpt[0], gpt[1], gpt[2]))
+                if (prepared_polygons[j]->isPntInPolygon(gpt[0], gpt[1],
+                                                         gpt[2]))
                 {
                     matId = j;
                     break;
@@ -81,6 +81,11 @@ private:
         unsigned dispersion_type = 0;
     };
 
+    /// Reads the next n_lines lines, which are fewer if the end of the file
+    /// is reached before.
+    static std::vector<std::string> readLines(std::ifstream& in,
+                                              std::size_t const n_lines);
+
     /// Read element type and node indices according to the element type.
     MeshLib::Element* readElement(std::string const& line,
                                   std::vector<MeshLib::Node*> const& nodes);
@@ -24,9 +24,13 @@
 #include "MeshLib/MeshEditing/ElementValueModification.h"
 
 #include "BaseLib/FileTools.h"
+#include "BaseLib/TextTokenizer.h"
 
+#include <algorithm>
+#include <array>
 #include <fstream>
-#include <map>
+#include <limits>
+#include <unordered_map>
 #include <vector>
 
 namespace FileIO
@@ -59,182 +63,306 @@ bool isGMSHMeshFile(const std::string& fname)
     return false;
 }
 
-void readNodeIDs(std::ifstream& in, unsigned n_nodes,
-                 std::vector<unsigned>& node_ids,
-                 std::map<unsigned, unsigned> const& id_map)
+namespace
 {
-    unsigned idx;
-    for (unsigned i = 0; i < n_nodes; i++)
+/// Maps the node ids of a GMSH file to the indices of the nodes. For dense
+/// ids, which is the usual case for files written by GMSH, the map is a
+/// vector indexed by the ids, otherwise a hash map.
+class NodeIdMap
+{
+public:
+    static std::size_t const invalid_index =
+        std::numeric_limits<std::size_t>::max();
+
+    explicit NodeIdMap(std::vector<long> const& ids)
+    {
+        if (ids.empty())
+            return;
+
+        auto const min_max = std::minmax_element(ids.begin(), ids.end());
+        _min_id = *min_max.first;
+        auto const range =
+            static_cast<unsigned long>(*min_max.second - _min_id) + 1;
+        // The first occurrence of an id is used.
+        if (range <= 2 * ids.size())
+        {
+            _dense_map.assign(range, invalid_index);
+            for (std::size_t i = 0; i < ids.size(); i++)
+            {
+                auto& index = _dense_map[ids[i] - _min_id];
+                if (index == invalid_index)
+                    index = i;
+            }
+        }
+        else
+        {
+            _sparse_map.reserve(ids.size());
+            for (std::size_t i = 0; i < ids.size(); i++)
+                _sparse_map.emplace(ids[i], i);
+        }
+    }
+
+    /// Returns the node index of the id or invalid_index for unknown ids.
+    std::size_t operator()(long const id) const
+    {
+        if (!_dense_map.empty())
+        {
+            if (id < _min_id ||
+                static_cast<unsigned long>(id - _min_id) >= _dense_map.size())
+                return invalid_index;
+            return _dense_map[id - _min_id];
+        }
+        auto const it = _sparse_map.find(id);
+        return it == _sparse_map.end() ? invalid_index : it->second;
+    }
+
+private:
+    long _min_id = 0;
+    std::vector<std::size_t> _dense_map;
+    std::unordered_map<long, std::size_t> _sparse_map;
+};
+
+std::size_t const NodeIdMap::invalid_index;
+
+template <typename ElementType>
+MeshLib::Element* readElementNodes(BaseLib::TextTokenizer& line,
+                                   std::vector<MeshLib::Node*> const& nodes,
+                                   NodeIdMap const& id_map,
+                                   bool const reverse_node_order = false)
+{
+    unsigned const n_nodes = ElementType::n_all_nodes;
+    std::array<MeshLib::Node*, ElementType::n_all_nodes> element_nodes;
+    for (unsigned k = 0; k < n_nodes; k++)
     {
-        in >> idx;
-        node_ids.push_back(id_map.at(idx));
+        long id;
+        if (!line.read(id))
+            return nullptr;
+        std::size_t const index = id_map(id);
+        if (index == NodeIdMap::invalid_index)
+            return nullptr;
+        element_nodes[reverse_node_order ? n_nodes - 1 - k : k] = nodes[index];
     }
+    // the node array will be deleted from the element object
+    auto elem_nodes = new MeshLib::Node*[n_nodes];
+    std::copy(element_nodes.begin(), element_nodes.end(), elem_nodes);
+    return new ElementType(elem_nodes);
 }
 
-std::pair<MeshLib::Element*, int> readElement(
-    std::ifstream& in, std::vector<MeshLib::Node*> const& nodes,
-    std::map<unsigned, unsigned> const& id_map)
+/// Reads an element line.
+/// \param element is set to the new element or to a nullptr for the element
+/// types, which are not read.
+/// \return false if the line could not be parsed
+bool readElement(BaseLib::TextTokenizer& line,
+                 std::vector<MeshLib::Node*> const& nodes,
+                 NodeIdMap const& id_map, unsigned& type, int& mat_id,
+                 MeshLib::Element*& element)
 {
-    unsigned idx, type, n_tags, dummy;
-    int mat_id;
-    std::vector<unsigned> node_ids;
-    std::vector<MeshLib::Node*> elem_nodes;
-    in >> idx >> type >> n_tags >> mat_id >> dummy;
+    element = nullptr;
+    unsigned idx, n_tags;
+    long dummy;
+    if (!(line.read(idx) && line.read(type) && line.read(n_tags) &&
+          line.read(mat_id) && line.read(dummy)))
+        return false;
 
     // skip tags
     for (std::size_t j = 2; j < n_tags; j++)
-        in >> dummy;
+        if (!line.read(dummy))
+            return false;
 
     switch (type)
     {
-    case 1: {
-        readNodeIDs(in, 2, node_ids, id_map);
-        // edge_nodes array will be deleted from Line object
-        auto edge_nodes = new MeshLib::Node*[2];
-        edge_nodes[0] = nodes[node_ids[0]];
-        edge_nodes[1] = nodes[node_ids[1]];
-        return std::make_pair(new MeshLib::Line(edge_nodes), mat_id);
+        case 1:
+            element = readElementNodes<MeshLib::Line>(line, nodes, id_map);
+            break;
+        case 2:
+            element = readElementNodes<MeshLib::Tri>(line, nodes, id_map, true);
+            break;
+        case 3:
+            element = readElementNodes<MeshLib::Quad>(line, nodes, id_map);
+            break;
+        case 4:
+            element = readElementNodes<MeshLib::Tet>(line, nodes, id_map);
+            break;
+        case 5:
+            element = readElementNodes<MeshLib::Hex>(line, nodes, id_map);
+            break;
+        case 6:
+            element = readElementNodes<MeshLib::Prism>(line, nodes, id_map);
+            break;
+        case 7:
+            element = readElementNodes<MeshLib::Pyramid>(line, nodes, id_map);
+            break;
+        default:  // points (type 15) and unknown element types are skipped
+            return true;
     }
-    case 2: {
-        readNodeIDs(in, 3, node_ids, id_map);
-        auto tri_nodes = new MeshLib::Node*[3];
-        tri_nodes[0] = nodes[node_ids[2]];
-        tri_nodes[1] = nodes[node_ids[1]];
-        tri_nodes[2] = nodes[node_ids[0]];
-        return std::make_pair(new MeshLib::Tri(tri_nodes), mat_id);
+    return element != nullptr;
+}
+
+bool readNodes(BaseLib::TextTokenizer& tokenizer,
+               std::vector<MeshLib::Node*>& nodes, std::vector<long>& ids)
+{
+    std::size_t n_nodes(0);
+    if (!tokenizer.read(n_nodes))
+    {
+        ERR("readGMSHMesh(): Could not read the number of nodes.");
+        return false;
     }
-    case 3: {
-        readNodeIDs(in, 4, node_ids, id_map);
-        auto quad_nodes = new MeshLib::Node*[4];
-        for (unsigned k(0); k < 4; k++)
-            quad_nodes[k] = nodes[node_ids[k]];
-        return std::make_pair(new MeshLib::Quad(quad_nodes), mat_id);
+    tokenizer.skipLine();
+
+    auto const lines = tokenizer.splitLines(n_nodes);
+    if (lines.size() != n_nodes + 1)
+    {
+        ERR("readGMSHMesh(): Expected %d nodes, but found only %d.", n_nodes,
+            lines.empty() ? 0 : lines.size() - 1);
+        return false;
     }
-    case 4: {
-        readNodeIDs(in, 4, node_ids, id_map);
-        auto tet_nodes = new MeshLib::Node*[5];
-        for (unsigned k(0); k < 4; k++)
-            tet_nodes[k] = nodes[node_ids[k]];
-        return std::make_pair(new MeshLib::Tet(tet_nodes), mat_id);
+
+    nodes.resize(n_nodes, nullptr);
+    ids.resize(n_nodes);
+    bool valid_nodes = true;
+    OPENMP_LOOP_TYPE const n = n_nodes;
+#pragma omp parallel for reduction(&& : valid_nodes)
+    for (OPENMP_LOOP_TYPE i = 0; i < n; i++)
+    {
+        BaseLib::TextTokenizer line(lines[i], lines[i + 1]);
+        double x[3];
+        bool const valid_node = line.read(ids[i]) && line.read(x[0]) &&
+                                line.read(x[1]) && line.read(x[2]);
+        if (valid_node)
+            nodes[i] = new MeshLib::Node(x, ids[i]);
+        valid_nodes = valid_nodes && valid_node;
     }
-    case 5: {
-        readNodeIDs(in, 8, node_ids, id_map);
-        auto hex_nodes = new MeshLib::Node*[8];
-        for (unsigned k(0); k < 8; k++)
-            hex_nodes[k] = nodes[node_ids[k]];
-        return std::make_pair(new MeshLib::Hex(hex_nodes), mat_id);
+    if (!valid_nodes)
+        ERR("readGMSHMesh(): Could not parse the nodes.");
+
+    tokenizer.skipLine();  // End Node keyword $EndNodes
+    return valid_nodes;
+}
+
+bool readElements(BaseLib::TextTokenizer& tokenizer,
+                  std::vector<MeshLib::Node*> const& nodes,
+                  std::vector<long> const& node_ids,
+                  std::vector<MeshLib::Element*>& elements,
+                  std::vector<int>& materials)
+{
+    std::size_t n_elements(0);
+    if (!tokenizer.read(n_elements))  // number-of-elements
+    {
+        ERR("Read GMSH mesh does not contain any elements");
+        return true;
     }
-    case 6: {
-        readNodeIDs(in, 6, node_ids, id_map);
-        auto prism_nodes = new MeshLib::Node*[6];
-        for (unsigned k(0); k < 6; k++)
-            prism_nodes[k] = nodes[node_ids[k]];
-        return std::make_pair(new MeshLib::Prism(prism_nodes), mat_id);
+    tokenizer.skipLine();
+
+    auto const lines = tokenizer.splitLines(n_elements);
+    if (lines.size() != n_elements + 1)
+    {
+        ERR("readGMSHMesh(): Expected %d elements, but found only %d.",
+            n_elements, lines.empty() ? 0 : lines.size() - 1);
+        return false;
     }
-    case 7: {
-        readNodeIDs(in, 5, node_ids, id_map);
-        auto pyramid_nodes = new MeshLib::Node*[5];
-        for (unsigned k(0); k < 5; k++)
-            pyramid_nodes[k] = nodes[node_ids[k]];
-        return std::make_pair(new MeshLib::Pyramid(pyramid_nodes), mat_id);
+
+    NodeIdMap const id_map(node_ids);
+    std::vector<MeshLib::Element*> all_elements(n_elements, nullptr);
+    std::vector<int> all_materials(n_elements);
+    std::vector<unsigned> types(n_elements);
+    bool valid_elements = true;
+    OPENMP_LOOP_TYPE const n = n_elements;
+#pragma omp parallel for reduction(&& : valid_elements)
+    for (OPENMP_LOOP_TYPE i = 0; i < n; i++)
+    {
+        BaseLib::TextTokenizer line(lines[i], lines[i + 1]);
+        valid_elements =
+            readElement(line, nodes, id_map, types[i], all_materials[i],
+                        all_elements[i]) &&
+            valid_elements;
     }
-    case 15:
-        in >> dummy; // skip rest of line
-        break;
-    default:
-        WARN("readGMSHMesh(): Unknown element type %d.", type);
-        break;
+    if (!valid_elements)
+    {
+        ERR("readGMSHMesh(): Could not parse the elements.");
+        for (auto* e : all_elements)
+            delete e;
+        return false;
     }
-    return std::make_pair(nullptr, -1);
+
+    elements.reserve(n_elements);
+    materials.reserve(n_elements);
+    for (std::size_t i = 0; i < n_elements; i++)
+    {
+        if (all_elements[i])
+        {
+            elements.push_back(all_elements[i]);
+            materials.push_back(all_materials[i]);
+        }
+        else if (types[i] != 15)
+        {
+            WARN("readGMSHMesh(): Unknown element type %d.", types[i]);
+        }
+    }
+    tokenizer.skipLine();  // END keyword
+    return true;
 }
+}  // namespace
 
 MeshLib::Mesh* readGMSHMesh(std::string const& fname)
 {
-    std::string line;
-    std::ifstream in(fname.c_str(), std::ios::in);
-    if (!in.is_open())
+    std::string content;
+    if (!BaseLib::readFileIntoString(fname, content))
     {
         WARN ("readGMSHMesh() - Could not open file %s.", fname.c_str());
         return nullptr;
     }
+    BaseLib::TextTokenizer tokenizer(content);
 
-    getline(in, line); // $MeshFormat keyword
+    std::string line;
+    tokenizer.readLine(line); // $MeshFormat keyword
     if (line.find("$MeshFormat") == std::string::npos)
     {
-        in.close();
         WARN ("No GMSH file format recognized.");
         return nullptr;
     }
 
-    getline(in, line); // version-number file-type data-size
+    tokenizer.readLine(line); // version-number file-type data-size
     if (line.substr(0,3).compare("2.2") != 0) {
         WARN("Wrong gmsh file format version.");
         return nullptr;
     }
 
-    if (line.substr(4,1).compare("0") != 0) {
+    if (line.size() < 5 || line.substr(4,1).compare("0") != 0) {
         WARN("Currently reading gmsh binary file type is not supported.");
         return nullptr;
     }
-    getline(in, line); //$EndMeshFormat
+    tokenizer.readLine(line); //$EndMeshFormat
 
     std::vector<MeshLib::Node*> nodes;
+    std::vector<long> node_ids;
     std::vector<MeshLib::Element*> elements;
     std::vector<int> materials;
-    std::map<unsigned, unsigned> id_map;
-    while (line.find("$EndElements") == std::string::npos)
+    bool valid = true;
+    while (valid && tokenizer.readLine(line))
     {
         // Node data
-        getline(in, line); //$Nodes Keywords
         if (line.find("$Nodes") != std::string::npos)
         {
-            std::size_t n_nodes(0);
-            long id;
-            double x, y, z;
-            in >> n_nodes >> std::ws;
-            nodes.resize(n_nodes);
-            for (std::size_t i = 0; i < n_nodes; i++) {
-                in >> id >> x >> y >> z >> std::ws;
-                id_map.insert(std::map<unsigned, unsigned>::value_type(id, i));
-                nodes[i] = new MeshLib::Node(x,y,z,id);
-            }
-            getline(in, line); // End Node keyword $EndNodes
+            valid = readNodes(tokenizer, nodes, node_ids);
         }
-
         // Element data
-        if (line.find("$Elements") != std::string::npos)
+        else if (line.find("$Elements") != std::string::npos)
         {
-            std::size_t n_elements(0);
-            if (! (in >> n_elements >> std::ws)) { // number-of-elements
-                ERR("Read GMSH mesh does not contain any elements");
-            }
-            elements.reserve(n_elements);
-            materials.reserve(n_elements);
-            for (std::size_t i = 0; i < n_elements; i++)
-            {
-                MeshLib::Element* elem(nullptr);
-                int mat_id(0);
-                std::tie(elem, mat_id) = readElement(in, nodes, id_map);
-
-                if (elem) {
-                    elements.push_back(elem);
-                    materials.push_back(mat_id);
-                }
-            }
-            getline(in, line); // END keyword
+            valid = readElements(tokenizer, nodes, node_ids, elements,
+                                 materials);
+            break;
         }
-
-        if (line.find("PhysicalNames") != std::string::npos)
+        else if (line.find("PhysicalNames") != std::string::npos)
         {
             std::size_t n_lines(0);
-            in >> n_lines >> std::ws; // number-of-lines
+            tokenizer.read(n_lines); // number-of-lines
+            tokenizer.skipLine();
             for (std::size_t i = 0; i < n_lines; i++)
-                getline(in, line);
-            getline(in, line); // END keyword
+                tokenizer.skipLine();
+            tokenizer.skipLine(); // END keyword
         }
     }
-    in.close();
-    if (elements.empty()) {
+    if (!valid || elements.empty()) {
         for (auto it(nodes.begin()); it != nodes.end(); ++it) {
             delete *it;
         }
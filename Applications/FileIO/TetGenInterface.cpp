@@ -22,6 +22,7 @@
 
 #include "BaseLib/FileTools.h"
 #include "BaseLib/StringTools.h"
+#include "BaseLib/TextTokenizer.h"
 
 #include "GeoLib/Triangle.h"
 
@@ -319,18 +320,14 @@ bool TetGenInterface::parseNodes(std::ifstream &ins,
             return false;
         }
 
-        std::size_t id;
-        std::size_t pos_end = 0;
-        std::size_t pos_beg = line.find_first_not_of(' ', pos_end);
-        pos_end = line.find_first_of(" \n", pos_beg);
-
-        if (line.empty() || pos_beg==pos_end || line.compare(pos_beg,1,"#") == 0)
+        BaseLib::TextTokenizer tokenizer(line);
+        if (tokenizer.atEnd() || *tokenizer.getPosition() == '#')
         {
             continue;
         }
 
-        if (pos_beg != std::string::npos && pos_end != std::string::npos) {
-            id = BaseLib::str2number<std::size_t> (line.substr(pos_beg, pos_end - pos_beg));
+        std::size_t id;
+        if (tokenizer.read(id)) {
             if (k == 0 && id == 0)
                 _zero_based_idx = true;
         } else {
@@ -341,12 +338,7 @@ bool TetGenInterface::parseNodes(std::ifstream &ins,
         // read coordinates
         const unsigned offset = (_zero_based_idx) ? 0 : 1;
         for (std::size_t i(0); i < dim; i++) {
-            pos_beg = line.find_first_not_of(' ', pos_end);
-            pos_end = line.find_first_of(" \n", pos_beg);
-            if (pos_end == std::string::npos) pos_end = line.size();
-            if (pos_beg != std::string::npos)
-                coordinates[i] = BaseLib::str2number<double>(line.substr(pos_beg, pos_end-pos_beg));
-            else {
+            if (!tokenizer.read(coordinates[i])) {
                 ERR("TetGenInterface::parseNodes(): error reading coordinate %d of node %d.", i, k);
                 delete [] coordinates;
                 return false;
@@ -449,17 +441,15 @@ bool TetGenInterface::parseElements(std::ifstream& ins,
             return false;
         }
 
-        std::size_t pos_end = 0;
-        std::size_t pos_beg = line.find_first_not_of(' ', pos_end);
-        pos_end = line.find_first_of(" \n", pos_beg);
-
-        if (line.empty() || pos_beg==pos_end || line.compare(pos_beg,1,"#") == 0)
+        BaseLib::TextTokenizer tokenizer(line);
+        if (tokenizer.atEnd() || *tokenizer.getPosition() == '#')
         {
             k--;
             continue;
         }
 
-        if (pos_beg == std::string::npos || pos_end == std::string::npos)
+        std::size_t id;
+        if (!tokenizer.read(id))
         {
             ERR("TetGenInterface::parseElements(): Error reading id of tetrahedron %d.", k);
             return false;
@@ -468,12 +458,9 @@ bool TetGenInterface::parseElements(std::ifstream& ins,
         // read node ids
         for (std::size_t i(0); i < n_nodes_per_tet; i++)
         {
-            pos_beg = line.find_first_not_of(' ', pos_end);
-            pos_end = line.find_first_of(' ', pos_beg);
-            if (pos_end == std::string::npos)
-                pos_end = line.size();
-            if (pos_beg != std::string::npos && pos_end != std::string::npos)
-                ids[i] = BaseLib::str2number<std::size_t>(line.substr(pos_beg, pos_end - pos_beg)) - offset;
+            if (tokenizer.read(ids[i]) && ids[i] >= offset &&
+                ids[i] - offset < nodes.size())
+                ids[i] -= offset;
             else
             {
                 ERR("TetGenInterface::parseElements(): Error reading node %d of tetrahedron %d.", i, k);
@@ -484,11 +471,10 @@ bool TetGenInterface::parseElements(std::ifstream& ins,
         // read region attribute - this is something like material group
         int region (0);
         if (region_attribute) {
-            pos_beg = line.find_first_not_of(' ', pos_end);
-            pos_end = line.find_first_of(' ', pos_beg);
-            if (pos_end == std::string::npos) pos_end = line.size();
-            if (pos_beg != std::string::npos && pos_end != std::string::npos)
-                region = BaseLib::str2number<int> (line.substr(pos_beg, pos_end - pos_beg));
+            // TetGen writes the region attributes as floating point numbers.
+            double attribute;
+            if (tokenizer.read(attribute))
+                region = static_cast<int>(attribute);
             else {
                 ERR("TetGenInterface::parseElements(): Error reading region attribute of tetrahedron %d.", k);
                 return false;
@@ -0,0 +1,60 @@
+/**
+ * @file convertToBinaryMesh.cpp
+ * @brief Converts a mesh into the binary OGS mesh format and back.
+ *
+ * @copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/LICENSE.txt
+ */
+
+#include <memory>
+#include <string>
+
+#include <tclap/CmdLine.h>
+
+#include "Applications/ApplicationsLib/LogogSetup.h"
+
+#include "BaseLib/FileTools.h"
+#include "BaseLib/RunTime.h"
+#include "MeshLib/IO/readMeshFromFile.h"
+#include "MeshLib/IO/writeMeshToFile.h"
+#include "MeshLib/Mesh.h"
+
+int main(int argc, char* argv[])
+{
+    ApplicationsLib::LogogSetup logog_setup;
+
+    TCLAP::CmdLine cmd(
+        "Converts a mesh (msh, vtu) into the binary OGS mesh format (bmsh), "
+        "which is read without parsing. A bmsh file can also be converted "
+        "back into a msh or vtu file.",
+        ' ', "0.1");
+    TCLAP::ValueArg<std::string> mesh_in(
+        "i", "mesh-input-file",
+        "the name of the file containing the input mesh", true, "",
+        "file name of input mesh");
+    cmd.add(mesh_in);
+    TCLAP::ValueArg<std::string> mesh_out(
+        "o", "mesh-output-file",
+        "the name of the file the mesh will be written to, the format is "
+        "given by the extension (bmsh, msh, vtu)",
+        true, "", "file name of output mesh");
+    cmd.add(mesh_out);
+    cmd.parse(argc, argv);
+
+    BaseLib::RunTime run_time;
+    run_time.start();
+    std::unique_ptr<MeshLib::Mesh const> mesh(
+        MeshLib::IO::readMeshFromFile(mesh_in.getValue()));
+    if (!mesh)
+        return EXIT_FAILURE;
+    INFO("Mesh read in %g s: %d nodes, %d elements.", run_time.elapsed(),
+         mesh->getNumberOfNodes(), mesh->getNumberOfElements());
+
+    if (MeshLib::IO::writeMeshToFile(*mesh, mesh_out.getValue()) != 0)
+        return EXIT_FAILURE;
+
+    return EXIT_SUCCESS;
+}
@@ -23,6 +23,7 @@
 #include "GeoLib/AnalyticalGeometry.h"
 #include "GeoLib/GEOObjects.h"
 #include "GeoLib/Polygon.h"
+#include "GeoLib/PreparedPolygon.h"
 #include "GeoLib/IO/readGeometryFromFile.h"
 
 #include "MathLib/Vector3.h"
@@ -54,12 +55,9 @@ static std::vector<bool> markNodesOutSideOfPolygon(
     );
 
     // *** mark rotated nodes
-    std::vector<bool> outside(rotated_nodes.size(), true);
-    for (std::size_t k(0); k<rotated_nodes.size(); k++) {
-        if (rot_polygon.isPntInPolygon(*(rotated_nodes[k]))) {
-            outside[k] = false;
-        }
-    }
+    std::vector<bool> outside(
+        GeoLib::PreparedPolygon(rot_polygon).arePntsInPolygon(rotated_nodes));
+    outside.flip();
 
     for (auto & rotated_node : rotated_nodes)
         delete rotated_node;
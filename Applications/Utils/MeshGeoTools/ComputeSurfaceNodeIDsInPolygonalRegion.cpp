@@ -25,6 +25,7 @@
 
 #include "GeoLib/GEOObjects.h"
 #include "GeoLib/Polygon.h"
+#include "GeoLib/PreparedPolygon.h"
 #include "GeoLib/IO/readGeometryFromFile.h"
 
 #include "MathLib/Vector3.h"
@@ -134,11 +135,13 @@ int main (int argc, char* argv[])
         // create Polygon from Polyline
         GeoLib::Polygon const& polygon(*(plys[j]));
         // ids of mesh nodes on surface that are within the given polygon
+        std::vector<bool> const inside(
+            GeoLib::PreparedPolygon(polygon).arePntsInPolygon(all_sfc_nodes));
         std::vector<std::pair<std::size_t, double>> ids_and_areas;
         for (std::size_t k(0); k<all_sfc_nodes.size(); k++) {
-            MeshLib::Node const& pnt(*(all_sfc_nodes[k]));
-            if (polygon.isPntInPolygon(pnt[0], pnt[1], pnt[2])) {
-                ids_and_areas.push_back(std::make_pair(pnt.getID(), areas[k]));
+            if (inside[k]) {
+                ids_and_areas.push_back(
+                    std::make_pair(all_sfc_nodes[k]->getID(), areas[k]));
             }
         }
         if (ids_and_areas.empty()) {
@@ -14,29 +14,24 @@
 
 #include "NodeWiseMeshPartitioner.h"
 
+#include <algorithm>
 #include <limits>
 #include <iomanip>
 #include <cstdio>  // for binary output
 #include <numeric>
+#include <sstream>
 
 #include <logog/include/logog.hpp>
 
 #include "BaseLib/Error.h"
 
+#include "MeshLib/IO/MPI_IO/PartitionedMeshFormat.h"
 #include "MeshLib/IO/VtkIO/VtuInterface.h"
 
 #include "MeshLib/Elements/Element.h"
 
 namespace ApplicationUtils
 {
-struct NodeStruct
-{
-    NodeWiseMeshPartitioner::IntegerType id;
-    double x;
-    double y;
-    double z;
-};
-
 void NodeWiseMeshPartitioner::readMetisData(const std::string& file_name_base)
 {
     const std::string npartitions_str = std::to_string(_npartitions);
@@ -329,6 +324,75 @@ NodeWiseMeshPartitioner::getNumberOfIntegerVariablesOfElements(
     return nmb_element_idxs;
 }
 
+std::array<NodeWiseMeshPartitioner::IntegerType, 14>
+NodeWiseMeshPartitioner::getPartitionConfigData(
+    Partition const& partition) const
+{
+    std::array<IntegerType, 14> config_data;
+    config_data[0] = partition.nodes.size();
+    config_data[1] = partition.number_of_base_nodes;
+    config_data[2] = partition.regular_elements.size();
+    config_data[3] = partition.ghost_elements.size();
+    config_data[4] = partition.number_of_non_ghost_base_nodes;
+    config_data[5] = partition.number_of_non_ghost_nodes;
+    config_data[6] = _mesh->getNumberOfBaseNodes();
+    config_data[7] = _mesh->getNumberOfNodes();
+    config_data[8] =
+        getNumberOfIntegerVariablesOfElements(partition.regular_elements);
+    config_data[9] =
+        getNumberOfIntegerVariablesOfElements(partition.ghost_elements);
+    std::fill(config_data.begin() + 10, config_data.end(), 0);
+    return config_data;
+}
+
+std::vector<NodeWiseMeshPartitioner::IntegerType>
+NodeWiseMeshPartitioner::getLocalNodeIds(Partition const& partition) const
+{
+    IntegerType node_local_id_offset = 0;
+    std::vector<IntegerType> nodes_local_ids(_mesh->getNumberOfNodes(), -1);
+    for (const auto* node : partition.nodes)
+    {
+        nodes_local_ids[node->getID()] = node_local_id_offset;
+        node_local_id_offset++;
+    }
+    return nodes_local_ids;
+}
+
+std::vector<NodeWiseMeshPartitioner::IntegerType>
+NodeWiseMeshPartitioner::getElementIntegers(
+    std::vector<const MeshLib::Element*> const& elements,
+    std::vector<IntegerType> const& local_node_ids) const
+{
+    std::vector<IntegerType> ele_info(
+        elements.size() + getNumberOfIntegerVariablesOfElements(elements));
+
+    IntegerType counter = elements.size();
+    for (std::size_t j = 0; j < elements.size(); j++)
+    {
+        ele_info[j] = counter;
+        getElementIntegerVariables(*elements[j], local_node_ids, ele_info,
+                                   counter);
+    }
+    return ele_info;
+}
+
+std::vector<NodeWiseMeshPartitioner::NodeStruct>
+NodeWiseMeshPartitioner::getNodeStructs(Partition const& partition) const
+{
+    std::vector<NodeStruct> nodes_buffer;
+    nodes_buffer.reserve(partition.nodes.size());
+
+    for (const auto* node : partition.nodes)
+    {
+        double const* coords = node->getCoords();
+        NodeStruct const node_struct = {
+            static_cast<IntegerType>(_nodes_global_ids[node->getID()]),
+            coords[0], coords[1], coords[2]};
+        nodes_buffer.emplace_back(node_struct);
+    }
+    return nodes_buffer;
+}
+
 void NodeWiseMeshPartitioner::writePropertiesBinary(
     const std::string& file_name_base) const
 {
@@ -380,71 +444,40 @@ void NodeWiseMeshPartitioner::writePropertiesBinary(
     out_val.close();
 }
 
-std::tuple<std::vector<NodeWiseMeshPartitioner::IntegerType>,
-           std::vector<NodeWiseMeshPartitioner::IntegerType>>
-NodeWiseMeshPartitioner::writeConfigDataBinary(
+void NodeWiseMeshPartitioner::writeConfigDataBinary(
     const std::string& file_name_base)
 {
     const std::string fname = file_name_base + "_partitioned_msh_cfg"
                               + std::to_string(_npartitions) + ".bin";
     FILE* of_bin_cfg = fopen(fname.c_str(), "wb");
 
-    const IntegerType num_config_data = 14;
-    IntegerType config_data[num_config_data];
-    // node rank offset
-    config_data[10] = 0;
-    // element rank offset
-    config_data[11] = 0;
-    // ghost element rank offset
-    config_data[12] = 0;
-    // Reserved
-    config_data[13] = 0;
-    std::vector<IntegerType> num_elem_integers(_partitions.size());
-    std::vector<IntegerType> num_g_elem_integers(_partitions.size());
-    std::size_t loop_id = 0;
+    // node rank offset, element rank offset, and ghost element rank offset
+    IntegerType rank_offsets[3] = {0, 0, 0};
     for (const auto& partition : _partitions)
     {
-        config_data[0] = partition.nodes.size();
-        config_data[1] = partition.number_of_base_nodes;
-        config_data[2] = partition.regular_elements.size();
-        config_data[3] = partition.ghost_elements.size();
-        config_data[4] = partition.number_of_non_ghost_base_nodes;
-        config_data[5] = partition.number_of_non_ghost_nodes;
-        config_data[6] = _mesh->getNumberOfBaseNodes();
-        config_data[7] = _mesh->getNumberOfNodes();
-        config_data[8] =
-            getNumberOfIntegerVariablesOfElements(partition.regular_elements);
-        config_data[9] =
-            getNumberOfIntegerVariablesOfElements(partition.ghost_elements);
-
-        fwrite(config_data, 1, num_config_data * sizeof(IntegerType), of_bin_cfg);
+        auto config_data = getPartitionConfigData(partition);
+        std::copy_n(rank_offsets, 3, config_data.begin() + 10);
 
-        config_data[10] += config_data[0] * sizeof(NodeStruct);
+        fwrite(config_data.data(), 1, config_data.size() * sizeof(IntegerType),
+               of_bin_cfg);
 
         // Update offsets
-        num_elem_integers[loop_id] =
-            partition.regular_elements.size() + config_data[8];
+        rank_offsets[0] += config_data[0] * sizeof(NodeStruct);
         // Offset the ending entry of the element integer variales of
         // the non-ghost elements of this partition in the vector of elem_info.
-        config_data[11] += num_elem_integers[loop_id] * sizeof(IntegerType);
+        rank_offsets[1] +=
+            (config_data[2] + config_data[8]) * sizeof(IntegerType);
         // Offset the ending entry of the element integer variales of
         // the ghost elements of this partition in the vector of elem_info.
-        num_g_elem_integers[loop_id] =
-            partition.ghost_elements.size() + config_data[9];
-        config_data[12] += num_g_elem_integers[loop_id] * sizeof(IntegerType);
-
-        loop_id++;
+        rank_offsets[2] +=
+            (config_data[3] + config_data[9]) * sizeof(IntegerType);
     }
 
     fclose(of_bin_cfg);
-
-    return  std::make_tuple(num_elem_integers, num_g_elem_integers);
 }
 
-void NodeWiseMeshPartitioner::writeElementsBinary
-                     (const std::string& file_name_base,
-                      const std::vector<IntegerType>& num_elem_integers,
-                      const std::vector<IntegerType>& num_g_elem_integers)
+void NodeWiseMeshPartitioner::writeElementsBinary(
+    const std::string& file_name_base)
 {
     const std::string npartitions_str = std::to_string(_npartitions);
     std::string fname = file_name_base + "_partitioned_msh_ele"
@@ -453,51 +486,20 @@ void NodeWiseMeshPartitioner::writeElementsBinary
     fname =
         file_name_base + "_partitioned_msh_ele_g" + npartitions_str + ".bin";
     FILE* of_bin_ele_g = fopen(fname.c_str(), "wb");
-    for (std::size_t i = 0; i < _partitions.size(); i++)
+    for (const auto& partition : _partitions)
     {
-        const auto& partition = _partitions[i];
-
-        // Set the local node indices of the current partition.
-        IntegerType node_local_id_offset = 0;
-        std::vector<IntegerType> nodes_local_ids(_mesh->getNumberOfNodes(), -1);
-        for (const auto* node : partition.nodes)
-        {
-            nodes_local_ids[node->getID()] = node_local_id_offset;
-            node_local_id_offset++;
-        }
-
-        // A vector contians all element integer variales of
-        // the non-ghost elements of this partition
-        std::vector<IntegerType> ele_info(num_elem_integers[i]);
+        auto const nodes_local_ids = getLocalNodeIds(partition);
 
-        // Non-ghost elements.
-        IntegerType counter = partition.regular_elements.size();
-
-        for (std::size_t j = 0; j < partition.regular_elements.size(); j++)
-        {
-            const auto* elem = partition.regular_elements[j];
-            ele_info[j] = counter;
-            getElementIntegerVariables(*elem, nodes_local_ids, ele_info,
-                                       counter);
-        }
         // Write vector data of non-ghost elements
-        fwrite(ele_info.data(), 1, (num_elem_integers[i]) * sizeof(IntegerType),
+        auto const ele_info =
+            getElementIntegers(partition.regular_elements, nodes_local_ids);
+        fwrite(ele_info.data(), 1, ele_info.size() * sizeof(IntegerType),
                of_bin_ele);
 
-        // Ghost elements
-        ele_info.resize(num_g_elem_integers[i]);
-
-        counter = partition.ghost_elements.size();
-
-        for (std::size_t j = 0; j < partition.ghost_elements.size(); j++)
-        {
-            const auto* elem = partition.ghost_elements[j];
-            ele_info[j] = counter;
-            getElementIntegerVariables(*elem, nodes_local_ids, ele_info,
-                                       counter);
-        }
         // Write vector data of ghost elements
-        fwrite(ele_info.data(), 1, (num_g_elem_integers[i]) * sizeof(IntegerType),
+        auto const g_ele_info =
+            getElementIntegers(partition.ghost_elements, nodes_local_ids);
+        fwrite(g_ele_info.data(), 1, g_ele_info.size() * sizeof(IntegerType),
                of_bin_ele_g);
     }
 
@@ -513,38 +515,124 @@ void NodeWiseMeshPartitioner::writeNodesBinary(const std::string& file_name_base
 
     for (const auto& partition : _partitions)
     {
-        std::vector<NodeStruct> nodes_buffer;
-        nodes_buffer.reserve(partition.nodes.size());
-
-        for (const auto* node : partition.nodes)
-        {
-            double const* coords = node->getCoords();
-            NodeStruct node_struct;
-            node_struct.id = _nodes_global_ids[node->getID()];
-            node_struct.x = coords[0];
-            node_struct.y = coords[1];
-            node_struct.z = coords[2];
-            nodes_buffer.emplace_back(node_struct);
-        }
-        fwrite(nodes_buffer.data(), sizeof(NodeStruct), partition.nodes.size(),
+        auto const nodes_buffer = getNodeStructs(partition);
+        fwrite(nodes_buffer.data(), sizeof(NodeStruct), nodes_buffer.size(),
                of_bin_nod);
     }
     fclose(of_bin_nod);
 }
 
-void NodeWiseMeshPartitioner::writeBinary(const std::string& file_name_base)
+void NodeWiseMeshPartitioner::writeLegacyBinary(
+    const std::string& file_name_base)
 {
     writePropertiesBinary(file_name_base);
-    const auto elem_integers = writeConfigDataBinary(file_name_base);
+    writeConfigDataBinary(file_name_base);
+    writeElementsBinary(file_name_base);
+    writeNodesBinary(file_name_base);
+}
+
+void NodeWiseMeshPartitioner::writePropertiesPartBinary(
+    std::size_t const first_tuple, std::size_t const number_of_tuples,
+    std::ostream* out_val, std::ostream* out_meta) const
+{
+    for (auto const& name : _partitioned_properties.getPropertyVectorNames())
+    {
+        bool success =
+            writePropertyVectorPartBinary<double>(
+                name, first_tuple, number_of_tuples, out_val, out_meta) ||
+            writePropertyVectorPartBinary<float>(
+                name, first_tuple, number_of_tuples, out_val, out_meta) ||
+            writePropertyVectorPartBinary<int>(
+                name, first_tuple, number_of_tuples, out_val, out_meta) ||
+            writePropertyVectorPartBinary<long>(
+                name, first_tuple, number_of_tuples, out_val, out_meta) ||
+            writePropertyVectorPartBinary<unsigned>(
+                name, first_tuple, number_of_tuples, out_val, out_meta) ||
+            writePropertyVectorPartBinary<unsigned long>(
+                name, first_tuple, number_of_tuples, out_val, out_meta) ||
+            writePropertyVectorPartBinary<std::size_t>(
+                name, first_tuple, number_of_tuples, out_val, out_meta);
+        if (!success)
+            OGS_FATAL(
+                "writePropertiesPartBinary: Could not write PropertyVector "
+                "'%s'.",
+                name.c_str());
+    }
+}
 
-    const std::vector<IntegerType>& num_elem_integers
-                                         = std::get<0>(elem_integers);
-    const std::vector<IntegerType>& num_g_elem_integers
-                                         = std::get<1>(elem_integers);
-    writeElementsBinary(file_name_base, num_elem_integers,
-                        num_g_elem_integers);
+void NodeWiseMeshPartitioner::writeBinary(const std::string& file_name_base)
+{
+    namespace Format = MeshLib::IO::PartitionedMeshFormat;
 
-    writeNodesBinary(file_name_base);
+    const std::string fname =
+        Format::getFileName(file_name_base, _partitions.size());
+    std::ofstream out(fname, std::ios::binary | std::ios::out | std::ios::trunc);
+    if (!out)
+        OGS_FATAL("Error: cannot open file %s.", fname.c_str());
+
+    Format::Header header;
+    std::copy_n(Format::magic, sizeof(header.magic), header.magic);
+    header.version = Format::version;
+    header.number_of_partitions = _partitions.size();
+    out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+
+    // The table is written after the data blocks are known.
+    std::vector<Format::TableEntry> table(_partitions.size());
+    out.write(reinterpret_cast<char const*>(table.data()),
+              table.size() * sizeof(Format::TableEntry));
+
+    std::size_t const number_of_properties =
+        _partitioned_properties.getPropertyVectorNames().size();
+    std::size_t first_tuple = 0;
+    for (std::size_t i = 0; i < _partitions.size(); i++)
+    {
+        auto const& partition = _partitions[i];
+        auto& entry = table[i];
+        entry.block_offset = static_cast<unsigned long>(out.tellp());
+        entry.number_of_properties = number_of_properties;
+
+        std::ostringstream meta_data;
+        writePropertiesPartBinary(first_tuple, partition.nodes.size(),
+                                  nullptr, &meta_data);
+        auto const meta_data_str = meta_data.str();
+        entry.property_meta_data_size = meta_data_str.size();
+        out.write(meta_data_str.data(), meta_data_str.size());
+
+        auto const nodes = getNodeStructs(partition);
+        auto const nodes_local_ids = getLocalNodeIds(partition);
+        auto const elements =
+            getElementIntegers(partition.regular_elements, nodes_local_ids);
+        auto const ghost_elements =
+            getElementIntegers(partition.ghost_elements, nodes_local_ids);
+
+        auto const config_data = getPartitionConfigData(partition);
+        std::copy(config_data.begin(), config_data.end(), entry.mesh_info);
+        // Positions of nodes, elements and ghost elements within the block.
+        entry.mesh_info[10] = meta_data_str.size();
+        entry.mesh_info[11] =
+            entry.mesh_info[10] + nodes.size() * sizeof(NodeStruct);
+        entry.mesh_info[12] =
+            entry.mesh_info[11] + elements.size() * sizeof(IntegerType);
+
+        out.write(reinterpret_cast<char const*>(nodes.data()),
+                  nodes.size() * sizeof(NodeStruct));
+        out.write(reinterpret_cast<char const*>(elements.data()),
+                  elements.size() * sizeof(IntegerType));
+        out.write(reinterpret_cast<char const*>(ghost_elements.data()),
+                  ghost_elements.size() * sizeof(IntegerType));
+        writePropertiesPartBinary(first_tuple, partition.nodes.size(), &out,
+                                  nullptr);
+
+        entry.block_size =
+            static_cast<unsigned long>(out.tellp()) - entry.block_offset;
+        first_tuple += partition.nodes.size();
+    }
+
+    out.seekp(sizeof(header));
+    out.write(reinterpret_cast<char const*>(table.data()),
+              table.size() * sizeof(Format::TableEntry));
+    if (!out)
+        OGS_FATAL("Error: cannot write file %s.", fname.c_str());
 }
 
 void NodeWiseMeshPartitioner::writeConfigDataASCII
@@ -591,14 +679,7 @@ void NodeWiseMeshPartitioner::writeElementsASCII(const std::string& file_name_ba
     std::fstream os_subd(fname, std::ios::out | std::ios::trunc);
     for (const auto& partition : _partitions)
     {
-        // Set the local node indices of the current partition.
-        IntegerType node_local_id_offset = 0;
-        std::vector<IntegerType> nodes_local_ids(_mesh->getNumberOfNodes(), -1);
-        for (const auto* node : partition.nodes)
-        {
-            nodes_local_ids[node->getID()] = node_local_id_offset;
-            node_local_id_offset++;
-        }
+        auto const nodes_local_ids = getLocalNodeIds(partition);
 
         for (const auto* elem : partition.regular_elements)
         {
@@ -643,7 +724,7 @@ void NodeWiseMeshPartitioner::getElementIntegerVariables(
     const MeshLib::Element& elem,
     const std::vector<IntegerType>& local_node_ids,
     std::vector<IntegerType>& elem_info,
-    IntegerType& counter)
+    IntegerType& counter) const
 {
     unsigned mat_id = 0;  // TODO: Material ID to be set from the mesh data
     const IntegerType nn = elem.getNumberOfNodes();
@@ -14,8 +14,8 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
-#include <tuple>
 #include <vector>
 #include <string>
 #include <fstream>
@@ -78,11 +78,28 @@ public:
     /// \param file_name_base The prefix of the file name.
     void writeASCII(const std::string& file_name_base);
 
-    /// Write the partitions into binary files
+    /// Write the partitions into a single binary file, which contains a
+    /// table of the partitions and the data of each partition as one
+    /// contiguous block (see MeshLib::IO::PartitionedMeshFormat).
     /// \param file_name_base The prefix of the file name.
     void writeBinary(const std::string& file_name_base);
 
+    /// Write the partitions into the legacy set of binary files, i.e. one
+    /// file for each of the configuration data, nodes, elements, ghost
+    /// elements, and property vectors of all partitions.
+    /// \param file_name_base The prefix of the file name.
+    void writeLegacyBinary(const std::string& file_name_base);
+
 private:
+    /// Global node ID and coordinates as written to the binary files.
+    struct NodeStruct
+    {
+        IntegerType id;
+        double x;
+        double y;
+        double z;
+    };
+
     /// Number of partitions.
     IntegerType _npartitions;
 
@@ -128,7 +145,27 @@ private:
     void getElementIntegerVariables(const MeshLib::Element& elem,
                                     const std::vector<IntegerType>& local_node_ids,
                                     std::vector<IntegerType>& elem_info,
-                                    IntegerType& counter);
+                                    IntegerType& counter) const;
+
+    /// Get the 14 integers of the configuration data of a partition. The
+    /// offsets, i.e. the entries 10 to 12, are set to zero.
+    std::array<IntegerType, 14> getPartitionConfigData(
+        Partition const& partition) const;
+
+    /// Get the local indices of the nodes of a partition, which are indexed
+    /// by the node IDs of the original mesh. Entries of nodes not belonging to
+    /// the partition are -1.
+    std::vector<IntegerType> getLocalNodeIds(Partition const& partition) const;
+
+    /// Get the integer variables of the given elements, which are the
+    /// starting entries of the definitions of each element followed by the
+    /// definitions themselves.
+    std::vector<IntegerType> getElementIntegers(
+        std::vector<const MeshLib::Element*> const& elements,
+        std::vector<IntegerType> const& local_node_ids) const;
+
+    /// Get the global IDs and the coordinates of the nodes of a partition.
+    std::vector<NodeStruct> getNodeStructs(Partition const& partition) const;
 
     void writePropertiesBinary(std::string const& file_name_base) const;
 
@@ -230,30 +267,55 @@ private:
         return true;
      }
 
-    /*!
-         \brief Write the configuration data of the partition data in
-                binary files.
-         \param file_name_base The prefix of the file name.
-         \return element 1: The numbers of all non-ghost element integer
-                            variables of each partitions.
-                 element 2: The numbers of all ghost element integer
-                            variables of each partitions.
-    */
-    std::tuple<std::vector<IntegerType>, std::vector<IntegerType>>
-    writeConfigDataBinary(const std::string& file_name_base);
+    /// Write the meta data (if out_meta is given) or the values (if out_val
+    /// is given) of the part of the property vector, which belongs to the
+    /// partition starting at the given tuple.
+    template <typename T>
+    bool writePropertyVectorPartBinary(std::string const& name,
+                                       std::size_t const first_tuple,
+                                       std::size_t const number_of_tuples,
+                                       std::ostream* out_val,
+                                       std::ostream* out_meta) const
+    {
+        if (!_partitioned_properties.existsPropertyVector<T>(name))
+            return false;
 
-    /*!
-         \brief Write the element integer variables of all partitions
-                into binary files.
-         \param file_name_base      The prefix of the file name.
-         \param num_elem_integers   The numbers of all non-ghost element
-                                    integer variables of each partitions.
-         \param num_g_elem_integers The numbers of all ghost element
-                                    integer variables of each partitions.
-    */
-    void writeElementsBinary(const std::string& file_name_base,
-                      const std::vector<IntegerType>& num_elem_integers,
-                      const std::vector<IntegerType>& num_g_elem_integers);
+        auto const* pv = _partitioned_properties.getPropertyVector<T>(name);
+        std::size_t const number_of_components = pv->getNumberOfComponents();
+        if (out_meta)
+        {
+            MeshLib::IO::PropertyVectorMetaData pvmd;
+            pvmd.property_name = name;
+            pvmd.fillPropertyVectorMetaDataTypeInfo<T>();
+            pvmd.number_of_components = number_of_components;
+            pvmd.number_of_tuples = number_of_tuples;
+            MeshLib::IO::writePropertyVectorMetaDataBinary(*out_meta, pvmd);
+        }
+        if (out_val && number_of_tuples > 0)
+        {
+            out_val->write(
+                reinterpret_cast<char const*>(
+                    pv->data() + first_tuple * number_of_components),
+                number_of_tuples * number_of_components * sizeof(T));
+        }
+        return true;
+    }
+
+    /// Write the meta data or the values of all property vectors of a
+    /// partition, cf. writePropertyVectorPartBinary().
+    void writePropertiesPartBinary(std::size_t const first_tuple,
+                                   std::size_t const number_of_tuples,
+                                   std::ostream* out_val,
+                                   std::ostream* out_meta) const;
+
+    /// Write the configuration data of the partition data in a binary file.
+    /// \param file_name_base The prefix of the file name.
+    void writeConfigDataBinary(const std::string& file_name_base);
+
+    /// Write the element integer variables of all partitions into binary
+    /// files.
+    /// \param file_name_base The prefix of the file name.
+    void writeElementsBinary(const std::string& file_name_base);
 
     ///  Write the nodes of all partitions into a binary file.
     ///  \param file_name_base The prefix of the file name.
@@ -71,6 +71,14 @@ int main(int argc, char* argv[])
     TCLAP::SwitchArg ascii_flag("a", "ascii", "Enable ASCII output.", false);
     cmd.add(ascii_flag);
 
+    TCLAP::SwitchArg legacy_binary_flag(
+        "l", "legacy_binary",
+        "Write the binary output into separate files for the configuration, "
+        "nodes, elements, ghost elements, and properties instead of a single "
+        "file.",
+        false);
+    cmd.add(legacy_binary_flag);
+
     cmd.parse(argc, argv);
 
     BaseLib::RunTime run_timer;
@@ -129,9 +137,14 @@ int main(int argc, char* argv[])
             INFO("Write the data of partitions into ASCII files ...");
             mesh_partitioner.writeASCII(file_name_base);
         }
-        else
+        else if (legacy_binary_flag.getValue())
         {
             INFO("Write the data of partitions into binary files ...");
+            mesh_partitioner.writeLegacyBinary(file_name_base);
+        }
+        else
+        {
+            INFO("Write the data of partitions into a binary file ...");
             mesh_partitioner.writeBinary(file_name_base);
         }
     }
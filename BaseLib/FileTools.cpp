@@ -56,6 +56,23 @@ void truncateFile( std::string const& filename)
     ofs.close();
 }
 
+bool readFileIntoString(std::string const& file_name, std::string& content)
+{
+    std::ifstream in(file_name.c_str(), std::ios::in | std::ios::binary);
+    if (!in)
+        return false;
+
+    in.seekg(0, std::ios::end);
+    auto const size = in.tellg();
+    if (size < 0)
+        return false;
+    in.seekg(0, std::ios::beg);
+
+    content.resize(static_cast<std::size_t>(size));
+    return content.empty() ||
+           static_cast<bool>(in.read(&content[0], content.size()));
+}
+
 namespace
 {
 
@@ -97,6 +97,15 @@ std::vector<T> readBinaryArray(std::string const& filename, std::size_t const n)
     return std::vector<T>();
 }
 
+/**
+ * \brief Reads the whole content of a file at once.
+ *
+ * \param file_name  the file name
+ * \param content    the string to be filled with the content of the file
+ * \return true on success, false if the file could not be read
+ */
+bool readFileIntoString(std::string const& file_name, std::string& content);
+
 /**
  * \brief truncate a file
  *
@@ -0,0 +1,76 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "FixedSizePool.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace
+{
+std::size_t const chunk_alignment = alignof(std::max_align_t);
+
+/// Number of chunks of the first block.
+std::size_t const initial_block_capacity = 64;
+}  // namespace
+
+namespace BaseLib
+{
+FixedSizePool::FixedSizePool(std::size_t const object_size)
+    : _chunk_size(
+          (std::max(object_size, sizeof(void*)) + chunk_alignment - 1) /
+          chunk_alignment * chunk_alignment)
+{
+}
+
+void* FixedSizePool::allocate()
+{
+    ++_number_of_objects;
+
+    if (_free_list)
+    {
+        void* const p = _free_list;
+        _free_list = *static_cast<void**>(p);
+        return p;
+    }
+
+    if (_block_used == _block_capacity)
+        addBlock();
+
+    return _blocks.back().get() + _chunk_size * _block_used++;
+}
+
+void FixedSizePool::deallocate(void* const p)
+{
+    if (!p)
+        return;
+
+    assert(_number_of_objects > 0);
+    if (--_number_of_objects == 0)
+    {
+        _blocks.clear();
+        _block_capacity = 0;
+        _block_used = 0;
+        _free_list = nullptr;
+        return;
+    }
+
+    *static_cast<void**>(p) = _free_list;
+    _free_list = p;
+}
+
+void FixedSizePool::addBlock()
+{
+    _block_capacity =
+        _blocks.empty() ? initial_block_capacity : 2 * _block_capacity;
+    _blocks.emplace_back(new char[_chunk_size * _block_capacity]);
+    _block_used = 0;
+}
+
+}  // namespace BaseLib
@@ -0,0 +1,66 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace BaseLib
+{
+/// Memory pool for objects of one fixed size.
+///
+/// The objects are placed one after another into large blocks of memory,
+/// where the block sizes grow geometrically. Hence, many objects are allocated
+/// with only a few system allocations and objects allocated in succession are
+/// stored contiguously. Freed chunks are reused by subsequent allocations. All
+/// blocks are released when the last object of the pool has been freed.
+///
+/// The chunks are aligned like the memory returned by the global operator new.
+class FixedSizePool final
+{
+public:
+    explicit FixedSizePool(std::size_t const object_size);
+
+    FixedSizePool(FixedSizePool const&) = delete;
+    FixedSizePool& operator=(FixedSizePool const&) = delete;
+
+    /// Returns uninitialized memory for one object.
+    void* allocate();
+
+    /// Returns the memory of an object obtained by allocate() to the pool.
+    void deallocate(void* const p);
+
+    /// Number of objects currently allocated from the pool.
+    std::size_t getNumberOfObjects() const { return _number_of_objects; }
+
+    /// Number of memory blocks the pool currently holds.
+    std::size_t getNumberOfBlocks() const { return _blocks.size(); }
+
+private:
+    void addBlock();
+
+    /// Object size rounded up to the alignment of the chunks.
+    std::size_t const _chunk_size;
+
+    std::vector<std::unique_ptr<char[]>> _blocks;
+    /// Number of chunks of the last block.
+    std::size_t _block_capacity = 0;
+    /// Number of chunks of the last block which have been handed out at least
+    /// once.
+    std::size_t _block_used = 0;
+
+    /// Singly linked list of freed chunks. The link is stored in the chunk.
+    void* _free_list = nullptr;
+
+    std::size_t _number_of_objects = 0;
+};
+
+}  // namespace BaseLib
@@ -0,0 +1,140 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <exception>
+#include <mutex>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace BaseLib
+{
+/// Returns the maximum number of threads of an OpenMP parallel region, one if
+/// OpenMP is not enabled.
+inline unsigned getMaxNumberOfThreads()
+{
+#ifdef _OPENMP
+    return static_cast<unsigned>(omp_get_max_threads());
+#else
+    return 1;
+#endif
+}
+
+/// Returns the number of the calling thread in the current OpenMP team, zero
+/// outside of parallel regions or if OpenMP is not enabled.
+inline unsigned getThreadNumber()
+{
+#ifdef _OPENMP
+    return static_cast<unsigned>(omp_get_thread_num());
+#else
+    return 0;
+#endif
+}
+
+/// Tells if the calling thread is inside of an active OpenMP parallel region.
+inline bool isInParallelRegion()
+{
+#ifdef _OPENMP
+    return omp_in_parallel() != 0;
+#else
+    return false;
+#endif
+}
+
+/// Holds one instance of \c T for each thread of an OpenMP team, e.g., for
+/// buffers which are modified in const member functions.
+///
+/// The instance of a thread is selected by its thread number. Hence, the
+/// instances must not be accessed from nested parallel regions.
+template <typename T>
+class PerThread final
+{
+public:
+    PerThread() : _values(getMaxNumberOfThreads()) {}
+
+    explicit PerThread(T const& value)
+        : _values(getMaxNumberOfThreads(), value)
+    {
+    }
+
+    /// Returns the instance of the calling thread.
+    T& get()
+    {
+        assert(getThreadNumber() < _values.size());
+        return _values[getThreadNumber()];
+    }
+
+    /// Returns the instance of the calling thread.
+    T const& get() const
+    {
+        assert(getThreadNumber() < _values.size());
+        return _values[getThreadNumber()];
+    }
+
+    /// Iterators over the instances of all threads.
+    typename std::vector<T>::iterator begin() { return _values.begin(); }
+    typename std::vector<T>::iterator end() { return _values.end(); }
+
+private:
+    std::vector<T> _values;
+};
+
+/// Keeps the first exception thrown in the iterations of an OpenMP parallel
+/// loop, to be rethrown by the calling thread after the loop.
+///
+/// An exception must not leave a parallel region; otherwise the program is
+/// terminated. Therefore, e.g., errors raised by OGS_FATAL within the loop body
+/// have to be caught in the same iteration.
+class FirstException final
+{
+public:
+    /// Calls \c f and captures the exception thrown by it, if any. Does not
+    /// call \c f if an exception has been captured already.
+    template <typename Function>
+    void run(Function&& f)
+    {
+        if (_captured.load(std::memory_order_relaxed))
+            return;
+
+        try
+        {
+            f();
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_exception)
+            {
+                _exception = std::current_exception();
+                _captured.store(true, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Rethrows the captured exception, if any. Must be called outside of the
+    /// parallel region.
+    void rethrow() const
+    {
+        if (_exception)
+            std::rethrow_exception(_exception);
+    }
+
+private:
+    std::atomic<bool> _captured{false};
+    std::mutex _mutex;
+    std::exception_ptr _exception;
+};
+
+}  // namespace BaseLib
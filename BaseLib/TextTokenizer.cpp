@@ -0,0 +1,287 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "TextTokenizer.h"
+
+#include <clocale>
+#include <cstdlib>
+#include <cstring>
+#include <locale>
+#include <sstream>
+
+namespace
+{
+bool isWhitespace(char const c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' ||
+           c == '\f';
+}
+
+bool isDigit(char const c)
+{
+    return c >= '0' && c <= '9';
+}
+
+/// Powers of ten, which are exactly representable as doubles.
+double const exact_powers_of_ten[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+}  // namespace
+
+namespace BaseLib
+{
+TextTokenizer::TextTokenizer(char const* begin, char const* end)
+    : _position(begin), _end(end)
+{
+}
+
+TextTokenizer::TextTokenizer(std::string const& text)
+    : TextTokenizer(text.data(), text.data() + text.size())
+{
+}
+
+void TextTokenizer::skipWhitespace()
+{
+    while (_position != _end && isWhitespace(*_position))
+        ++_position;
+}
+
+void TextTokenizer::skipSeparator(char const separator)
+{
+    skipWhitespace();
+    if (_position != _end && *_position == separator)
+        ++_position;
+}
+
+bool TextTokenizer::atEnd()
+{
+    skipWhitespace();
+    return _position == _end;
+}
+
+bool TextTokenizer::readInteger(bool& negative, unsigned long long& magnitude)
+{
+    skipWhitespace();
+    char const* p = _position;
+    negative = false;
+    if (p != _end && (*p == '-' || *p == '+'))
+    {
+        negative = *p == '-';
+        ++p;
+    }
+    if (p == _end || !isDigit(*p))
+        return false;
+
+    unsigned long long const max = std::numeric_limits<unsigned long long>::max();
+    magnitude = 0;
+    for (; p != _end && isDigit(*p); ++p)
+    {
+        unsigned const digit = static_cast<unsigned>(*p - '0');
+        if (magnitude > (max - digit) / 10)
+            return false;
+        magnitude = 10 * magnitude + digit;
+    }
+    _position = p;
+    return true;
+}
+
+bool TextTokenizer::read(double& value)
+{
+    skipWhitespace();
+    char const* p = _position;
+
+    bool negative = false;
+    if (p != _end && (*p == '-' || *p == '+'))
+    {
+        negative = *p == '-';
+        ++p;
+    }
+
+    // Significand, the digits exceeding the range of the integer are only
+    // counted and lead to the conversion by strtod().
+    unsigned long long significand = 0;
+    int number_of_digits = 0;
+    int exponent = 0;
+    bool has_digits = false;
+    for (; p != _end && isDigit(*p); ++p)
+    {
+        has_digits = true;
+        if (significand == 0 && *p == '0')
+            continue;
+        if (number_of_digits < 19)
+            significand = 10 * significand + static_cast<unsigned>(*p - '0');
+        else
+            exponent++;
+        number_of_digits++;
+    }
+    if (p != _end && *p == '.')
+    {
+        ++p;
+        for (; p != _end && isDigit(*p); ++p)
+        {
+            has_digits = true;
+            if (significand == 0 && *p == '0')
+            {
+                exponent--;
+                continue;
+            }
+            if (number_of_digits < 19)
+            {
+                significand =
+                    10 * significand + static_cast<unsigned>(*p - '0');
+                exponent--;
+            }
+            number_of_digits++;
+        }
+    }
+    if (!has_digits)
+        return readWithStrtod(value);  // e.g. inf or nan
+
+    if (p != _end && (*p == 'e' || *p == 'E'))
+    {
+        char const* q = p + 1;
+        bool negative_exponent = false;
+        if (q != _end && (*q == '-' || *q == '+'))
+        {
+            negative_exponent = *q == '-';
+            ++q;
+        }
+        if (q != _end && isDigit(*q))
+        {
+            int explicit_exponent = 0;
+            for (; q != _end && isDigit(*q); ++q)
+            {
+                if (explicit_exponent < 100000)
+                    explicit_exponent =
+                        10 * explicit_exponent + static_cast<int>(*q - '0');
+            }
+            exponent +=
+                negative_exponent ? -explicit_exponent : explicit_exponent;
+            p = q;
+        }
+    }
+
+    if (number_of_digits > 19 ||
+        significand > (1ull << std::numeric_limits<double>::digits) ||
+        exponent < -22 || exponent > 22)
+    {
+        return readWithStrtod(value);
+    }
+
+    double result = static_cast<double>(significand);
+    if (exponent < 0)
+        result /= exact_powers_of_ten[-exponent];
+    else
+        result *= exact_powers_of_ten[exponent];
+    value = negative ? -result : result;
+    _position = p;
+    return true;
+}
+
+bool TextTokenizer::read(float& value)
+{
+    double v;
+    if (!read(v))
+        return false;
+    value = static_cast<float>(v);
+    return true;
+}
+
+bool TextTokenizer::readWithStrtod(double& value)
+{
+    // Copy the token to get a terminated string.
+    char token[128];
+    std::size_t length = 0;
+    for (char const* p = _position;
+         p != _end && !isWhitespace(*p) && *p != ',' &&
+         length < sizeof(token) - 1;
+         ++p)
+    {
+        token[length++] = *p;
+    }
+    token[length] = '\0';
+    if (length == 0)
+        return false;
+
+    // strtod() depends on the C locale, which is not necessarily the
+    // classic one, e.g. in the Qt applications.
+    if (*std::localeconv()->decimal_point == '.')
+    {
+        char* token_end = nullptr;
+        double const v = std::strtod(token, &token_end);
+        if (token_end == token)
+            return false;
+        value = v;
+        _position += token_end - token;
+        return true;
+    }
+
+    std::istringstream is(token);
+    is.imbue(std::locale::classic());
+    double v;
+    if (!(is >> v))
+        return false;
+    value = v;
+    _position += is.eof() ? length : static_cast<std::size_t>(is.tellg());
+    return true;
+}
+
+bool TextTokenizer::readWord(std::string& word)
+{
+    skipWhitespace();
+    char const* const begin = _position;
+    while (_position != _end && !isWhitespace(*_position))
+        ++_position;
+    word.assign(begin, _position);
+    return begin != _position;
+}
+
+bool TextTokenizer::readLine(std::string& line)
+{
+    if (_position == _end)
+        return false;
+    auto const* line_end = static_cast<char const*>(
+        std::memchr(_position, '\n', _end - _position));
+    if (!line_end)
+        line_end = _end;
+    line.assign(_position, line_end);
+    _position = line_end == _end ? _end : line_end + 1;
+    return true;
+}
+
+bool TextTokenizer::skipLine()
+{
+    if (_position == _end)
+        return false;
+    auto const* line_end = static_cast<char const*>(
+        std::memchr(_position, '\n', _end - _position));
+    _position = line_end ? line_end + 1 : _end;
+    return true;
+}
+
+std::vector<char const*> TextTokenizer::splitLines(
+    std::size_t const number_of_lines)
+{
+    std::vector<char const*> line_beginnings;
+    line_beginnings.reserve(number_of_lines + 1);
+    while (line_beginnings.size() < number_of_lines)
+    {
+        // Empty lines are skipped.
+        skipWhitespace();
+        if (_position == _end)
+            break;
+        line_beginnings.push_back(_position);
+        skipLine();
+    }
+    if (line_beginnings.size() == number_of_lines)
+        line_beginnings.push_back(_position);
+    return line_beginnings;
+}
+
+}  // namespace BaseLib
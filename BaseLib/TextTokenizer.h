@@ -0,0 +1,133 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace BaseLib
+{
+/**
+ * \brief Reads numbers, words and lines from a character buffer.
+ *
+ * The tokenizer is a replacement for reading text files with
+ * <tt>operator>></tt> of streams in the mesh importers. It works on a buffer,
+ * which usually holds the whole file, and parses numbers directly from the
+ * characters without any locale handling or copying. As for streams, leading
+ * whitespace including line breaks is skipped before a number or a word.
+ *
+ * Integers are converted exactly. Floating point numbers whose decimal
+ * significand is below \f$2^{53}\f$ and whose decimal exponent is at most 22
+ * in magnitude are composed with a single rounding, which is exact, too; all
+ * other numbers are converted by strtod().
+ *
+ * The buffer is not copied and has to outlive the tokenizer.
+ */
+class TextTokenizer final
+{
+public:
+    /// Tokenizes the characters in the range [begin, end).
+    TextTokenizer(char const* begin, char const* end);
+
+    /// Tokenizes the content of the given string.
+    explicit TextTokenizer(std::string const& text);
+
+    /// Reads a signed or unsigned integer. Negative values are rejected for
+    /// unsigned types, as well as values exceeding the range of the type.
+    /// \return False if no integer could be read; the position is unchanged
+    /// then.
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value, bool>::type read(
+        T& value)
+    {
+        bool negative = false;
+        unsigned long long magnitude = 0;
+        char const* const position = _position;
+        if (!readInteger(negative, magnitude))
+            return false;
+
+        if (negative)
+        {
+            if (!std::is_signed<T>::value ||
+                magnitude > static_cast<unsigned long long>(
+                                std::numeric_limits<T>::max()) +
+                                1)
+            {
+                _position = position;
+                return false;
+            }
+            value = static_cast<T>(-static_cast<long long>(magnitude - 1) - 1);
+            return true;
+        }
+        if (magnitude > static_cast<unsigned long long>(
+                            std::numeric_limits<T>::max()))
+        {
+            _position = position;
+            return false;
+        }
+        value = static_cast<T>(magnitude);
+        return true;
+    }
+
+    /// Reads a floating point number.
+    /// \return False if no number could be read; the position is unchanged
+    /// then.
+    bool read(double& value);
+
+    /// Reads a floating point number, see read(double&).
+    bool read(float& value);
+
+    /// Reads a sequence of non-whitespace characters.
+    bool readWord(std::string& word);
+
+    /// Reads the rest of the current line without the line break, and moves
+    /// to the beginning of the next line.
+    /// \return False if the end of the buffer was already reached.
+    bool readLine(std::string& line);
+
+    /// Moves to the beginning of the next line.
+    /// \return False if the end of the buffer was already reached.
+    bool skipLine();
+
+    /// Skips whitespace and, if present, a single given separator character
+    /// like the commas between the values of FEFLOW files.
+    void skipSeparator(char const separator);
+
+    /// Skips whitespace including line breaks.
+    void skipWhitespace();
+
+    /// Returns true if only whitespace is left in the buffer.
+    bool atEnd();
+
+    /// Returns the beginnings of the next number_of_lines non-empty lines and
+    /// as last entry the end of the last of these lines, and moves behind
+    /// them. Each of the lines can be parsed independently, in particular
+    /// concurrently, by a TextTokenizer constructed from two consecutive
+    /// entries.
+    /// \return The line beginnings, which are fewer than number_of_lines + 1
+    /// if the end of the buffer is reached before.
+    std::vector<char const*> splitLines(std::size_t const number_of_lines);
+
+    /// Current position in the buffer.
+    char const* getPosition() const { return _position; }
+
+private:
+    bool readInteger(bool& negative, unsigned long long& magnitude);
+
+    /// Parses a floating point number with the slow but exact strtod().
+    bool readWithStrtod(double& value);
+
+    char const* _position;
+    char const* const _end;
+};
+
+}  // namespace BaseLib
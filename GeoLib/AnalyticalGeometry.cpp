@@ -15,6 +15,7 @@
 #include "AnalyticalGeometry.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <limits>
 
@@ -22,6 +23,7 @@
 
 #include "BaseLib/StringTools.h"
 
+#include "BucketGrid.h"
 #include "Polyline.h"
 #include "PointVec.h"
 
@@ -41,6 +43,122 @@ double getOrientation2d(MathLib::Point3d const& a,
 }
 }
 
+namespace
+{
+/// Axis aligned box of a line segment enlarged by a margin covering the
+/// tolerances of GeoLib::lineSegmentIntersect(): the parameters of the closest
+/// points are accepted slightly outside of [0,1] and the closest points may
+/// have a distance of up to 1e-6 times the length of the shorter segment.
+struct SegmentBox
+{
+    explicit SegmentBox(GeoLib::LineSegment const& s)
+    {
+        GeoLib::Point const& a(s.getBeginPoint());
+        GeoLib::Point const& b(s.getEndPoint());
+        double max_abs_coordinate(0.0);
+        for (std::size_t d(0); d < 3; ++d)
+            max_abs_coordinate = std::max(
+                {max_abs_coordinate, std::abs(a[d]), std::abs(b[d])});
+        double const margin(1e-5 * std::sqrt(MathLib::sqrDist(a, b)) + 1e-7 +
+                            1e-10 * max_abs_coordinate);
+        for (std::size_t d(0); d < 3; ++d)
+        {
+            min[d] = std::min(a[d], b[d]) - margin;
+            max[d] = std::max(a[d], b[d]) + margin;
+        }
+    }
+
+    bool overlaps(SegmentBox const& other) const
+    {
+        for (std::size_t d(0); d < 3; ++d)
+        {
+            if (max[d] < other.min[d] || other.max[d] < min[d])
+                return false;
+        }
+        return true;
+    }
+
+    std::array<double, 3> min;
+    std::array<double, 3> max;
+};
+
+/// Uniform grid in the plane of the two largest extensions of the segment
+/// boxes. Each segment is stored in all cells its box intersects.
+class SegmentGrid
+{
+public:
+    explicit SegmentGrid(std::vector<SegmentBox> const& boxes)
+        : _grid(createGrid(boxes))
+    {
+    }
+
+    /// Calls f(j) for each segment j > i stored in a common cell with segment
+    /// i. Each j is reported once: only in the first common cell.
+    template <typename F>
+    void forEachCandidate(std::size_t const i, F const& f) const
+    {
+        auto const& r(_grid.getCellRange(i));
+        GeoLib::BucketGrid::forEachCell(
+            r, [&](std::size_t const c0, std::size_t const c1) {
+                _grid.forEachItem(c0, c1, [&](std::size_t const j) {
+                    if (j <= i)
+                        return;
+                    auto const& rj(_grid.getCellRange(j));
+                    if (c0 == std::max(r[0], rj[0]) &&
+                        c1 == std::max(r[1], rj[1]))
+                        f(j);
+                });
+            });
+    }
+
+private:
+    static GeoLib::BucketGrid createGrid(std::vector<SegmentBox> const& boxes)
+    {
+        std::array<double, 3> min, max;
+        min.fill(std::numeric_limits<double>::max());
+        max.fill(std::numeric_limits<double>::lowest());
+        for (auto const& box : boxes)
+        {
+            for (std::size_t d(0); d < 3; ++d)
+            {
+                min[d] = std::min(min[d], box.min[d]);
+                max[d] = std::max(max[d], box.max[d]);
+            }
+        }
+        std::array<std::size_t, 3> dims{{0, 1, 2}};
+        std::sort(dims.begin(), dims.end(),
+                  [&min, &max](std::size_t d0, std::size_t d1) {
+                      return max[d0] - min[d0] > max[d1] - min[d1];
+                  });
+        std::array<double, 2> const extension{
+            {max[dims[0]] - min[dims[0]], max[dims[1]] - min[dims[1]]}};
+
+        // About one cell per segment, the cells are approximately squares.
+        double const n(
+            static_cast<double>(std::max<std::size_t>(boxes.size(), 1)));
+        std::array<std::size_t, 2> number_of_cells{
+            {static_cast<std::size_t>(n), 1}};
+        if (extension[1] > 0.0)
+        {
+            double const ratio(extension[0] / extension[1]);
+            number_of_cells[0] = static_cast<std::size_t>(
+                std::ceil(std::min(std::sqrt(n * ratio), n)));
+            number_of_cells[1] = static_cast<std::size_t>(
+                std::ceil(std::min(std::sqrt(n / ratio), n)));
+        }
+
+        std::vector<GeoLib::BucketGrid::Box> grid_boxes;
+        grid_boxes.reserve(boxes.size());
+        for (auto const& box : boxes)
+            grid_boxes.push_back({{box.min[dims[0]], box.min[dims[1]],
+                                   box.max[dims[0]], box.max[dims[1]]}});
+        return GeoLib::BucketGrid(grid_boxes, number_of_cells);
+    }
+
+    GeoLib::BucketGrid const _grid;
+};
+}  // namespace
+
 namespace GeoLib
 {
 Orientation getOrientation(const double& p0_x, const double& p0_y, const double& p1_x,
@@ -217,23 +335,71 @@ bool lineSegmentsIntersect(const GeoLib::Polyline* ply,
                            GeoLib::Point& intersection_pnt)
 {
     std::size_t const n_segs(ply->getNumberOfSegments());
+    std::vector<GeoLib::LineSegment> segments;
+    segments.reserve(n_segs);
+    for (auto const& segment : *ply)
+        segments.push_back(segment);
+
     // Neighbouring segments always intersects at a common vertex. The algorithm
-    // checks for intersections of non-neighbouring segments.
-    for (seg_it0 = ply->begin(); seg_it0 != ply->end() - 2; ++seg_it0)
+    // checks for intersections of non-neighbouring segments. The first and the
+    // last segment are neighboured, too.
+    auto const intersections(computeSegmentIntersections(
+        segments, [n_segs](std::size_t const i, std::size_t const j) {
+            return j > i + 1 && !(i == 0 && j == n_segs - 1);
+        }));
+    if (intersections.empty())
+        return false;
+
+    // The intersections are sorted, i.e., the first one is the same as found
+    // by testing the pairs of segments in lexicographical order.
+    auto const& intersection(intersections.front());
+    using Diff = std::vector<GeoLib::Point>::difference_type;
+    seg_it0 = ply->begin() + static_cast<Diff>(intersection.first_segment);
+    seg_it1 = ply->begin() + static_cast<Diff>(intersection.second_segment);
+    intersection_pnt = intersection.point;
+    return true;
+}
+
+std::vector<SegmentIntersection> computeSegmentIntersections(
+    std::vector<GeoLib::LineSegment> const& segments,
+    std::function<bool(std::size_t, std::size_t)> const& is_pair_tested)
+{
+    if (segments.size() < 2)
+        return {};
+
+    std::vector<SegmentBox> boxes;
+    boxes.reserve(segments.size());
+    for (auto const& segment : segments)
+        boxes.emplace_back(segment);
+    SegmentGrid const grid(boxes);
+
+    std::vector<std::vector<SegmentIntersection>> intersections_of_segment(
+        segments.size());
+    OPENMP_LOOP_TYPE const n_segments = segments.size();
+#pragma omp parallel for schedule(dynamic, 64)
+    for (OPENMP_LOOP_TYPE k = 0; k < n_segments; ++k)
     {
-        seg_it1 = seg_it0+2;
-        std::size_t const seg_num_0 = seg_it0.getSegmentNumber();
-        for ( ; seg_it1 != ply->end(); ++seg_it1) {
-            // Do not check first and last segment, because they are
-            // neighboured.
-            if (!(seg_num_0 == 0 && seg_it1.getSegmentNumber() == n_segs - 1)) {
-                if (lineSegmentIntersect(*seg_it0, *seg_it1, intersection_pnt)) {
-                    return true;
-                }
-            }
-        }
+        std::size_t const i(k);
+        auto& intersections(intersections_of_segment[i]);
+        grid.forEachCandidate(i, [&](std::size_t const j) {
+            if (!boxes[i].overlaps(boxes[j]) || !is_pair_tested(i, j))
+                return;
+            GeoLib::Point s;
+            if (lineSegmentIntersect(segments[i], segments[j], s))
+                intersections.push_back({i, j, s});
+        });
+        std::sort(intersections.begin(), intersections.end(),
+                  [](SegmentIntersection const& a, SegmentIntersection const& b) {
+                      return a.second_segment < b.second_segment;
+                  });
     }
-    return false;
+
+    std::vector<SegmentIntersection> intersections;
+    for (auto const& intersections_of_segment_i : intersections_of_segment)
+        intersections.insert(intersections.end(),
+                             intersections_of_segment_i.begin(),
+                             intersections_of_segment_i.end());
+    return intersections;
 }
 
 void computeRotationMatrixToXZ(MathLib::Vector3 const& plane_normal, MathLib::DenseMatrix<double> & rot_mat)
@@ -319,32 +485,66 @@ std::unique_ptr<GeoLib::Point> triangleLineIntersection(
 void computeAndInsertAllIntersectionPoints(GeoLib::PointVec &pnt_vec,
     std::vector<GeoLib::Polyline*> & plys)
 {
-    auto computeSegmentIntersections = [&pnt_vec](GeoLib::Polyline& poly0,
-                                                  GeoLib::Polyline& poly1)
+    std::vector<GeoLib::LineSegment> segments;
+    std::vector<std::size_t> polyline_ids;
+    std::vector<std::size_t> segment_numbers;
+    for (std::size_t p(0); p < plys.size(); ++p)
     {
-        for (auto seg0_it(poly0.begin()); seg0_it != poly0.end(); ++seg0_it)
+        for (auto seg_it(plys[p]->begin()); seg_it != plys[p]->end(); ++seg_it)
         {
-            for (auto seg1_it(poly1.begin()); seg1_it != poly1.end(); ++seg1_it)
-            {
-                GeoLib::Point s(0.0, 0.0, 0.0, pnt_vec.size());
-                if (lineSegmentIntersect(*seg0_it, *seg1_it, s))
-                {
-                    std::size_t const id(
-                        pnt_vec.push_back(new GeoLib::Point(s)));
-                    poly0.insertPoint(seg0_it.getSegmentNumber() + 1, id);
-                    poly1.insertPoint(seg1_it.getSegmentNumber() + 1, id);
-                }
-            }
+            segments.push_back(*seg_it);
+            polyline_ids.push_back(p);
+            segment_numbers.push_back(seg_it.getSegmentNumber());
         }
-    };
+    }
 
-    for (auto it0(plys.begin()); it0 != plys.end(); ++it0) {
-        auto it1(it0);
-        ++it1;
-        for (; it1 != plys.end(); ++it1) {
-            computeSegmentIntersections(*(*it0), *(*it1));
+    auto intersections(computeSegmentIntersections(
+        segments, [&polyline_ids](std::size_t const i, std::size_t const j) {
+            return polyline_ids[i] != polyline_ids[j];
+        }));
+    // Add the intersection points in the same order as testing the segments
+    // of each pair of polylines.
+    std::stable_sort(
+        intersections.begin(), intersections.end(),
+        [&polyline_ids](SegmentIntersection const& a,
+                        SegmentIntersection const& b) {
+            return std::make_pair(polyline_ids[a.first_segment],
+                                  polyline_ids[a.second_segment]) <
+                   std::make_pair(polyline_ids[b.first_segment],
+                                  polyline_ids[b.second_segment]);
+        });
+
+    // for each segment the squared distances of the intersection points to
+    // the begin point of the segment and the ids of the intersection points
+    std::vector<std::vector<std::pair<double, std::size_t>>> segment_pnts(
+        segments.size());
+    for (auto const& intersection : intersections)
+    {
+        std::size_t const id(
+            pnt_vec.push_back(new GeoLib::Point(intersection.point)));
+        for (std::size_t const k :
+             {intersection.first_segment, intersection.second_segment})
+        {
+            segment_pnts[k].emplace_back(
+                MathLib::sqrDist(segments[k].getBeginPoint(),
+                                 intersection.point),
+                id);
         }
     }
+
+    // Insert the points starting with the last segment, such that the segment
+    // numbers of the not yet processed segments remain valid. Within a segment
+    // the points are inserted with decreasing distance to the begin point at
+    // the same position. Polyline::insertPoint() rejects ids that are already
+    // adjacent, e.g. intersections at vertices.
+    for (std::size_t k(segments.size()); k > 0; --k)
+    {
+        auto& pnts(segment_pnts[k - 1]);
+        std::sort(pnts.rbegin(), pnts.rend());
+        for (auto const& pnt : pnts)
+            plys[polyline_ids[k - 1]]->insertPoint(segment_numbers[k - 1] + 1,
+                                                   pnt.second);
+    }
 }
 
 GeoLib::Polygon rotatePolygonToXY(GeoLib::Polygon const& polygon_in,
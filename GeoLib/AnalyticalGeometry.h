@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <vector>
 
 #include "MathLib/LinAlg/Dense/DenseMatrix.h"
 #include "MathLib/Vector3.h"
@@ -214,6 +216,29 @@ bool lineSegmentIntersect(GeoLib::LineSegment const& s0,
 std::vector<MathLib::Point3d> lineSegmentIntersect2d(
     GeoLib::LineSegment const& ab, GeoLib::LineSegment const& cd);
 
+/// Intersection of two line segments given by their indices within a vector
+/// of line segments, see computeSegmentIntersections().
+struct SegmentIntersection
+{
+    std::size_t first_segment;
+    std::size_t second_segment;
+    GeoLib::Point point;
+};
+
+/// Computes the intersections of the pairs of line segments that are accepted
+/// by the predicate. Instead of testing all pairs, the bounding boxes of the
+/// segments (enlarged by the tolerances of lineSegmentIntersect()) are sorted
+/// into the cells of a uniform grid. Only pairs with overlapping boxes sharing
+/// a grid cell are tested, concurrently, by lineSegmentIntersect() called with
+/// the segment of the lower index as first argument.
+/// @param segments the line segments
+/// @param is_pair_tested predicate called with two segment indices \f$i<j\f$,
+/// it has to be safe to call it concurrently
+/// @return the intersections sorted lexicographically by the segment indices
+std::vector<SegmentIntersection> computeSegmentIntersections(
+    std::vector<GeoLib::LineSegment> const& segments,
+    std::function<bool(std::size_t, std::size_t)> const& is_pair_tested);
+
 /**
  * Calculates the intersection points of a line PQ and a triangle ABC.
  * This method requires ABC to be counterclockwise and PQ to point downward.
@@ -0,0 +1,91 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "BucketGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace GeoLib
+{
+BucketGrid::BucketGrid(std::vector<Box> const& boxes,
+                       std::array<std::size_t, 2> const& number_of_cells)
+    : _number_of_cells(number_of_cells)
+{
+    std::array<double, 2> extension;
+    for (std::size_t k(0); k < 2; ++k)
+    {
+        _min[k] = std::numeric_limits<double>::max();
+        double max(std::numeric_limits<double>::lowest());
+        for (auto const& box : boxes)
+        {
+            _min[k] = std::min(_min[k], box[k]);
+            max = std::max(max, box[k + 2]);
+        }
+        extension[k] = boxes.empty() ? 0.0 : max - _min[k];
+        _number_of_cells[k] = std::max<std::size_t>(_number_of_cells[k], 1);
+    }
+
+    _ranges.resize(boxes.size());
+    while (true)
+    {
+        for (std::size_t k(0); k < 2; ++k)
+            _inverse_cell_size[k] = (extension[k] > 0.0)
+                                        ? _number_of_cells[k] / extension[k]
+                                        : 0.0;
+        std::size_t n_entries(0);
+        for (std::size_t i(0); i < boxes.size(); ++i)
+        {
+            _ranges[i] = computeCellRange(boxes[i]);
+            n_entries += (_ranges[i][2] - _ranges[i][0] + 1) *
+                         (_ranges[i][3] - _ranges[i][1] + 1);
+        }
+        if (n_entries <= 8 * boxes.size() ||
+            (_number_of_cells[0] == 1 && _number_of_cells[1] == 1))
+            break;
+        for (auto& n_cells : _number_of_cells)
+            n_cells = std::max<std::size_t>(n_cells / 2, 1);
+    }
+
+    // Counting sort of the items into the cells.
+    _cell_offsets.assign(_number_of_cells[0] * _number_of_cells[1] + 1, 0);
+    for (auto const& range : _ranges)
+        forEachCell(range, [this](std::size_t const c0, std::size_t const c1) {
+            _cell_offsets[getCellIndex(c0, c1) + 1]++;
+        });
+    std::partial_sum(_cell_offsets.begin(), _cell_offsets.end(),
+                     _cell_offsets.begin());
+    _item_ids.resize(_cell_offsets.back());
+    std::vector<std::size_t> position(_cell_offsets.begin(),
+                                      _cell_offsets.end() - 1);
+    for (std::size_t i(0); i < _ranges.size(); ++i)
+        forEachCell(_ranges[i],
+                    [this, i, &position](std::size_t const c0,
+                                         std::size_t const c1) {
+                        _item_ids[position[getCellIndex(c0, c1)]++] = i;
+                    });
+}
+
+std::size_t BucketGrid::getCell(double const x, std::size_t const k) const
+{
+    double const c = std::floor((x - _min[k]) * _inverse_cell_size[k]);
+    if (!(c > 0))
+        return 0;
+    return std::min(static_cast<std::size_t>(c), _number_of_cells[k] - 1);
+}
+
+BucketGrid::CellRange BucketGrid::computeCellRange(Box const& box) const
+{
+    return {{getCell(box[0], 0), getCell(box[1], 1), getCell(box[2], 0),
+             getCell(box[3], 1)}};
+}
+
+}  // end namespace GeoLib
@@ -0,0 +1,92 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace GeoLib
+{
+/**
+ * \ingroup GeoLib
+ *
+ * \brief Uniform grid of cells in two coordinates, into which items given by
+ * axis aligned boxes are sorted.
+ *
+ * Each item is stored in all cells its box intersects. The coordinates are
+ * chosen by the user, e.g., the two largest extensions of a set of line
+ * segments, or a constant and the y-coordinate for a partition into slabs.
+ *
+ * Starting from the given number of cells, the resolution is halved until
+ * the items are stored in at most eight cells on average, which bounds the
+ * memory for long items.
+ */
+class BucketGrid final
+{
+public:
+    /// Box of an item given by (min_0, min_1, max_0, max_1).
+    using Box = std::array<double, 4>;
+    /// Range of cells given by (min_0, min_1, max_0, max_1).
+    using CellRange = std::array<std::size_t, 4>;
+
+    BucketGrid(std::vector<Box> const& boxes,
+               std::array<std::size_t, 2> const& number_of_cells);
+
+    /// Returns the cell containing the coordinate \c x in direction \c k.
+    /// The computation is monotone in \c x, i.e., a coordinate within the
+    /// extension of a box is mapped into the cell range of the box.
+    std::size_t getCell(double x, std::size_t k) const;
+
+    /// Returns the cells intersected by the box of item \c i.
+    CellRange const& getCellRange(std::size_t const i) const
+    {
+        return _ranges[i];
+    }
+
+    /// Calls f(c0, c1) for each cell of the range.
+    template <typename F>
+    static void forEachCell(CellRange const& range, F const& f)
+    {
+        for (std::size_t c1(range[1]); c1 <= range[3]; ++c1)
+            for (std::size_t c0(range[0]); c0 <= range[2]; ++c0)
+                f(c0, c1);
+    }
+
+    /// Calls f(i) for each item i stored in the cell (c0, c1).
+    template <typename F>
+    void forEachItem(std::size_t const c0, std::size_t const c1,
+                     F const& f) const
+    {
+        std::size_t const cell(getCellIndex(c0, c1));
+        for (std::size_t e(_cell_offsets[cell]); e < _cell_offsets[cell + 1];
+             ++e)
+            f(_item_ids[e]);
+    }
+
+private:
+    CellRange computeCellRange(Box const& box) const;
+
+    std::size_t getCellIndex(std::size_t const c0, std::size_t const c1) const
+    {
+        return c1 * _number_of_cells[0] + c0;
+    }
+
+    std::array<double, 2> _min;
+    std::array<double, 2> _inverse_cell_size;
+    std::array<std::size_t, 2> _number_of_cells;
+    std::vector<CellRange> _ranges;
+    /// The item ids of cell k are stored in the range
+    /// [_cell_offsets[k], _cell_offsets[k+1]) of _item_ids.
+    std::vector<std::size_t> _cell_offsets;
+    std::vector<std::size_t> _item_ids;
+};
+
+}  // end namespace GeoLib
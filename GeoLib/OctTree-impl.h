@@ -62,12 +62,17 @@ OctTree<POINT, MAX_POINTS>::~OctTree()
 template <typename POINT, std::size_t MAX_POINTS>
 bool OctTree<POINT, MAX_POINTS>::addPoint(POINT * pnt, POINT *& ret_pnt)
 {
-    // first do a range query using a epsilon box around the point pnt
+    // first do a range query using a epsilon box around the point pnt; the
+    // upper bound of the half-open range is moved to the next representable
+    // value, since pnt + eps equals pnt if eps is smaller than the spacing of
+    // the floating point numbers at pnt
     std::vector<POINT*> query_pnts;
     MathLib::Point3d min(
         std::array<double,3>{{(*pnt)[0]-_eps, (*pnt)[1]-_eps, (*pnt)[2]-_eps}});
-    MathLib::Point3d max(
-        std::array<double,3>{{(*pnt)[0]+_eps, (*pnt)[1]+_eps, (*pnt)[2]+_eps}});
+    MathLib::Point3d max;
+    for (std::size_t k(0); k < 3; ++k)
+        max[k] = std::nextafter((*pnt)[k] + _eps,
+                                std::numeric_limits<double>::max());
     getPointsInRange(min, max, query_pnts);
     if (! query_pnts.empty()) {
         // check Euclidean norm
@@ -14,7 +14,9 @@
 
 #pragma once
 
+#include <cmath>
 #include <cstdint>
+#include <limits>
 
 #include "MathLib/Point3d.h"
 #include "MathLib/MathTools.h"
@@ -12,14 +12,46 @@
  *
  */
 
+#include <algorithm>
 #include <numeric>
 
 #include <logog/include/logog.hpp>
 
 #include "PointVec.h"
 
+#include "Grid.h"
+
 #include "MathLib/MathTools.h"
 
+namespace
+{
+/// Returns the smallest id of the points stored in the grid that is less than
+/// the id of the given point, whose distance to the given point is at most
+/// eps and for which is_candidate returns true. The maximal std::size_t value
+/// is returned if there is no such point.
+template <typename Predicate>
+std::size_t findClosePointWithLowerID(GeoLib::Grid<GeoLib::Point> const& grid,
+                                      GeoLib::Point const& pnt,
+                                      double const eps,
+                                      Predicate const& is_candidate)
+{
+    std::size_t close_pnt_id = std::numeric_limits<std::size_t>::max();
+    for (auto const* cell : grid.getPntVecsOfGridCellsIntersectingCube(pnt, eps))
+    {
+        for (auto const* p : *cell)
+        {
+            std::size_t const id = p->getID();
+            if (id < pnt.getID() && id < close_pnt_id && is_candidate(id) &&
+                MathLib::sqrDist(*p, pnt) <= eps * eps)
+            {
+                close_pnt_id = id;
+            }
+        }
+    }
+    return close_pnt_id;
+}
+}  // namespace
+
 namespace GeoLib
 {
 PointVec::PointVec(const std::string& name,
@@ -37,70 +69,69 @@ PointVec::PointVec(const std::string& name,
     assert(_data_vec);
     std::size_t const number_of_all_input_pnts(_data_vec->size());
 
-    // correct the ids if necessary
-    for (std::size_t k(0); k < _data_vec->size(); ++k)
+    // the ids are the positions of the points within the input vector during
+    // the search for the identical points
+    for (std::size_t k(0); k < number_of_all_input_pnts; ++k)
+        (*_data_vec)[k]->setID(k);
+
+    // For each point the point with the smallest lower id within the rel_eps
+    // environment is searched concurrently.
+    GeoLib::Grid<GeoLib::Point> const grid(_data_vec->begin(),
+                                           _data_vec->end(), 16);
+    std::vector<std::size_t> close_pnt_ids(number_of_all_input_pnts);
+    OPENMP_LOOP_TYPE const n_pnts = number_of_all_input_pnts;
+#pragma omp parallel for
+    for (OPENMP_LOOP_TYPE k = 0; k < n_pnts; ++k)
     {
-        if ((*_data_vec)[k]->getID() == std::numeric_limits<std::size_t>::max())
-        {
-            (*_data_vec)[k]->setID(k);
-        }
+        close_pnt_ids[k] = findClosePointWithLowerID(
+            grid, *(*_data_vec)[k], _rel_eps, [](std::size_t) { return true; });
     }
 
-    std::vector<std::size_t> rm_pos;
-    // add all points in the oct tree in order to make them unique
+    // A point is removed if there is a close point with a lower id that is
+    // kept. This is the same result as inserting the points one after another
+    // into the oct tree.
     _pnt_id_map.resize(number_of_all_input_pnts);
-    std::iota(_pnt_id_map.begin(), _pnt_id_map.end(), 0);
-    GeoLib::Point* ret_pnt(nullptr);
-    for (std::size_t k(0); k < _data_vec->size(); ++k)
+    std::vector<bool> is_kept(number_of_all_input_pnts, false);
+    std::size_t number_of_kept_pnts(0);
+    for (std::size_t k(0); k < number_of_all_input_pnts; ++k)
     {
-        GeoLib::Point* const pnt((*_data_vec)[k]);
-        if (!_oct_tree->addPoint(pnt, ret_pnt))
+        std::size_t close_pnt_id = close_pnt_ids[k];
+        // The closest point was removed itself. There might be another close
+        // kept point.
+        if (close_pnt_id != std::numeric_limits<std::size_t>::max() &&
+            !is_kept[close_pnt_id])
         {
-            assert(ret_pnt != nullptr);
-            _pnt_id_map[pnt->getID()] = ret_pnt->getID();
-            rm_pos.push_back(k);
-            delete (*_data_vec)[k];
-            (*_data_vec)[k] = nullptr;
+            close_pnt_id = findClosePointWithLowerID(
+                grid, *(*_data_vec)[k], _rel_eps,
+                [&is_kept](std::size_t const id) { return is_kept[id]; });
         }
-        else
+
+        if (close_pnt_id == std::numeric_limits<std::size_t>::max())
         {
-            _pnt_id_map[k] = pnt->getID();
+            is_kept[k] = true;
+            _pnt_id_map[k] = number_of_kept_pnts++;
         }
-    }
-
-    auto const data_vec_end =
-        std::remove(_data_vec->begin(), _data_vec->end(), nullptr);
-    _data_vec->erase(data_vec_end, _data_vec->end());
-
-    // decrement the ids according to the number of removed points (==k) before
-    // the j-th point (positions of removed points are stored in the vector
-    // rm_pos)
-    for (std::size_t k(1); k < rm_pos.size(); ++k)
-    {
-        // decrement the ids in the interval [rm_pos[k-1]+1, rm_pos[k])
-        for (std::size_t j(rm_pos[k - 1] + 1); j < rm_pos[k]; ++j)
+        else
         {
-            _pnt_id_map[j] -= k;
+            _pnt_id_map[k] = _pnt_id_map[close_pnt_id];
         }
     }
-    // decrement the ids from rm_pos.back()+1 until the end of _pnt_id_map
-    if (!rm_pos.empty())
+
+    // remove the identical points and insert the others into the oct tree
+    GeoLib::Point* ret_pnt(nullptr);
+    for (std::size_t k(0); k < number_of_all_input_pnts; ++k)
     {
-        for (std::size_t j(rm_pos.back() + 1); j < _pnt_id_map.size(); ++j)
+        if (is_kept[k])
         {
-            _pnt_id_map[j] -= rm_pos.size();
+            _oct_tree->addPoint((*_data_vec)[k], ret_pnt);
+            continue;
         }
+        delete (*_data_vec)[k];
+        (*_data_vec)[k] = nullptr;
     }
-    // decrement the ids within the _pnt_id_map at positions of the removed
-    // points
-    for (std::size_t k(1); k < rm_pos.size(); ++k)
-    {
-        std::size_t cnt(0);
-        for (cnt = 0;
-             cnt < rm_pos.size() && _pnt_id_map[rm_pos[k]] > rm_pos[cnt];)
-            cnt++;
-        _pnt_id_map[rm_pos[k]] -= cnt;
-    }
+    auto const data_vec_end =
+        std::remove(_data_vec->begin(), _data_vec->end(), nullptr);
+    _data_vec->erase(data_vec_end, _data_vec->end());
 
     // set value of the point id to the position of the point within _data_vec
     for (std::size_t k(0); k < _data_vec->size(); ++k)
@@ -158,6 +189,9 @@ std::size_t PointVec::uniqueInsert(Point* pnt)
     GeoLib::Point* ret_pnt(nullptr);
     if (_oct_tree->addPoint(pnt, ret_pnt))
     {
+        // the domain of the OctTree might be larger than the axis aligned
+        // bounding box
+        _aabb.update(*pnt);
         // set value of the point id to the position of the point within
         // _data_vec
         pnt->setID(_data_vec->size());
@@ -170,9 +204,21 @@ std::size_t PointVec::uniqueInsert(Point* pnt)
     {
         // update the axis aligned bounding box
         _aabb.update(*pnt);
-        // recreate the (enlarged) OctTree
+        // Recreate the OctTree. Its domain is enlarged by half of the largest
+        // extension of the bounding box in each direction, such that the
+        // number of rebuilds grows only logarithmically with the extension
+        // of an incrementally growing point set.
+        MathLib::Point3d ll(_aabb.getMinPoint());
+        MathLib::Point3d ur(_aabb.getMaxPoint());
+        double const margin =
+            std::max({ur[0] - ll[0], ur[1] - ll[1], ur[2] - ll[2]}) / 2;
+        for (std::size_t k(0); k < 3; ++k)
+        {
+            ll[k] -= margin;
+            ur[k] += margin;
+        }
         _oct_tree.reset(GeoLib::OctTree<GeoLib::Point, 16>::createOctTree(
-            _aabb.getMinPoint(), _aabb.getMaxPoint(), _rel_eps));
+            ll, ur, _rel_eps));
         // add all points that are already in the _data_vec
         for (std::size_t k(0); k < _data_vec->size(); ++k)
         {
@@ -238,6 +284,11 @@ void PointVec::correctNameIDMapping()
     }
 }
 
+const GeoLib::AABB& PointVec::getAABB() const
+{
+    return _aabb;
+}
+
 std::string const& PointVec::getItemNameByID(std::size_t id) const
 {
     return _id_to_name_map[id];
@@ -14,6 +14,8 @@
 
 #include "Polygon.h"
 
+#include <algorithm>
+
 #include <logog/include/logog.hpp>
 #include <boost/math/constants/constants.hpp>
 
@@ -135,10 +137,38 @@ std::vector<GeoLib::Point> Polygon::getAllIntersectionPoints(
     return intersections;
 }
 
+std::vector<std::vector<GeoLib::Point>> Polygon::getAllIntersectionPoints(
+    Polyline const& ply) const
+{
+    std::vector<GeoLib::LineSegment> segments;
+    for (auto const& segment : *this)
+        segments.push_back(segment);
+    std::size_t const n_polygon_segments(segments.size());
+    for (auto const& segment : ply)
+        segments.push_back(segment);
+
+    auto const segment_intersections(GeoLib::computeSegmentIntersections(
+        segments,
+        [n_polygon_segments](std::size_t const i, std::size_t const j) {
+            return i < n_polygon_segments && j >= n_polygon_segments;
+        }));
+
+    std::vector<std::vector<GeoLib::Point>> intersections(
+        ply.getNumberOfSegments());
+    for (auto const& intersection : segment_intersections)
+        intersections[intersection.second_segment - n_polygon_segments]
+            .push_back(intersection.point);
+    return intersections;
+}
+
 bool Polygon::containsSegment(GeoLib::LineSegment const& segment) const
 {
-    std::vector<GeoLib::Point> s(getAllIntersectionPoints(segment));
+    return containsSegment(segment, getAllIntersectionPoints(segment));
+}
 
+bool Polygon::containsSegment(GeoLib::LineSegment const& segment,
+                              std::vector<GeoLib::Point> s) const
+{
     GeoLib::Point const& a{segment.getBeginPoint()};
     GeoLib::Point const& b{segment.getEndPoint()};
     // no intersections -> check if at least one point of segment is in polygon
@@ -193,8 +223,11 @@ bool Polygon::containsSegment(GeoLib::LineSegment const& segment) const
 
 bool Polygon::isPolylineInPolygon(const Polyline& ply) const
 {
-    for (auto segment : ply) {
-        if (!containsSegment(segment)) {
+    auto intersections(getAllIntersectionPoints(ply));
+    for (auto seg_it(ply.begin()); seg_it != ply.end(); ++seg_it) {
+        if (!containsSegment(
+                *seg_it,
+                std::move(intersections[seg_it.getSegmentNumber()]))) {
             return false;
         }
     }
@@ -211,16 +244,11 @@ bool Polygon::isPartOfPolylineInPolygon(const Polyline& ply) const
         }
     }
 
-    GeoLib::Point s;
-    for (auto polygon_seg : *this) {
-        for (auto polyline_seg : ply) {
-            if (GeoLib::lineSegmentIntersect(polyline_seg, polygon_seg, s)) {
-                return true;
-            }
-        }
-    }
-
-    return false;
+    auto const intersections(getAllIntersectionPoints(ply));
+    return std::any_of(intersections.begin(), intersections.end(),
+                       [](std::vector<GeoLib::Point> const& s) {
+                           return !s.empty();
+                       });
 }
 
 bool Polygon::getNextIntersectionPointPolygonLine(
@@ -112,6 +112,7 @@ public:
     const std::list<Polygon*>& getListOfSimplePolygons ();
 
     friend bool operator==(Polygon const& lhs, Polygon const& rhs);
+    friend class PreparedPolygon;
 private:
     /**
      * Computes all intersections of the straight line segment and the polyline boundary
@@ -121,6 +122,26 @@ private:
     std::vector<GeoLib::Point> getAllIntersectionPoints(
         GeoLib::LineSegment const& segment) const;
 
+    /**
+     * Computes for each segment of the polyline all intersections with the
+     * polygon boundary. In contrast to calling the above method for each
+     * segment, not all pairs of segments are tested, see
+     * computeSegmentIntersections().
+     * @param ply the polyline that will be processed
+     * @return for each segment of the polyline a possible empty vector
+     * containing the intersection points
+     */
+    std::vector<std::vector<GeoLib::Point>> getAllIntersectionPoints(
+        Polyline const& ply) const;
+
+    /**
+     * Checks if the straight line segment is contained within the polygon.
+     * @param segment the straight line segment that is checked with
+     * @param s all intersection points of the segment and the polygon boundary
+     */
+    bool containsSegment(GeoLib::LineSegment const& segment,
+                         std::vector<GeoLib::Point> s) const;
+
     /**
      * from book: Computational Geometry and Computer Graphics in C++, page 119
      * get the type of edge with respect to the given point (2d method!)
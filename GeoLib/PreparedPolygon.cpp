@@ -0,0 +1,118 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "PreparedPolygon.h"
+
+#include <algorithm>
+
+#include "Polygon.h"
+
+namespace
+{
+bool isPntInAABB(GeoLib::AABB const& aabb, GeoLib::Point const& pnt)
+{
+    MathLib::Point3d const& min_aabb_pnt(aabb.getMinPoint());
+    MathLib::Point3d const& max_aabb_pnt(aabb.getMaxPoint());
+    return !(pnt[0] < min_aabb_pnt[0] || max_aabb_pnt[0] < pnt[0] ||
+             pnt[1] < min_aabb_pnt[1] || max_aabb_pnt[1] < pnt[1]);
+}
+
+/// Sorts the segments of the polygon into slabs in y direction, starting with
+/// one slab per segment.
+GeoLib::BucketGrid createSlabs(GeoLib::Polygon const& polygon)
+{
+    std::vector<GeoLib::BucketGrid::Box> boxes;
+    for (std::size_t k(0); k + 1 < polygon.getNumberOfPoints(); ++k)
+    {
+        double const y0((*polygon.getPoint(k))[1]);
+        double const y1((*polygon.getPoint(k + 1))[1]);
+        boxes.push_back({{0.0, std::min(y0, y1), 0.0, std::max(y0, y1)}});
+    }
+    return GeoLib::BucketGrid(boxes, {{1, boxes.size()}});
+}
+}  // namespace
+
+namespace GeoLib
+{
+PreparedPolygon::SegmentSlabs::SegmentSlabs(Polygon const& simple_polygon,
+                                            AABB const& simple_polygon_aabb)
+    : polygon(simple_polygon),
+      aabb(simple_polygon_aabb),
+      slabs(createSlabs(simple_polygon))
+{
+}
+
+PreparedPolygon::PreparedPolygon(Polygon const& polygon) : _polygon(polygon)
+{
+    // As in Polygon::isPntInPolygon() a polygon that was split into simple
+    // polygons is represented by the simple polygons.
+    if (_polygon._simple_polygon_list.size() == 1)
+    {
+        _simple_polygons.emplace_back(_polygon, _polygon._aabb);
+    }
+    else
+    {
+        for (Polygon const* simple_polygon : _polygon._simple_polygon_list)
+            _simple_polygons.emplace_back(*simple_polygon,
+                                          simple_polygon->_aabb);
+    }
+}
+
+bool PreparedPolygon::isPntInPolygon(GeoLib::Point const& pnt) const
+{
+    if (!isPntInAABB(_polygon._aabb, pnt))
+        return false;
+
+    for (auto const& simple_polygon : _simple_polygons)
+    {
+        if (isPntInSimplePolygon(simple_polygon, pnt))
+            return true;
+    }
+    return false;
+}
+
+bool PreparedPolygon::isPntInPolygon(double x, double y, double z) const
+{
+    const GeoLib::Point pnt(x, y, z);
+    return isPntInPolygon(pnt);
+}
+
+bool PreparedPolygon::isPntInSimplePolygon(SegmentSlabs const& slabs,
+                                           GeoLib::Point const& pnt) const
+{
+    if (!isPntInAABB(slabs.aabb, pnt))
+        return false;
+
+    Polygon const& polygon(slabs.polygon);
+    std::size_t n_intersections(0);
+    bool touching(false);
+    slabs.slabs.forEachItem(
+        0, slabs.slabs.getCell(pnt[1], 1), [&](std::size_t const k) {
+            double const y0((*polygon.getPoint(k))[1]);
+            double const y1((*polygon.getPoint(k + 1))[1]);
+            if (touching || !((y0 <= pnt[1] && pnt[1] <= y1) ||
+                              (y1 <= pnt[1] && pnt[1] <= y0)))
+                return;
+
+            switch (polygon.getEdgeType(k, pnt))
+            {
+                case EdgeType::TOUCHING:
+                    touching = true;
+                    break;
+                case EdgeType::CROSSING:
+                    n_intersections++;
+                    break;
+                case EdgeType::INESSENTIAL:
+                    break;
+            }
+        });
+    return touching || n_intersections % 2 == 1;
+}
+
+}  // end namespace GeoLib
@@ -0,0 +1,87 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "AABB.h"
+#include "BucketGrid.h"
+#include "Point.h"
+
+namespace GeoLib
+{
+class Polygon;
+
+/**
+ * \ingroup GeoLib
+ *
+ * \brief A polygon prepared for many point in polygon queries.
+ *
+ * The y-extension of each simple polygon of the given polygon is divided into
+ * slabs of equal height and the segments are sorted into the slabs they
+ * intersect. A query tests only the segments of the slab containing the point,
+ * instead of all segments of the polygon as Polygon::isPntInPolygon() does.
+ * The results are the same as of Polygon::isPntInPolygon(), including points
+ * on the boundary.
+ *
+ * The polygon has to outlive the PreparedPolygon object and must not be
+ * modified in the meantime.
+ */
+class PreparedPolygon final
+{
+public:
+    /// Builds the segment slabs of the polygon. The list of simple polygons
+    /// has to be computed before, if necessary.
+    explicit PreparedPolygon(Polygon const& polygon);
+
+    /// \copydoc Polygon::isPntInPolygon(GeoLib::Point const&) const
+    bool isPntInPolygon(GeoLib::Point const& pnt) const;
+
+    /// \copydoc Polygon::isPntInPolygon(double, double, double) const
+    bool isPntInPolygon(double x, double y, double z) const;
+
+    /// Checks concurrently for each of the given points if it is inside the
+    /// polygon.
+    /// @tparam POINT type providing coordinate access by operator[]
+    /// @return for each point true if it is inside the polygon, else false
+    template <typename POINT>
+    std::vector<bool> arePntsInPolygon(std::vector<POINT*> const& pnts) const
+    {
+        std::vector<char> inside(pnts.size());
+        OPENMP_LOOP_TYPE const n_pnts = pnts.size();
+#pragma omp parallel for
+        for (OPENMP_LOOP_TYPE k = 0; k < n_pnts; ++k)
+        {
+            POINT const& p = *pnts[k];
+            inside[k] = isPntInPolygon(p[0], p[1], p[2]);
+        }
+        return std::vector<bool>(inside.begin(), inside.end());
+    }
+
+private:
+    /// Segments of a simple polygon sorted into slabs in y direction, i.e.,
+    /// a bucket grid with a single cell in the first direction.
+    struct SegmentSlabs
+    {
+        SegmentSlabs(Polygon const& simple_polygon, AABB const& aabb);
+
+        Polygon const& polygon;
+        AABB const& aabb;
+        BucketGrid slabs;
+    };
+
+    bool isPntInSimplePolygon(SegmentSlabs const& slabs,
+                              GeoLib::Point const& pnt) const;
+
+    Polygon const& _polygon;
+    std::vector<SegmentSlabs> _simple_polygons;
+};
+
+}  // end namespace GeoLib
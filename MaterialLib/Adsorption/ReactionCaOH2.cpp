@@ -28,6 +28,33 @@ const double ReactionCaOH2::_tol_l   = 1e-4;
 const double ReactionCaOH2::_tol_u   = 1.0 - 1e-4;
 const double ReactionCaOH2::_tol_rho = 0.1;
 
+ReactionCaOH2::ReactionCaOH2(BaseLib::ConfigTree const& conf)
+    :  //! \ogs_file_param{material__adsorption__reaction__CaOH2__ode_solver_config}
+      _ode_solver_config{conf.getConfigSubtree("ode_solver_config")}
+{
+    auto const type =
+        //! \ogs_file_param{material__adsorption__reaction__CaOH2__ode_solver_config__type}
+        _ode_solver_config.getConfigParameter<std::string>("type", "CVODE");
+
+    if (type == "BackwardEuler")
+    {
+        auto const abs_tol =
+            //! \ogs_file_param{material__adsorption__reaction__CaOH2__ode_solver_config__absolute_tolerance}
+            _ode_solver_config.getConfigParameter<double>("absolute_tolerance",
+                                                          1e-10);
+        auto const rel_tol =
+            //! \ogs_file_param{material__adsorption__reaction__CaOH2__ode_solver_config__relative_tolerance}
+            _ode_solver_config.getConfigParameter<double>("relative_tolerance",
+                                                          1e-6);
+        _batch_ode_solver.reset(
+            new MathLib::ODE::BackwardEulerBatchSolver(abs_tol, rel_tol));
+    }
+    else if (type != "CVODE")
+    {
+        OGS_FATAL("Unknown ODE solver type `%s'.", type.c_str());
+    }
+}
+
 const double ReactionCaOH2::rho_low = 1656.0;
 const double ReactionCaOH2::rho_up = 2200.0;
 
@@ -47,9 +74,10 @@ ReactionCaOH2::getReactionRate(const double, const double, const double, const d
 
 double ReactionCaOH2::getReactionRate(double const solid_density)
 {
-    _rho_s = solid_density;
-    calculateQR();
-    return _qR;
+    State& s = _state.get();
+    s.rho_s = solid_density;
+    calculateQR(s);
+    return s.qR;
 }
 
 void ReactionCaOH2::updateParam(
@@ -58,42 +86,43 @@ void ReactionCaOH2::updateParam(
         double x_react,
         double rho_s_initial)
 {
-    _T_s     = T_solid;
-    _p_gas = p_gas / 1e5; // convert Pa to bar
-    _x_react = x_react;
-    _rho_s   = rho_s_initial;
+    State& s = _state.get();
+    s.T_s = T_solid;
+    s.p_gas = p_gas / 1e5; // convert Pa to bar
+    s.x_react = x_react;
+    s.rho_s = rho_s_initial;
 }
 
-void ReactionCaOH2::calculateQR()
+void ReactionCaOH2::calculateQR(State& s)
 {
     // Convert mass fraction into mole fraction
-    const double mol_frac_react = AdsorptionReaction::getMolarFraction(_x_react, _M_react, _M_carrier);
+    const double mol_frac_react = AdsorptionReaction::getMolarFraction(s.x_react, _M_react, _M_carrier);
 
-    _p_r_g = std::max(mol_frac_react * _p_gas, 1.0e-3); // avoid illdefined log
-    setChemicalEquilibrium();
-    const double dXdt = CaHydration();
-    _qR = (rho_up - rho_low) * dXdt;
+    s.p_r_g = std::max(mol_frac_react * s.p_gas, 1.0e-3); // avoid illdefined log
+    setChemicalEquilibrium(s);
+    const double dXdt = CaHydration(s);
+    s.qR = (rho_up - rho_low) * dXdt;
 }
 
 // determine equilibrium temperature and pressure according to van't Hoff
-void ReactionCaOH2::setChemicalEquilibrium()
+void ReactionCaOH2::setChemicalEquilibrium(State& s)
 {
     const double R = MaterialLib::PhysicalConstant::IdealGasConstant;
 
-    _X_D = (_rho_s - rho_up - _tol_rho)/(rho_low - rho_up - 2.0*_tol_rho) ;
-    _X_D = (_X_D < 0.5) ? std::max(_tol_l,_X_D) : std::min(_X_D,_tol_u); // constrain to interval [tol_l;tol_u]
+    s.X_D = (s.rho_s - rho_up - _tol_rho)/(rho_low - rho_up - 2.0*_tol_rho) ;
+    s.X_D = (s.X_D < 0.5) ? std::max(_tol_l,s.X_D) : std::min(s.X_D,_tol_u); // constrain to interval [tol_l;tol_u]
 
-    _X_H = 1.0 - _X_D;
+    s.X_H = 1.0 - s.X_D;
 
     // calculate equilibrium
     // using the p_eq to calculate the T_eq - Clausius-Clapeyron
-    _T_eq = (_reaction_enthalpy/R) / ((_reaction_entropy/R) + std::log(_p_r_g)); // unit of p in bar
+    s.T_eq = (_reaction_enthalpy/R) / ((_reaction_entropy/R) + std::log(s.p_r_g)); // unit of p in bar
     // Alternative: Use T_s as T_eq and calculate p_eq - for Schaube kinetics
-    _p_eq = std::exp((_reaction_enthalpy/R)/_T_s - (_reaction_entropy/R));
+    s.p_eq = std::exp((_reaction_enthalpy/R)/s.T_s - (_reaction_entropy/R));
 }
 
 
-double ReactionCaOH2::CaHydration()
+double ReactionCaOH2::CaHydration(State const& s)
 {
     const double R = MaterialLib::PhysicalConstant::IdealGasConstant;
     double dXdt;
@@ -101,19 +130,19 @@ double ReactionCaOH2::CaHydration()
 #ifdef SIMPLE_KINETICS
     if ( T_s < T_eq ) // hydration - simple model
 #else
-    if ( _p_r_g > _p_eq ) // hydration - Schaube model
+    if ( s.p_r_g > s.p_eq ) // hydration - Schaube model
 #endif
     {
         //X_H = max(tol_l,X_H); //lower tolerance to avoid oscillations at onset of hydration reaction. Set here so that no residual reaction rate occurs at end of hydration.
 #ifdef SIMPLE_KINETICS // this is from P. Schmidt
         dXdt = -1.0*(1.0-X_H) * (T_s - T_eq) / T_eq * 0.2 * conversion_rate::x_react;
 #else //this is from Schaube
-        if (_X_H == _tol_u || _rho_s == rho_up)
+        if (s.X_H == _tol_u || s.rho_s == rho_up)
             dXdt = 0.0;
-        else if ( (_T_eq-_T_s) >= 50.0)
-            dXdt = 13945.0 * exp(-89486.0/R/_T_s) * std::pow(_p_r_g/_p_eq - 1.0,0.83) * 3.0 * (_X_D) * std::pow(-1.0*log(_X_D),0.666);
+        else if ( (s.T_eq-s.T_s) >= 50.0)
+            dXdt = 13945.0 * exp(-89486.0/R/s.T_s) * std::pow(s.p_r_g/s.p_eq - 1.0,0.83) * 3.0 * (s.X_D) * std::pow(-1.0*log(s.X_D),0.666);
         else
-            dXdt = 1.0004e-34 * exp(5.3332e4/_T_s) * std::pow(_p_r_g, 6.0) * (_X_D);
+            dXdt = 1.0004e-34 * exp(5.3332e4/s.T_s) * std::pow(s.p_r_g, 6.0) * (s.X_D);
 #endif
     }
     else // dehydration
@@ -122,12 +151,12 @@ double ReactionCaOH2::CaHydration()
 #ifdef SIMPLE_KINETICS // this is from P. Schmidt
         dXdt = -1.0* (1.0-X_D) * (T_s - T_eq) / T_eq * 0.05;
 #else
-        if (_X_D == _tol_u || _rho_s == rho_low)
+        if (s.X_D == _tol_u || s.rho_s == rho_low)
             dXdt = 0.0;
-        else if (_X_D < 0.2)
-            dXdt = -1.9425e12 * exp( -1.8788e5/R/_T_s ) * std::pow(1.0-_p_r_g/_p_eq,3.0)*(_X_H);
+        else if (s.X_D < 0.2)
+            dXdt = -1.9425e12 * exp( -1.8788e5/R/s.T_s ) * std::pow(1.0-s.p_r_g/s.p_eq,3.0)*(s.X_H);
         else
-            dXdt = -8.9588e9 * exp( -1.6262e5/R/_T_s ) * std::pow(1.0-_p_r_g/_p_eq,3.0)*2.0 * std::pow(_X_H, 0.5);
+            dXdt = -8.9588e9 * exp( -1.6262e5/R/s.T_s ) * std::pow(1.0-s.p_r_g/s.p_eq,3.0)*2.0 * std::pow(s.X_H, 0.5);
 #endif
     }
     return dXdt;
@@ -9,7 +9,11 @@
 
 #pragma once
 
+#include <memory>
+
 #include "BaseLib/ConfigTree.h"
+#include "BaseLib/PerThread.h"
+#include "MathLib/ODE/BackwardEulerBatchSolver.h"
 #include "Reaction.h"
 #include "Adsorption.h"
 
@@ -25,10 +29,7 @@ namespace Adsorption
 class ReactionCaOH2 final : public Reaction
 {
 public:
-    explicit ReactionCaOH2(BaseLib::ConfigTree const& conf) :
-        //! \ogs_file_param{material__adsorption__reaction__CaOH2__ode_solver_config}
-        _ode_solver_config{conf.getConfigSubtree("ode_solver_config")}
-    {}
+    explicit ReactionCaOH2(BaseLib::ConfigTree const& conf);
 
     double getEnthalpy(const double /*p_Ads*/, const double /*T_Ads*/,
                         const double /*M_Ads*/) const override;
@@ -38,6 +39,14 @@ public:
 
     const BaseLib::ConfigTree& getOdeSolverConfig() const { return _ode_solver_config; }
 
+    //! Returns the built-in ODE solver integrating the reaction of many
+    //! integration points at once, or nullptr if an external ODE solver
+    //! configured by getOdeSolverConfig() has to be used.
+    MathLib::ODE::BackwardEulerBatchSolver const* getBatchOdeSolver() const
+    {
+        return _batch_ode_solver.get();
+    }
+
     // TODO merge with getReactionRate() above
     double getReactionRate(double const solid_density);
 
@@ -47,20 +56,29 @@ public:
                       double rho_s_initial);
 
 private:
-    void calculateQR();
-    void setChemicalEquilibrium();
-    double CaHydration();
-
-    double _rho_s;           //!< solid phase density
-    double _p_gas;           //!< gas phase pressure in unit bar
-    double _p_r_g;           //!< pressure of H2O on gas phase
-    double _p_eq = 1.0;      //!< equilibrium pressure in bar
-    double _T_eq;            //!< equilibrium temperature
-    double _T_s;             //!< solid phase temperature
-    double _qR;              //!< rate of solid density change
-    double _x_react;         //!< mass fraction of water in gas phase
-    double _X_D;             //!< mass fraction of dehydration (CaO) in the solid phase
-    double _X_H;             //!< mass fraction of hydration in the solid phase
+    //! Reaction state of a single evaluation of the reaction rate.
+    struct State
+    {
+        double rho_s;         //!< solid phase density
+        double p_gas;         //!< gas phase pressure in unit bar
+        double p_r_g;         //!< pressure of H2O on gas phase
+        double p_eq = 1.0;    //!< equilibrium pressure in bar
+        double T_eq;          //!< equilibrium temperature
+        double T_s;           //!< solid phase temperature
+        double qR;            //!< rate of solid density change
+        double x_react;       //!< mass fraction of water in gas phase
+        double X_D;  //!< mass fraction of dehydration (CaO) in the solid phase
+        double X_H;  //!< mass fraction of hydration in the solid phase
+    };
+
+    static void calculateQR(State& s);
+    static void setChemicalEquilibrium(State& s);
+    static double CaHydration(State const& s);
+
+    //! The state is kept per thread, because the reaction is shared by the
+    //! local assemblers of all elements, which might be assembled
+    //! concurrently.
+    BaseLib::PerThread<State> _state;
 
     //! reaction enthalpy in J/mol; negative for exothermic composition reaction
     static const double _reaction_enthalpy;
@@ -73,6 +91,7 @@ private:
     static const double _tol_rho;
 
     const BaseLib::ConfigTree _ode_solver_config;
+    std::unique_ptr<MathLib::ODE::BackwardEulerBatchSolver> _batch_ode_solver;
 
     template<typename>
     friend class ProcessLib::TESFEMReactionAdaptorCaOH2;
@@ -21,6 +21,7 @@
 #include "WaterDensityIAPWSIF97Region1.h"
 
 #include "MaterialLib/Fluid/ConstantFluidProperty.h"
+#include "MaterialLib/Fluid/TabulatedFluidProperty.h"
 
 namespace MaterialLib
 {
@@ -100,8 +101,19 @@ std::unique_ptr<FluidProperty> createFluidDensityModel(
     }
     else if (type == "WaterDensityIAPWSIF97Region1")
     {
-        return std::unique_ptr<FluidProperty>(
+        //! \ogs_file_param{material__fluid__density__type}
+        config.checkConfigParameter("type", "WaterDensityIAPWSIF97Region1");
+        std::unique_ptr<FluidProperty> density(
             new WaterDensityIAPWSIF97Region1());
+
+        if (auto const tabulation_config =
+                //! \ogs_file_param{material__fluid__density__WaterDensityIAPWSIF97Region1__tabulation}
+            config.getConfigSubtreeOptional("tabulation"))
+        {
+            return createTabulatedFluidProperty(*tabulation_config, "pressure",
+                                                std::move(density));
+        }
+        return density;
     }
     else
     {
@@ -0,0 +1,244 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ * \file   TabulatedFluidProperty.cpp
+ *
+ */
+
+#include "TabulatedFluidProperty.h"
+
+#include <algorithm>
+#include <cmath>
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/ConfigTree.h"
+#include "BaseLib/Error.h"
+
+namespace MaterialLib
+{
+namespace Fluid
+{
+/// Cubic Hermite basis functions on [0, 1]: The first two functions
+/// interpolate the values at 0 and 1, the last two the slopes at 0 and 1.
+static std::array<double, 4> hermiteBasis(double const s)
+{
+    double const s2 = s * s;
+    double const s3 = s2 * s;
+    return {{2 * s3 - 3 * s2 + 1, -2 * s3 + 3 * s2, s3 - 2 * s2 + s,
+             s3 - s2}};
+}
+
+/// Derivatives of the hermiteBasis() functions.
+static std::array<double, 4> hermiteBasisDerivative(double const s)
+{
+    double const s2 = s * s;
+    return {{6 * s2 - 6 * s, -6 * s2 + 6 * s, 3 * s2 - 4 * s + 1,
+             3 * s2 - 2 * s}};
+}
+
+TabulatedFluidProperty::TabulatedFluidProperty(
+    std::unique_ptr<FluidProperty>&& property,
+    std::array<double, 2> const& T_range,
+    std::array<double, 2> const& v_range,
+    std::array<std::size_t, 2> const& number_of_intervals)
+    : _property(std::move(property)),
+      _T_range(T_range),
+      _v_range(v_range),
+      _n(number_of_intervals),
+      _h({{(T_range[1] - T_range[0]) / number_of_intervals[0],
+           (v_range[1] - v_range[0]) / number_of_intervals[1]}})
+{
+    if (!(_T_range[0] < _T_range[1]) || !(_v_range[0] < _v_range[1]))
+        OGS_FATAL("The tabulation ranges of %s are empty.",
+                  _property->getName().c_str());
+    if (_n[0] == 0 || _n[1] == 0)
+        OGS_FATAL("The number of tabulation intervals of %s must be positive.",
+                  _property->getName().c_str());
+
+    auto const T_index = static_cast<int>(PropertyVariableType::T);
+    auto const v_index = static_cast<int>(PropertyVariableType::p);
+
+    _table.resize((_n[0] + 1) * (_n[1] + 1));
+
+    // Step size of the central differences approximating the mixed
+    // derivatives.
+    double const delta = 1.e-3 * _h[1];
+
+    ArrayType vars;
+    for (std::size_t i = 0; i <= _n[0]; ++i)
+    {
+        vars[T_index] = _T_range[0] + i * _h[0];
+        for (std::size_t j = 0; j <= _n[1]; ++j)
+        {
+            double const v = _v_range[0] + j * _h[1];
+            vars[v_index] = v;
+            auto& data = _table[i * (_n[1] + 1) + j];
+            data[0] = _property->getValue(vars);
+            data[1] = _property->getdValue(vars, PropertyVariableType::T);
+            data[2] = _property->getdValue(vars, PropertyVariableType::p);
+
+            vars[v_index] = v + delta;
+            data[3] = _property->getdValue(vars, PropertyVariableType::T);
+            vars[v_index] = v - delta;
+            data[3] -= _property->getdValue(vars, PropertyVariableType::T);
+            data[3] /= 2 * delta;
+        }
+    }
+}
+
+bool TabulatedFluidProperty::locate(double const T, double const v,
+                                    std::size_t& i, std::size_t& j,
+                                    double& xi, double& eta) const
+{
+    if (!(T >= _T_range[0] && T <= _T_range[1] && v >= _v_range[0] &&
+          v <= _v_range[1]))
+        return false;
+
+    double const s_T = (T - _T_range[0]) / _h[0];
+    double const s_v = (v - _v_range[0]) / _h[1];
+    i = std::min(static_cast<std::size_t>(s_T), _n[0] - 1);
+    j = std::min(static_cast<std::size_t>(s_v), _n[1] - 1);
+    xi = s_T - i;
+    eta = s_v - j;
+    return true;
+}
+
+double TabulatedFluidProperty::interpolate(std::size_t const i,
+                                           std::size_t const j,
+                                           double const xi, double const eta,
+                                           int const derivative) const
+{
+    auto a = hermiteBasis(xi);
+    auto b = hermiteBasis(eta);
+    if (derivative == 0)
+    {
+        a = hermiteBasisDerivative(xi);
+        for (auto& a_k : a)
+            a_k /= _h[0];
+    }
+    else if (derivative == 1)
+    {
+        b = hermiteBasisDerivative(eta);
+        for (auto& b_k : b)
+            b_k /= _h[1];
+    }
+
+    double result = 0.0;
+    for (std::size_t di = 0; di < 2; ++di)
+    {
+        for (std::size_t dj = 0; dj < 2; ++dj)
+        {
+            auto const& data = node(i + di, j + dj);
+            result += data[0] * a[di] * b[dj] +
+                      _h[0] * data[1] * a[2 + di] * b[dj] +
+                      _h[1] * data[2] * a[di] * b[2 + dj] +
+                      _h[0] * _h[1] * data[3] * a[2 + di] * b[2 + dj];
+        }
+    }
+    return result;
+}
+
+double TabulatedFluidProperty::getValue(const ArrayType& var_vals) const
+{
+    std::size_t i, j;
+    double xi, eta;
+    if (!locate(var_vals[static_cast<int>(PropertyVariableType::T)],
+                var_vals[static_cast<int>(PropertyVariableType::p)], i, j, xi,
+                eta))
+        return _property->getValue(var_vals);
+
+    return interpolate(i, j, xi, eta, -1);
+}
+
+double TabulatedFluidProperty::getdValue(const ArrayType& var_vals,
+                                         const PropertyVariableType var) const
+{
+    std::size_t i, j;
+    double xi, eta;
+    if (!locate(var_vals[static_cast<int>(PropertyVariableType::T)],
+                var_vals[static_cast<int>(PropertyVariableType::p)], i, j, xi,
+                eta))
+        return _property->getdValue(var_vals, var);
+
+    switch (var)
+    {
+        case PropertyVariableType::T:
+            return interpolate(i, j, xi, eta, 0);
+        case PropertyVariableType::p:
+            return interpolate(i, j, xi, eta, 1);
+        default:
+            return _property->getdValue(var_vals, var);
+    }
+}
+
+double TabulatedFluidProperty::estimateMaximumRelativeError() const
+{
+    double max_error = 0.0;
+    ArrayType vars;
+    for (std::size_t i = 0; i < _n[0]; ++i)
+    {
+        vars[static_cast<int>(PropertyVariableType::T)] =
+            _T_range[0] + (i + 0.5) * _h[0];
+        for (std::size_t j = 0; j < _n[1]; ++j)
+        {
+            vars[static_cast<int>(PropertyVariableType::p)] =
+                _v_range[0] + (j + 0.5) * _h[1];
+            double const exact = _property->getValue(vars);
+            double const error =
+                std::abs(interpolate(i, j, 0.5, 0.5, -1) - exact);
+            max_error = std::max(
+                max_error, exact == 0.0 ? error : error / std::abs(exact));
+        }
+    }
+    return max_error;
+}
+
+std::unique_ptr<FluidProperty> createTabulatedFluidProperty(
+    BaseLib::ConfigTree const& config,
+    std::string const& second_variable_name,
+    std::unique_ptr<FluidProperty>&& property)
+{
+    auto const T_range =
+        //! \ogs_file_special
+        config.getConfigParameter<std::vector<double>>("temperature_range");
+    auto const v_range =
+        //! \ogs_file_special
+        config.getConfigParameter<std::vector<double>>(second_variable_name +
+                                                       "_range");
+    auto const n =
+        //! \ogs_file_special
+        config.getConfigParameter<std::vector<std::size_t>>(
+            "number_of_intervals");
+    auto const tolerance =
+        //! \ogs_file_special
+        config.getConfigParameterOptional<double>("relative_tolerance");
+
+    if (T_range.size() != 2 || v_range.size() != 2 || n.size() != 2)
+        OGS_FATAL(
+            "The tabulation of %s requires two values for each of the tags "
+            "<temperature_range>, <%s_range> and <number_of_intervals>.",
+            property->getName().c_str(), second_variable_name.c_str());
+
+    auto* const tabulated_property = new TabulatedFluidProperty(
+        std::move(property), {{T_range[0], T_range[1]}},
+        {{v_range[0], v_range[1]}}, {{n[0], n[1]}});
+    std::unique_ptr<FluidProperty> result(tabulated_property);
+
+    double const error = tabulated_property->estimateMaximumRelativeError();
+    INFO("%s: estimated maximum relative interpolation error %g.",
+         tabulated_property->getName().c_str(), error);
+    if (tolerance && error > *tolerance)
+        OGS_FATAL(
+            "The estimated relative interpolation error %g of %s exceeds the "
+            "given tolerance %g. Increase the number of intervals.",
+            error, tabulated_property->getName().c_str(), *tolerance);
+
+    return result;
+}
+
+}  // end namespace
+}  // end namespace
@@ -0,0 +1,115 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ * \file   TabulatedFluidProperty.h
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "FluidProperty.h"
+
+namespace BaseLib
+{
+class ConfigTree;
+}
+
+namespace MaterialLib
+{
+namespace Fluid
+{
+/**
+ * \brief Decorator replacing the evaluation of an expensive fluid property by
+ *        a bicubic Hermite interpolation in a table.
+ *
+ * The table spans a rectangular range of the temperature and of the second
+ * property variable (pressure or density, see PropertyVariableType). At the
+ * table nodes the values and the first derivatives of the wrapped property
+ * are stored, the mixed derivatives are approximated by central differences
+ * of the temperature derivative. The interpolant is continuously
+ * differentiable and getdValue() returns the derivative of the interpolant,
+ * i.e. values and derivatives are consistent with each other.
+ *
+ * Outside of the tabulated range the wrapped property is evaluated directly.
+ */
+class TabulatedFluidProperty final : public FluidProperty
+{
+public:
+    /**
+     * \param property             The wrapped fluid property.
+     * \param T_range              Tabulated temperature range.
+     * \param v_range              Tabulated range of the second variable.
+     * \param number_of_intervals  Number of table intervals in temperature
+     *                             and second variable direction.
+     */
+    TabulatedFluidProperty(
+        std::unique_ptr<FluidProperty>&& property,
+        std::array<double, 2> const& T_range,
+        std::array<double, 2> const& v_range,
+        std::array<std::size_t, 2> const& number_of_intervals);
+
+    std::string getName() const override
+    {
+        return "Tabulated " + _property->getName();
+    }
+
+    double getValue(const ArrayType& var_vals) const override;
+
+    double getdValue(const ArrayType& var_vals,
+                     const PropertyVariableType var) const override;
+
+    /// Maximum relative difference between the interpolated and the exact
+    /// property values at the centres of the table cells.
+    double estimateMaximumRelativeError() const;
+
+private:
+    /// Values, temperature derivative, second variable derivative and mixed
+    /// derivative at a table node.
+    using NodeData = std::array<double, 4>;
+
+    /// Cell indices and local coordinates in [0, 1] of the given point.
+    /// Returns false if the point is outside of the table.
+    bool locate(double const T, double const v, std::size_t& i,
+                std::size_t& j, double& xi, double& eta) const;
+
+    NodeData const& node(std::size_t const i, std::size_t const j) const
+    {
+        return _table[i * (_n[1] + 1) + j];
+    }
+
+    /// Evaluates the interpolant or its derivative with respect to the
+    /// temperature (\c derivative = 0) or the second variable (1) in the given
+    /// cell. Any other value of \c derivative yields the interpolated value.
+    double interpolate(std::size_t const i, std::size_t const j,
+                       double const xi, double const eta,
+                       int const derivative) const;
+
+    std::unique_ptr<FluidProperty> const _property;
+
+    std::array<double, 2> const _T_range;
+    std::array<double, 2> const _v_range;
+    std::array<std::size_t, 2> const _n;
+    std::array<double, 2> const _h;  ///< Table spacings.
+
+    std::vector<NodeData> _table;
+};
+
+/// Wraps \c property in a TabulatedFluidProperty configured by the given
+/// <tt>\<tabulation\></tt> subtree. \c second_variable_name is the prefix of
+/// the range tag of the second property variable, e.g. "pressure".
+std::unique_ptr<FluidProperty> createTabulatedFluidProperty(
+    BaseLib::ConfigTree const& config,
+    std::string const& second_variable_name,
+    std::unique_ptr<FluidProperty>&& property);
+
+}  // end namespace
+}  // end namespace
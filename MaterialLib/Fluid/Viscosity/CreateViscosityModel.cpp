@@ -16,6 +16,7 @@
 #include "BaseLib/Error.h"
 
 #include "MaterialLib/Fluid/ConstantFluidProperty.h"
+#include "MaterialLib/Fluid/TabulatedFluidProperty.h"
 #include "LinearPressureDependentViscosity.h"
 #include "TemperatureDependentViscosity.h"
 #include "VogelsLiquidDynamicViscosity.h"
@@ -140,7 +141,16 @@ std::unique_ptr<FluidProperty> createViscosityModel(
     {
         //! \ogs_file_param{material__fluid__viscosity__type}
         config.checkConfigParameter("type", "WaterViscosityIAPWS");
-        return std::unique_ptr<FluidProperty>(new WaterViscosityIAPWS());
+        std::unique_ptr<FluidProperty> viscosity(new WaterViscosityIAPWS());
+
+        if (auto const tabulation_config =
+                //! \ogs_file_param{material__fluid__viscosity__WaterViscosityIAPWS__tabulation}
+            config.getConfigSubtreeOptional("tabulation"))
+        {
+            return createTabulatedFluidProperty(*tabulation_config, "density",
+                                                std::move(viscosity));
+        }
+        return viscosity;
     }
     else
     {
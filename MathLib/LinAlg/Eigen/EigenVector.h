@@ -77,6 +77,15 @@ public:
         return local_x;
     }
 
+    /// get entries into \c local_x, reusing its memory
+    void get(std::vector<IndexType> const& indices,
+             std::vector<double>& local_x) const
+    {
+        local_x.resize(indices.size());
+        for (std::size_t i = 0; i < indices.size(); ++i)
+            local_x[i] = _vec[indices[i]];
+    }
+
     /// set entry
     void set(IndexType rowId, double v)
     {
@@ -98,6 +98,16 @@ double normMax(PETScVector const& x)
     return norm;
 }
 
+// Explicit specialization
+// Computes the scalar product of x and y
+template<>
+double dot(PETScVector const& x, PETScVector const& y)
+{
+    PetscScalar result = 0.;
+    VecDot(x.getRawVector(), y.getRawVector(), &result);
+    return result;
+}
+
 
 // Matrix
 
@@ -162,6 +172,26 @@ void finalizeAssembly(PETScVector& x)
     x.finalizeAssembly();
 }
 
+void beginLocalAccess(PETScVector const& x)
+{
+    x.beginLocalAccess();
+}
+
+void endLocalAccess(PETScVector const& x)
+{
+    x.endLocalAccess();
+}
+
+void beginGhostUpdate(PETScVector const& x)
+{
+    x.beginGhostUpdate();
+}
+
+void finishGhostUpdate(PETScVector const& x)
+{
+    x.finishGhostUpdate();
+}
+
 }} // namespaces
 
 
@@ -247,6 +277,14 @@ double normMax(EigenVector const& x)
     return x.getRawVector().lpNorm<Eigen::Infinity>();
 }
 
+// Explicit specialization
+// Computes the scalar product of x and y
+template<>
+double dot(EigenVector const& x, EigenVector const& y)
+{
+    return x.getRawVector().dot(y.getRawVector());
+}
+
 
 // Matrix
 
@@ -10,6 +10,7 @@
 #pragma once
 
 #include <cassert>
+#include <vector>
 #include "BaseLib/Error.h"
 #include "LinAlgEnums.h"
 
@@ -83,6 +84,10 @@ double norm2(MatrixOrVector const& x);
 template<typename MatrixOrVector>
 double normMax(MatrixOrVector const& x);
 
+//! Computes the scalar product of \c x and \c y.
+template<typename MatrixOrVector>
+double dot(MatrixOrVector const& x, MatrixOrVector const& y);
+
 template<typename MatrixOrVector>
 double norm(MatrixOrVector const& x, MathLib::VecNormType type)
 {
@@ -104,6 +109,42 @@ void finalizeAssembly(Matrix& /*A*/)
     // By default do nothing.
 }
 
+/*! Makes the entries of \c x local to this process, including ghost entries,
+ * directly readable until the matching call of endLocalAccess().
+ *
+ * Prefer ScopedLocalAccess over calling this function directly.
+ */
+template<typename Vector>
+void beginLocalAccess(Vector const& /*x*/)
+{
+    // By default do nothing.
+}
+
+//! Ends the local access started by beginLocalAccess().
+template<typename Vector>
+void endLocalAccess(Vector const& /*x*/)
+{
+    // By default do nothing.
+}
+
+/*! Starts the update of the ghost entries of \c x, such that computations on
+ * the owned entries overlap the communication. The update is finished by
+ * finishGhostUpdate(), at the latest by the end of a local access begun
+ * meanwhile.
+ */
+template<typename Vector>
+void beginGhostUpdate(Vector const& /*x*/)
+{
+    // By default do nothing.
+}
+
+//! Finishes the update of the ghost entries begun by beginGhostUpdate().
+template<typename Vector>
+void finishGhostUpdate(Vector const& /*x*/)
+{
+    // By default do nothing.
+}
+
 // Matrix and Vector
 
 /*! Computes \f$ y = A \cdot x \f$.
@@ -190,6 +231,12 @@ void matMultAdd(PETScMatrix const& A, PETScVector const& v1,
 void finalizeAssembly(PETScMatrix& A);
 void finalizeAssembly(PETScVector& x);
 
+void beginLocalAccess(PETScVector const& x);
+void endLocalAccess(PETScVector const& x);
+
+void beginGhostUpdate(PETScVector const& x);
+void finishGhostUpdate(PETScVector const& x);
+
 }} // namespaces
 
 
@@ -252,3 +299,46 @@ void finalizeAssembly(EigenMatrix& A);
 } // namespace MathLib
 
 #endif
+
+
+namespace MathLib
+{
+namespace LinAlg
+{
+/*! Makes the entries of the given vectors local to this process, including
+ * ghost entries, directly readable during the lifetime of this object, see
+ * beginLocalAccess().
+ *
+ * For PETSc vectors this avoids PETSc calls per entry; the ghost entries are
+ * updated once. Null pointers are ignored.
+ *
+ * \note For PETSc vectors the local access must be started on all ranks.
+ */
+template <typename Vector>
+class ScopedLocalAccess final
+{
+public:
+    explicit ScopedLocalAccess(std::vector<Vector const*> xs)
+        : _xs(std::move(xs))
+    {
+        for (auto const* x : _xs)
+            if (x)
+                beginLocalAccess(*x);
+    }
+
+    ScopedLocalAccess(ScopedLocalAccess const&) = delete;
+    ScopedLocalAccess& operator=(ScopedLocalAccess const&) = delete;
+
+    ~ScopedLocalAccess()
+    {
+        for (auto const* x : _xs)
+            if (x)
+                endLocalAccess(*x);
+    }
+
+private:
+    std::vector<Vector const*> const _xs;
+};
+
+}  // namespace LinAlg
+}  // namespace MathLib
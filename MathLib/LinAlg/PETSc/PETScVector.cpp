@@ -46,6 +46,13 @@ PETScVector::PETScVector(const PetscInt vec_size,
     : _size_ghosts{static_cast<PetscInt>(ghost_ids.size())}
     , _has_ghost_id{true}
 {
+    auto ghost_positions =
+        std::make_shared<std::unordered_map<PetscInt, PetscInt>>();
+    ghost_positions->reserve(ghost_ids.size());
+    for (std::size_t i = 0; i < ghost_ids.size(); ++i)
+        ghost_positions->emplace(ghost_ids[i], static_cast<PetscInt>(i));
+    _ghost_positions = std::move(ghost_positions);
+
     PetscInt nghosts = static_cast<PetscInt>( ghost_ids.size() );
     if ( is_global_size )
     {
@@ -83,7 +90,11 @@ PETScVector::PETScVector(PETScVector &&other)
     , _size_loc{other._size_loc}
     , _size_ghosts{other._size_ghosts}
     , _has_ghost_id{other._has_ghost_id}
-{}
+    , _ghost_positions{std::move(other._ghost_positions)}
+    , _ghost_update_pending{other._ghost_update_pending}
+{
+    other._ghost_update_pending = false;
+}
 
 void PETScVector::config()
 {
@@ -160,18 +171,65 @@ void PETScVector::copyValues(std::vector<double>& u) const
 {
     assert(u.size() == (std::size_t) (getLocalSize() + getGhostSize()));
 
+    finishGhostUpdate();
+    if (_local_array)
+    {
+        std::copy_n(_local_array, getLocalSize() + getGhostSize(), u.begin());
+        return;
+    }
+
     double* loc_x = getLocalVector();
     std::copy_n(loc_x, getLocalSize() + getGhostSize(), u.begin());
     restoreArray(loc_x);
 }
 
+void PETScVector::beginLocalAccess() const
+{
+    // Note: The ghost update is collective, hence the local access has to be
+    // begun on all ranks.
+    if (_local_access_count++ > 0)
+        return;
+    _local_array = getLocalVector();
+}
+
+void PETScVector::endLocalAccess() const
+{
+    assert(_local_access_count > 0);
+    if (--_local_access_count > 0)
+        return;
+    finishGhostUpdate();
+    restoreArray(const_cast<PetscScalar*>(_local_array));
+    _local_array = nullptr;
+}
+
+void PETScVector::beginGhostUpdate() const
+{
+    if (!_has_ghost_id || _ghost_update_pending || _local_access_count > 0)
+        return;
+    VecGhostUpdateBegin(_v, INSERT_VALUES, SCATTER_FORWARD);
+    _ghost_update_pending = true;
+}
+
+void PETScVector::finishGhostUpdate() const
+{
+    if (!_ghost_update_pending)
+        return;
+    VecGhostUpdateEnd(_v, INSERT_VALUES, SCATTER_FORWARD);
+    _ghost_update_pending = false;
+}
+
 PetscScalar* PETScVector::getLocalVector() const
 {
     PetscScalar *loc_array;
     if (_has_ghost_id)
     {
-        VecGhostUpdateBegin(_v, INSERT_VALUES, SCATTER_FORWARD);
-        VecGhostUpdateEnd(_v, INSERT_VALUES, SCATTER_FORWARD);
+        // The ghost entries are updated, unless an update begun by
+        // beginGhostUpdate() is in flight.
+        if (!_ghost_update_pending)
+        {
+            VecGhostUpdateBegin(_v, INSERT_VALUES, SCATTER_FORWARD);
+            VecGhostUpdateEnd(_v, INSERT_VALUES, SCATTER_FORWARD);
+        }
         VecGhostGetLocalForm(_v, &_v_loc);
         VecGetArray(_v_loc, &loc_array);
     }
@@ -221,6 +279,7 @@ void PETScVector::shallowCopy(const PETScVector &v)
     _size_loc     = v._size_loc;
     _size_ghosts  = v._size_ghosts;
     _has_ghost_id = v._has_ghost_id;
+    _ghost_positions = v._ghost_positions;
 
     VecSetOption(_v, VEC_IGNORE_NEGATIVE_INDICES, PETSC_TRUE);
 }
@@ -16,10 +16,15 @@
 
 #pragma once
 
+#include <cassert>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <petscvec.h>
 
+#include "BaseLib/Error.h"
+
 namespace MathLib
 {
 /*!
@@ -157,11 +162,68 @@ class PETScVector
         //! Get several entries
         std::vector<double> get(std::vector<IndexType> const& indices) const
         {
-            std::vector<double> local_x(indices.size());
+            std::vector<double> local_x;
+            get(indices, local_x);
+            return local_x;
+        }
+
+        //! Get several entries into \c local_x, reusing its memory.
+        //! Ghost entries, given by negative indices, are only available
+        //! during a local access, see beginLocalAccess().
+        void get(std::vector<IndexType> const& indices,
+                 std::vector<double>& local_x) const
+        {
+            local_x.resize(indices.size());
+            if (_local_array)
+            {
+                for (std::size_t i = 0; i < indices.size(); ++i)
+                {
+                    assert(!_ghost_update_pending || indices[i] >= 0);
+                    local_x[i] = _local_array[getLocalIndex(indices[i])];
+                }
+            }
+            else
+            {
+                VecGetValues(_v, indices.size(), indices.data(),
+                             local_x.data());
+            }
+        }
 
-            VecGetValues(_v, indices.size(), indices.data(), local_x.data());
+        /*! Makes the entries local to this rank, including the ghost
+         * entries, directly accessible by get() and getLocalValue() without
+         * per-entry PETSc calls, until the matching call of endLocalAccess().
+         *
+         * The ghost entries are updated once at the beginning, unless an
+         * update begun by beginGhostUpdate() is pending. Calls can be nested.
+         * The vector must not be modified during the local access.
+         */
+        void beginLocalAccess() const;
 
-            return local_x;
+        //! Ends the local access started by beginLocalAccess(). A pending
+        //! update of the ghost entries is finished.
+        void endLocalAccess() const;
+
+        /*! Starts the update of the ghost entries, which is finished by
+         * finishGhostUpdate(). Meanwhile, a local access gives the owned
+         * entries; the ghost entries are readable after the update.
+         *
+         * During a local access the ghost entries are up to date already and
+         * no update is started. The update is collective. Copies of the vector
+         * share its scatter context, hence no update of a copy may be pending.
+         */
+        void beginGhostUpdate() const;
+
+        //! Waits for the update of the ghost entries begun by
+        //! beginGhostUpdate(), if pending.
+        void finishGhostUpdate() const;
+
+        //! Get the entry with the given index of the local form, i.e.,
+        //! the owned entries followed by the ghost entries. Only available
+        //! during a local access, see beginLocalAccess().
+        double getLocalValue(PetscInt const local_index) const
+        {
+            assert(!_ghost_update_pending || local_index < _size_loc);
+            return _local_array[local_index];
         }
 
         // TODO preliminary
@@ -249,7 +311,12 @@ class PETScVector
         void shallowCopy(const PETScVector &v);
 
     private:
-        void destroy() { if (_v) VecDestroy(&_v); _v = nullptr; }
+        void destroy()
+        {
+            finishGhostUpdate();
+            if (_v) VecDestroy(&_v);
+            _v = nullptr;
+        }
 
         PETSc_Vec _v = nullptr;
         /// Local vector, which is only for the case that  _v is created
@@ -271,6 +338,37 @@ class PETScVector
         /// Flag to indicate whether the vector is created with ghost entry indices
         bool _has_ghost_id = false;
 
+        /// Positions of the ghost entries in the local form by their global
+        /// indices, shared by all copies of the vector.
+        std::shared_ptr<std::unordered_map<PetscInt, PetscInt> const>
+            _ghost_positions;
+
+        /// Array of the local form during a local access.
+        mutable PetscScalar const* _local_array = nullptr;
+        /// Nesting level of the local access.
+        mutable unsigned _local_access_count = 0;
+        /// Whether the update of the ghost entries begun by
+        /// beginGhostUpdate() has not been finished yet.
+        mutable bool _ghost_update_pending = false;
+
+        /// Index in the local form of the entry with the given global index,
+        /// which is negative for ghost entries.
+        PetscInt getLocalIndex(PetscInt const global_index) const
+        {
+            if (global_index >= 0)
+                return global_index - _start_rank;
+            // A ghost entry with the global index 0 is given by the negative
+            // vector size.
+            auto const ghost_index =
+                global_index == -_size ? 0 : -global_index;
+            if (!_ghost_positions)
+                OGS_FATAL(
+                    "PETScVector: The ghost entry with the global index %d is "
+                    "requested from a vector without ghost entries.",
+                    ghost_index);
+            return _size_loc + _ghost_positions->at(ghost_index);
+        }
+
         /*!
               \brief  Collect local vectors
               \param  local_array Local array
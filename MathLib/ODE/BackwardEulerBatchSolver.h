@@ -0,0 +1,154 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "BaseLib/Error.h"
+
+namespace MathLib
+{
+namespace ODE
+{
+/*! Lightweight implicit integrator for a batch of independent scalar ODEs
+ * \f$ \dot y_i = f(i, y_i) \f$, e.g. a reaction kinetics equation at each
+ * integration point of an element.
+ *
+ * Each equation is advanced with the backward Euler method. The local error
+ * is estimated by comparing one step with two half steps, the step size is
+ * adapted accordingly. Accepted steps are improved by Richardson
+ * extrapolation of both results, which retains L-stability. The nonlinear
+ * equation of each implicit step is solved by a Newton iteration with a
+ * finite difference derivative.
+ *
+ * In contrast to the external ODE solvers there is no per-equation setup, so
+ * this class is well suited for many small systems.
+ */
+class BackwardEulerBatchSolver final
+{
+public:
+    /// \param abs_tol absolute tolerance of the local error estimate.
+    /// \param rel_tol relative tolerance of the local error estimate.
+    /// \param max_step_halvings bound for the number of step halvings.
+    BackwardEulerBatchSolver(double const abs_tol, double const rel_tol,
+                             unsigned const max_step_halvings = 30)
+        : _abs_tol(abs_tol),
+          _rel_tol(rel_tol),
+          _max_step_halvings(max_step_halvings)
+    {
+    }
+
+    /*! Integrates all equations from time 0 to \c t_end.
+     *
+     * \param f    rate function, called as \c f(i, y_i).
+     * \param t_end end time of the integration.
+     * \param y    on input the initial values, on output the solution at
+     *             \c t_end.
+     * \param ydot on output the rates at \c t_end, resized if necessary.
+     */
+    template <typename Function>
+    void solve(Function const& f, double const t_end, std::vector<double>& y,
+               std::vector<double>& ydot) const
+    {
+        ydot.resize(y.size());
+        for (std::size_t i = 0; i < y.size(); ++i)
+        {
+            auto const f_i = [&f, i](double const y_i) { return f(i, y_i); };
+            y[i] = solveEquation(f_i, t_end, y[i]);
+            ydot[i] = f_i(y[i]);
+        }
+    }
+
+private:
+    template <typename Function>
+    double solveEquation(Function const& f, double const t_end,
+                         double y) const
+    {
+        double const h_min =
+            t_end / std::pow(2.0, static_cast<double>(_max_step_halvings));
+        double t = 0.0;
+        double h = t_end;
+
+        while (t < t_end)
+        {
+            h = std::min(h, t_end - t);
+
+            double y_full, y_half, y_two_halves;
+            bool const converged =
+                step(f, y, h, y_full) && step(f, y, 0.5 * h, y_half) &&
+                step(f, y_half, 0.5 * h, y_two_halves);
+
+            if (converged &&
+                std::abs(y_two_halves - y_full) <=
+                    _abs_tol + _rel_tol * std::abs(y_two_halves))
+            {
+                // Richardson extrapolation, second order accurate
+                y = 2.0 * y_two_halves - y_full;
+                t += h;
+                h *= 2.0;
+            }
+            else if (h > h_min)
+            {
+                h *= 0.5;
+            }
+            else
+            {
+                OGS_FATAL(
+                    "The backward Euler ODE solver did not reach the required "
+                    "accuracy with the minimum step size %g at t = %g.",
+                    h, t);
+            }
+        }
+        return y;
+    }
+
+    /// Performs one backward Euler step from \c y_old with step size \c h.
+    /// Returns false if the Newton iteration does not converge.
+    template <typename Function>
+    bool step(Function const& f, double const y_old, double const h,
+              double& y) const
+    {
+        y = y_old;
+
+        for (int iteration = 0; iteration < _max_newton_iterations;
+             ++iteration)
+        {
+            double const f_y = f(y);
+            double const residual = y - y_old - h * f_y;
+
+            double const eps =
+                std::sqrt(std::numeric_limits<double>::epsilon()) *
+                std::max(std::abs(y), 1.0);
+            double const df_dy = (f(y + eps) - f_y) / eps;
+            double const jacobian = 1.0 - h * df_dy;
+            if (jacobian == 0.0 || !std::isfinite(jacobian))
+                return false;
+
+            double const dy = -residual / jacobian;
+            y += dy;
+            if (!std::isfinite(y))
+                return false;
+            if (std::abs(dy) <= 1e-3 * (_abs_tol + _rel_tol * std::abs(y)))
+                return true;
+        }
+        return false;
+    }
+
+    double const _abs_tol;
+    double const _rel_tol;
+    unsigned const _max_step_halvings;
+    static const int _max_newton_iterations = 20;
+};
+
+}  // namespace ODE
+}  // namespace MathLib
@@ -15,6 +15,7 @@
 #include "GeoMapper.h"
 
 #include <algorithm>
+#include <array>
 #include <sstream>
 #include <numeric>
 
@@ -41,7 +42,8 @@ namespace MeshGeoToolsLib {
 
 GeoMapper::GeoMapper(GeoLib::GEOObjects &geo_objects, const std::string &geo_name)
     : _geo_objects(geo_objects), _geo_name(const_cast<std::string&>(geo_name)),
-    _surface_mesh(nullptr), _grid(nullptr), _raster(nullptr)
+    _surface_mesh(nullptr), _grid(nullptr), _mesh_element_grid(nullptr),
+    _raster(nullptr)
 {
 }
 
@@ -100,6 +102,7 @@ void GeoMapper::mapOnMesh(MeshLib::Mesh const*const mesh)
         flat_nodes.back()[2] = 0.0;
     }
     _grid = new GeoLib::Grid<MeshLib::Node>(flat_nodes.cbegin(), flat_nodes.cend());
+    _mesh_element_grid = new MeshLib::MeshElementGrid(*_surface_mesh);
 
     if (GeoLib::isStation((*pnts)[0])) {
         mapStationData(*pnts);
@@ -107,7 +110,10 @@ void GeoMapper::mapOnMesh(MeshLib::Mesh const*const mesh)
         mapPointDataToMeshSurface(*pnts);
     }
 
+    delete _mesh_element_grid;
+    _mesh_element_grid = nullptr;
     delete _grid;
+    _grid = nullptr;
 }
 
 void GeoMapper::mapToConstantValue(double value)
@@ -123,21 +129,11 @@ void GeoMapper::mapToConstantValue(double value)
 
 void GeoMapper::mapStationData(std::vector<GeoLib::Point*> const& points)
 {
-    double min_val(0), max_val(0);
-    if (_surface_mesh)
-    {
-        GeoLib::AABB bounding_box(
-            _surface_mesh->getNodes().begin(), _surface_mesh->getNodes().end());
-        min_val = bounding_box.getMinPoint()[2];
-        max_val = bounding_box.getMaxPoint()[2];
-    }
-
     for (auto * pnt : points)
     {
         double offset =
             (_grid)
-                ? (getMeshElevation((*pnt)[0], (*pnt)[1], min_val, max_val) -
-                   (*pnt)[2])
+                ? (getMeshElevation((*pnt)[0], (*pnt)[1]) - (*pnt)[2])
                 : getDemElevation(*pnt);
 
         if (!GeoLib::isBorehole(pnt))
@@ -162,19 +158,19 @@ void GeoMapper::mapPointDataToMeshSurface(std::vector<GeoLib::Point*> const& pnt
 {
     GeoLib::AABB const aabb(
         _surface_mesh->getNodes().cbegin(), _surface_mesh->getNodes().cend());
-    double const min_val(aabb.getMinPoint()[2]);
-    double const max_val(aabb.getMaxPoint()[2]);
 
-    for (auto * pnt : pnts) {
+    OPENMP_LOOP_TYPE const n_pnts = pnts.size();
+#pragma omp parallel for
+    for (OPENMP_LOOP_TYPE k = 0; k < n_pnts; ++k) {
         // check if pnt is inside of the bounding box of the _surface_mesh
         // projected onto the y-x plane
-        GeoLib::Point &p(*pnt);
+        GeoLib::Point &p(*pnts[k]);
         if (p[0] < aabb.getMinPoint()[0] || aabb.getMaxPoint()[0] < p[0])
             continue;
         if (p[1] < aabb.getMinPoint()[1] || aabb.getMaxPoint()[1] < p[1])
             continue;
 
-        p[2] = getMeshElevation(p[0], p[1], min_val, max_val);
+        p[2] = getMeshElevation(p[0], p[1]);
     }
 }
 
@@ -186,68 +182,41 @@ float GeoMapper::getDemElevation(GeoLib::Point const& pnt) const
     return static_cast<float>(elevation);
 }
 
-double GeoMapper::getMeshElevation(
-    double x, double y, double min_val, double max_val) const
+double GeoMapper::getMeshElevation(double x, double y) const
 {
-    const MeshLib::Node* pnt =
-        _grid->getNearestPoint(MathLib::Point3d{{{x, y, 0}}});
-    const std::vector<MeshLib::Element*> elements(
-        _surface_mesh->getNode(pnt->getID())->getElements());
-    std::unique_ptr<GeoLib::Point> intersection;
-
-    for (auto const & element : elements)
+    MathLib::Point3d const p{{{x, y, 0}}};
+    std::array<double, 4> weights;
+    auto const* const element(
+        _mesh_element_grid->findElementContainingPointXY(p, weights));
+    if (element)
     {
-        if (intersection == nullptr &&
-            element->getGeomType() != MeshLib::MeshElemType::LINE)
-            intersection = GeoLib::triangleLineIntersection(
-                *element->getNode(0), *element->getNode(1),
-                *element->getNode(2), GeoLib::Point(x, y, max_val),
-                GeoLib::Point(x, y, min_val));
-
-        if (intersection == nullptr &&
-            element->getGeomType() == MeshLib::MeshElemType::QUAD)
-            intersection = GeoLib::triangleLineIntersection(
-                *element->getNode(0), *element->getNode(2),
-                *element->getNode(3), GeoLib::Point(x, y, max_val),
-                GeoLib::Point(x, y, min_val));
+        double elevation(0.0);
+        for (unsigned k(0); k < element->getNumberOfBaseNodes(); ++k)
+            elevation += weights[k] * (*element->getNode(k))[2];
+        return elevation;
     }
-    if (intersection)
-        return (*intersection)[2];
+
     // if something goes wrong, simply take the elevation of the nearest mesh node
+    const MeshLib::Node* pnt = _grid->getNearestPoint(p);
     return (*(_surface_mesh->getNode(pnt->getID())))[2];
 }
 
 /// Find the 2d-element within the \c elements that contains the given point \c p.
 ///
-/// The algorithm projects every element of the elements vector and the point
-/// \c p orthogonal to the \f$x\f$-\f$y\f$ plane. In the \f$x\f$-\f$y\f$ plane
-/// it is checked if the projected point is in the projected element.
+/// It is checked if the orthogonal projection of the point \c p to the
+/// \f$x\f$-\f$y\f$ plane is in the projection of a triangle or quad element of
+/// the elements vector.
 static MeshLib::Element const* findElementContainingPointXY(
     std::vector<MeshLib::Element const*> const& elements,
     MathLib::Point3d const& p)
 {
+    std::array<double, 4> weights;
     for (auto const elem : elements) {
-        std::unique_ptr<MeshLib::Element> elem_2d(elem->clone());
-        // reset/copy the nodes
-        for (std::size_t k(0); k<elem_2d->getNumberOfNodes(); ++k) {
-            elem_2d->setNode(k, new MeshLib::Node(*elem_2d->getNode(k)));
-        }
-        // project to xy
-        for (std::size_t k(0); k<elem_2d->getNumberOfNodes(); ++k) {
-            (*const_cast<MeshLib::Node*>(elem_2d->getNode(k)))[2] = 0.0;
-        }
-        if (elem_2d->isPntInElement(MathLib::Point3d{ {{p[0], p[1], 0.0}} })) {
-            // clean up the copied nodes
-            for (std::size_t k(0); k<elem_2d->getNumberOfNodes(); ++k) {
-                delete elem_2d->getNode(k);
-            }
+        if (elem->getGeomType() != MeshLib::MeshElemType::TRIANGLE &&
+            elem->getGeomType() != MeshLib::MeshElemType::QUAD)
+            continue;
+        if (MeshLib::computeInterpolationWeightsXY(p, *elem, weights))
             return elem;
-        } else {
-            // clean up the copied nodes
-            for (std::size_t k(0); k<elem_2d->getNumberOfNodes(); ++k) {
-                delete elem_2d->getNode(k);
-            }
-        }
     }
     return nullptr;
 }
@@ -24,6 +24,7 @@
 
 namespace MeshLib {
     class Mesh;
+    class MeshElementGrid;
     class Node;
 }
 
@@ -75,9 +76,11 @@ private:
     /// Mapping points on mesh.
     void mapPointDataToMeshSurface(std::vector<GeoLib::Point*> const& points);
 
-    /// Returns the elevation at Point (x,y) based on a mesh. This uses collision detection for triangles and nearest neighbor for quads.
-    /// NOTE: This medhod only returns correct values if the node numbering of the elements is correct!
-    double getMeshElevation(double x, double y, double min_val, double max_val) const;
+    /// Returns the elevation at Point (x,y) based on a mesh. The elevation is
+    /// interpolated linearly within the triangle or quad containing the point
+    /// in the x-y plane. For points outside of the mesh the elevation of the
+    /// nearest mesh node is returned.
+    double getMeshElevation(double x, double y) const;
 
     /// Returns the elevation at Point (x,y) based on a raster
     float getDemElevation(GeoLib::Point const& pnt) const;
@@ -88,6 +91,7 @@ private:
     /// only necessary for mapping on mesh
     MeshLib::Mesh* _surface_mesh;
     GeoLib::Grid<MeshLib::Node>* _grid;
+    MeshLib::MeshElementGrid* _mesh_element_grid;
 
     /// only necessary for mapping on DEM
     GeoLib::Raster *_raster;
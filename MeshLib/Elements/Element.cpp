@@ -22,6 +22,34 @@
 
 #include "Line.h"
 
+namespace
+{
+/// Computes the barycentric coordinates of \f$p'\f$ with respect to the
+/// triangle \f$a'b'c'\f$, where \f$p', a', b', c'\f$ are the orthogonal
+/// projections to the \f$x\f$-\f$y\f$ plane of the points. Returns false if
+/// \f$p'\f$ is outside of the triangle or the triangle is degenerated.
+bool computeBarycentricCoordinatesXY(MathLib::Point3d const& p,
+                                     MathLib::Point3d const& a,
+                                     MathLib::Point3d const& b,
+                                     MathLib::Point3d const& c, double eps,
+                                     std::array<double, 3>& coords)
+{
+    // p-a = u * (b-a) + v * (c-a), solved by Cramer's rule
+    double const v0(b[0] - a[0]), v1(b[1] - a[1]);
+    double const w0(c[0] - a[0]), w1(c[1] - a[1]);
+    double const det(v0 * w1 - v1 * w0);
+    if (det == 0.0)
+        return false;
+    double const q0(p[0] - a[0]), q1(p[1] - a[1]);
+    double const u((q0 * w1 - q1 * w0) / det);
+    double const v((v0 * q1 - v1 * q0) / det);
+    if (u < -eps || v < -eps || u + v > 1 + eps)
+        return false;
+    coords = {{1 - u - v, u, v}};
+    return true;
+}
+}  // namespace
+
 namespace MeshLib {
 
 Element::Element(std::size_t id)
@@ -242,4 +270,45 @@ bool isPointInElementXY(MathLib::Point3d const& p, Element const& e)
     }
 }
 
+bool computeInterpolationWeightsXY(MathLib::Point3d const& p, Element const& e,
+                                   std::array<double, 4>& weights,
+                                   double const eps)
+{
+    weights.fill(0.0);
+    if (e.getGeomType() != MeshElemType::TRIANGLE &&
+        e.getGeomType() != MeshElemType::QUAD)
+    {
+        WARN(
+            "computeInterpolationWeightsXY: element type \"%s\" is not "
+            "supported.",
+            MeshLib::MeshElemType2String(e.getGeomType()).c_str());
+        return false;
+    }
+
+    std::array<double, 3> c;
+    MathLib::Point3d const& n0(*e.getNode(0));
+    MathLib::Point3d const& n1(*e.getNode(1));
+    MathLib::Point3d const& n2(*e.getNode(2));
+    if (e.getGeomType() == MeshElemType::TRIANGLE)
+    {
+        if (!computeBarycentricCoordinatesXY(p, n0, n1, n2, eps, c))
+            return false;
+        weights = {{c[0], c[1], c[2], 0.0}};
+        return true;
+    }
+    // quad
+    if (computeBarycentricCoordinatesXY(p, n0, n1, n2, eps, c))
+    {
+        weights = {{c[0], c[1], c[2], 0.0}};
+        return true;
+    }
+    MathLib::Point3d const& n3(*e.getNode(3));
+    if (computeBarycentricCoordinatesXY(p, n0, n2, n3, eps, c))
+    {
+        weights = {{c[0], 0.0, c[1], c[2]}};
+        return true;
+    }
+    return false;
+}
+
 }
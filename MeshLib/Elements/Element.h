@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <array>
 #include <limits>
 #include <boost/optional.hpp>
 
@@ -230,4 +231,22 @@ protected:
 /// @return true if the \f$p' \in e'\f$ and false if \f$p' \notin e'\f$
 bool isPointInElementXY(MathLib::Point3d const& p, Element const& e);
 
+/// Computes the weights for the linear interpolation of values given at the
+/// base nodes of the element \c e at the point \f$p'\f$ within \f$e'\f$,
+/// where \f$p'\f$ and \f$e'\f$ are the orthogonal projections to the
+/// \f$x\f$-\f$y\f$ plane of the point \c p and the element \c e. The weights
+/// are the barycentric coordinates of \f$p'\f$ in the triangle \f$e'\f$ or in
+/// the triangle (0,1,2) or (0,2,3) of the quad \f$e'\f$. \todo At the moment
+/// the computation works only for triangle and quad elements.
+/// @param p \c MathLib::Point3d is the interpolation point
+/// @param e the element that is used for the request
+/// @param weights the weights of the base nodes of the element, the weights of
+/// unused entries are zero
+/// @param eps the barycentric coordinates may be at most eps outside of
+/// \f$[0,1]\f$
+/// @return true if \f$p' \in e'\f$ and false if \f$p' \notin e'\f$
+bool computeInterpolationWeightsXY(
+    MathLib::Point3d const& p, Element const& e, std::array<double, 4>& weights,
+    double eps = std::numeric_limits<float>::epsilon());
+
 } /* namespace */
@@ -0,0 +1,572 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "BinaryMeshIO.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/FileTools.h"
+#include "MeshLib/Elements/Elements.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+char const file_magic[8] = {'O', 'G', 'S', 'B', 'M', 'S', 'H', '\0'};
+std::uint32_t const byte_order_mark = 0x01020304;
+/// All arrays in the file start at multiples of the alignment.
+std::size_t const alignment = 8;
+
+struct FileHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order_mark;
+    std::uint64_t n_nodes;
+    std::uint64_t n_base_nodes;
+    std::uint64_t n_elements;
+    std::uint64_t n_connectivity;
+    std::uint64_t n_properties;
+    /// Number of bytes per node id in the connectivity, four or eight.
+    std::uint32_t node_id_size;
+    std::uint32_t name_length;
+};
+static_assert(sizeof(FileHeader) == 64, "Unexpected size of the file header.");
+
+struct PropertyHeader
+{
+    std::uint32_t name_length;
+    std::uint32_t value_type;
+    std::uint32_t value_size;
+    std::uint32_t mesh_item_type;
+    std::uint64_t n_components;
+    std::uint64_t n_values;
+};
+static_assert(sizeof(PropertyHeader) == 32,
+              "Unexpected size of the property header.");
+
+/// Value types of the property vectors. The value size is stored in the file
+/// separately, because the size of, e.g., long differs between platforms.
+enum class ValueType : std::uint32_t
+{
+    Double,
+    Float,
+    Int,
+    Unsigned,
+    Long,
+    UnsignedLong,
+    LongLong,
+    UnsignedLongLong,
+    Char,
+    UnsignedChar
+};
+
+ValueType getValueType(double) { return ValueType::Double; }
+ValueType getValueType(float) { return ValueType::Float; }
+ValueType getValueType(int) { return ValueType::Int; }
+ValueType getValueType(unsigned) { return ValueType::Unsigned; }
+ValueType getValueType(long) { return ValueType::Long; }
+ValueType getValueType(unsigned long) { return ValueType::UnsignedLong; }
+ValueType getValueType(long long) { return ValueType::LongLong; }
+ValueType getValueType(unsigned long long)
+{
+    return ValueType::UnsignedLongLong;
+}
+ValueType getValueType(char) { return ValueType::Char; }
+ValueType getValueType(unsigned char) { return ValueType::UnsignedChar; }
+
+std::size_t getPaddedSize(std::size_t const size)
+{
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+/// Writes arrays to the output stream, each padded to the alignment.
+class ArrayWriter final
+{
+public:
+    explicit ArrayWriter(std::ostream& os) : _os(os) {}
+
+    void write(void const* const data, std::size_t const size)
+    {
+        static char const padding[alignment] = {};
+        _os.write(static_cast<char const*>(data), size);
+        _os.write(padding, getPaddedSize(size) - size);
+    }
+
+    template <typename T>
+    void write(std::vector<T> const& values)
+    {
+        write(values.data(), values.size() * sizeof(T));
+    }
+
+private:
+    std::ostream& _os;
+};
+
+/// Returns pointers to the arrays of the mapped file in the order they are
+/// stored.
+class ArrayReader final
+{
+public:
+    ArrayReader(char const* const begin, std::size_t const size)
+        : _position(begin), _end(begin + size)
+    {
+    }
+
+    /// Returns a pointer to the next array of \c n values or a nullptr if the
+    /// file is too short.
+    template <typename T>
+    T const* read(std::size_t const n)
+    {
+        if (n > static_cast<std::size_t>(_end - _position) / sizeof(T))
+            return nullptr;
+        auto const size = n * sizeof(T);
+        auto const padded_size = getPaddedSize(size);
+        if (padded_size > static_cast<std::size_t>(_end - _position))
+            return nullptr;
+        auto const* const data = reinterpret_cast<T const*>(_position);
+        _position += padded_size;
+        return data;
+    }
+
+private:
+    char const* _position;
+    char const* const _end;
+};
+
+/// Writes the property vector \c name if it has value type \c T.
+template <typename T>
+bool writePropertyVector(MeshLib::Properties const& properties,
+                         std::string const& name, ArrayWriter& writer,
+                         std::uint64_t& n_properties)
+{
+    if (!properties.existsPropertyVector<T>(name))
+        return false;
+    auto const* const property = properties.getPropertyVector<T>(name);
+    if (!property)
+        return false;
+
+    PropertyHeader const header{
+        static_cast<std::uint32_t>(name.size()),
+        static_cast<std::uint32_t>(getValueType(T{})),
+        static_cast<std::uint32_t>(sizeof(T)),
+        static_cast<std::uint32_t>(property->getMeshItemType()),
+        property->getNumberOfComponents(), property->size()};
+    writer.write(&header, sizeof(header));
+    writer.write(name.data(), name.size());
+    writer.write(static_cast<std::vector<T> const&>(*property));
+    ++n_properties;
+    return true;
+}
+
+/// Copies the mapped values into a new property vector of the mesh.
+template <typename T>
+bool readPropertyVector(ArrayReader& reader, PropertyHeader const& header,
+                        std::string const& name,
+                        MeshLib::Properties& properties)
+{
+    if (header.value_size != sizeof(T))
+    {
+        ERR("BinaryMeshIO: Value size %u of property \"%s\" does not match "
+            "this platform.",
+            header.value_size, name.c_str());
+        return false;
+    }
+    auto const* const values = reader.read<T>(header.n_values);
+    if (!values)
+        return false;
+
+    auto* const property = properties.createNewPropertyVector<T>(
+        name, static_cast<MeshLib::MeshItemType>(header.mesh_item_type),
+        header.n_components);
+    if (!property)
+        return false;
+    property->assign(values, values + header.n_values);
+    return true;
+}
+
+bool readPropertyVector(ArrayReader& reader, MeshLib::Properties& properties)
+{
+    auto const* const header = reader.read<PropertyHeader>(1);
+    if (!header)
+        return false;
+    auto const* const name_chars = reader.read<char>(header->name_length);
+    if (!name_chars ||
+        header->mesh_item_type >
+            static_cast<std::uint32_t>(MeshLib::MeshItemType::IntegrationPoint))
+        return false;
+    std::string const name(name_chars, header->name_length);
+
+    switch (static_cast<ValueType>(header->value_type))
+    {
+        case ValueType::Double:
+            return readPropertyVector<double>(reader, *header, name,
+                                              properties);
+        case ValueType::Float:
+            return readPropertyVector<float>(reader, *header, name,
+                                             properties);
+        case ValueType::Int:
+            return readPropertyVector<int>(reader, *header, name, properties);
+        case ValueType::Unsigned:
+            return readPropertyVector<unsigned>(reader, *header, name,
+                                                properties);
+        case ValueType::Long:
+            return readPropertyVector<long>(reader, *header, name, properties);
+        case ValueType::UnsignedLong:
+            return readPropertyVector<unsigned long>(reader, *header, name,
+                                                     properties);
+        case ValueType::LongLong:
+            return readPropertyVector<long long>(reader, *header, name,
+                                                 properties);
+        case ValueType::UnsignedLongLong:
+            return readPropertyVector<unsigned long long>(reader, *header,
+                                                          name, properties);
+        case ValueType::Char:
+            return readPropertyVector<char>(reader, *header, name, properties);
+        case ValueType::UnsignedChar:
+            return readPropertyVector<unsigned char>(reader, *header, name,
+                                                     properties);
+    }
+    ERR("BinaryMeshIO: Unknown value type of property \"%s\".", name.c_str());
+    return false;
+}
+
+template <typename ElementType, typename NodeId>
+MeshLib::Element* createElement(std::vector<MeshLib::Node*> const& nodes,
+                                NodeId const* const ids, std::size_t const n_ids)
+{
+    if (n_ids != ElementType::n_all_nodes)
+        return nullptr;
+    auto** const element_nodes = new MeshLib::Node*[ElementType::n_all_nodes];
+    for (unsigned k = 0; k < ElementType::n_all_nodes; ++k)
+        element_nodes[k] = nodes[ids[k]];
+    return new ElementType(element_nodes);
+}
+
+/// Creates an element of the given cell type. Returns a nullptr for unknown
+/// cell types or a wrong number of nodes.
+template <typename NodeId>
+MeshLib::Element* createElement(MeshLib::CellType const cell_type,
+                                std::vector<MeshLib::Node*> const& nodes,
+                                NodeId const* const ids,
+                                std::size_t const n_ids)
+{
+    using namespace MeshLib;
+    switch (cell_type)
+    {
+        case CellType::POINT1:
+            return createElement<Point>(nodes, ids, n_ids);
+        case CellType::LINE2:
+            return createElement<Line>(nodes, ids, n_ids);
+        case CellType::LINE3:
+            return createElement<Line3>(nodes, ids, n_ids);
+        case CellType::TRI3:
+            return createElement<Tri>(nodes, ids, n_ids);
+        case CellType::TRI6:
+            return createElement<Tri6>(nodes, ids, n_ids);
+        case CellType::QUAD4:
+            return createElement<Quad>(nodes, ids, n_ids);
+        case CellType::QUAD8:
+            return createElement<Quad8>(nodes, ids, n_ids);
+        case CellType::QUAD9:
+            return createElement<Quad9>(nodes, ids, n_ids);
+        case CellType::TET4:
+            return createElement<Tet>(nodes, ids, n_ids);
+        case CellType::TET10:
+            return createElement<Tet10>(nodes, ids, n_ids);
+        case CellType::HEX8:
+            return createElement<Hex>(nodes, ids, n_ids);
+        case CellType::HEX20:
+            return createElement<Hex20>(nodes, ids, n_ids);
+        case CellType::PRISM6:
+            return createElement<Prism>(nodes, ids, n_ids);
+        case CellType::PRISM15:
+            return createElement<Prism15>(nodes, ids, n_ids);
+        case CellType::PYRAMID5:
+            return createElement<Pyramid>(nodes, ids, n_ids);
+        case CellType::PYRAMID13:
+            return createElement<Pyramid13>(nodes, ids, n_ids);
+        default:
+            return nullptr;
+    }
+}
+
+template <typename NodeId>
+bool createElements(std::vector<MeshLib::Node*> const& nodes,
+                    std::uint8_t const* const cell_types,
+                    std::uint64_t const* const offsets,
+                    NodeId const* const connectivity,
+                    std::size_t const n_connectivity,
+                    std::vector<MeshLib::Element*>& elements)
+{
+    bool valid_elements = true;
+    OPENMP_LOOP_TYPE const n_elements = elements.size();
+#pragma omp parallel for reduction(&& : valid_elements)
+    for (OPENMP_LOOP_TYPE i = 0; i < n_elements; ++i)
+    {
+        auto const begin = offsets[i];
+        auto const end = offsets[i + 1];
+        bool valid_ids = begin <= end && end <= n_connectivity;
+        for (auto k = begin; valid_ids && k < end; ++k)
+            valid_ids = connectivity[k] < nodes.size();
+        if (valid_ids)
+            elements[i] = createElement(
+                static_cast<MeshLib::CellType>(cell_types[i]), nodes,
+                connectivity + begin, end - begin);
+        valid_elements = valid_elements && elements[i] != nullptr;
+    }
+    return valid_elements;
+}
+
+template <typename NodeId>
+std::vector<NodeId> getConnectivity(MeshLib::Mesh const& mesh)
+{
+    std::vector<NodeId> connectivity;
+    for (auto const* const element : mesh.getElements())
+        for (unsigned k = 0; k < element->getNumberOfNodes(); ++k)
+            connectivity.push_back(element->getNodeIndex(k));
+    return connectivity;
+}
+
+MeshLib::Mesh* createMesh(char const* const data, std::size_t const size,
+                          std::string const& file_name)
+{
+    ArrayReader reader(data, size);
+    auto const* const header = reader.read<FileHeader>(1);
+    if (!header || std::memcmp(header->magic, file_magic, 8) != 0)
+    {
+        ERR("BinaryMeshIO: File \"%s\" is not a binary OGS mesh.",
+            file_name.c_str());
+        return nullptr;
+    }
+    if (header->byte_order_mark != byte_order_mark)
+    {
+        ERR("BinaryMeshIO: File \"%s\" was written with another byte order.",
+            file_name.c_str());
+        return nullptr;
+    }
+    if (header->version != MeshLib::IO::BinaryMeshIO::format_version)
+    {
+        ERR("BinaryMeshIO: File \"%s\" has format version %u, expected "
+            "version %u.",
+            file_name.c_str(), header->version,
+            MeshLib::IO::BinaryMeshIO::format_version);
+        return nullptr;
+    }
+
+    auto const* const name = reader.read<char>(header->name_length);
+    auto const* const coordinates = reader.read<double>(3 * header->n_nodes);
+    auto const* const cell_types =
+        reader.read<std::uint8_t>(header->n_elements);
+    auto const* const offsets =
+        reader.read<std::uint64_t>(header->n_elements + 1);
+    if (!name || !coordinates || !cell_types || !offsets ||
+        offsets[header->n_elements] != header->n_connectivity ||
+        header->n_base_nodes > header->n_nodes)
+    {
+        ERR("BinaryMeshIO: File \"%s\" is corrupted.", file_name.c_str());
+        return nullptr;
+    }
+
+    std::vector<MeshLib::Node*> nodes(header->n_nodes);
+    OPENMP_LOOP_TYPE const n_nodes = header->n_nodes;
+#pragma omp parallel for
+    for (OPENMP_LOOP_TYPE i = 0; i < n_nodes; ++i)
+        nodes[i] = new MeshLib::Node(coordinates + 3 * i, i);
+
+    std::vector<MeshLib::Element*> elements(header->n_elements, nullptr);
+    bool valid_elements = false;
+    if (header->node_id_size == sizeof(std::uint32_t))
+    {
+        auto const* const connectivity =
+            reader.read<std::uint32_t>(header->n_connectivity);
+        valid_elements =
+            connectivity && createElements(nodes, cell_types, offsets,
+                                           connectivity, header->n_connectivity,
+                                           elements);
+    }
+    else if (header->node_id_size == sizeof(std::uint64_t))
+    {
+        auto const* const connectivity =
+            reader.read<std::uint64_t>(header->n_connectivity);
+        valid_elements =
+            connectivity && createElements(nodes, cell_types, offsets,
+                                           connectivity, header->n_connectivity,
+                                           elements);
+    }
+    if (!valid_elements)
+    {
+        ERR("BinaryMeshIO: Invalid elements in file \"%s\".",
+            file_name.c_str());
+        for (auto* e : elements)
+            delete e;
+        for (auto* n : nodes)
+            delete n;
+        return nullptr;
+    }
+
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        new MeshLib::Mesh(std::string(name, header->name_length), nodes,
+                          elements, MeshLib::Properties(),
+                          header->n_base_nodes));
+
+    for (std::uint64_t i = 0; i < header->n_properties; ++i)
+    {
+        if (!readPropertyVector(reader, mesh->getProperties()))
+        {
+            ERR("BinaryMeshIO: Could not read property vector %zu from file "
+                "\"%s\".",
+                static_cast<std::size_t>(i), file_name.c_str());
+            return nullptr;
+        }
+    }
+    return mesh.release();
+}
+}  // namespace
+
+namespace MeshLib
+{
+namespace IO
+{
+const unsigned BinaryMeshIO::format_version = 1;
+
+MeshLib::Mesh* BinaryMeshIO::readMeshFromFile(std::string const& file_name)
+{
+    if (!BaseLib::IsFileExisting(file_name))
+    {
+        ERR("File \"%s\" does not exist.", file_name.c_str());
+        return nullptr;
+    }
+
+    namespace bip = boost::interprocess;
+    try
+    {
+        bip::file_mapping const mapping(file_name.c_str(), bip::read_only);
+        bip::mapped_region const region(mapping, bip::read_only);
+        return createMesh(static_cast<char const*>(region.get_address()),
+                          region.get_size(), file_name);
+    }
+    catch (bip::interprocess_exception const& e)
+    {
+        ERR("BinaryMeshIO: Could not map file \"%s\": %s", file_name.c_str(),
+            e.what());
+        return nullptr;
+    }
+}
+
+bool BinaryMeshIO::writeMeshToFile(MeshLib::Mesh const& mesh,
+                                   std::string const& file_name)
+{
+    std::ofstream os(file_name, std::ios::binary);
+    if (!os)
+    {
+        ERR("BinaryMeshIO: Could not open file \"%s\" for writing.",
+            file_name.c_str());
+        return false;
+    }
+
+    auto const& nodes = mesh.getNodes();
+    std::vector<double> coordinates;
+    coordinates.reserve(3 * nodes.size());
+    for (auto const* const node : nodes)
+        coordinates.insert(coordinates.end(), node->getCoords(),
+                           node->getCoords() + 3);
+
+    auto const& elements = mesh.getElements();
+    std::vector<std::uint8_t> cell_types;
+    std::vector<std::uint64_t> offsets{0};
+    cell_types.reserve(elements.size());
+    offsets.reserve(elements.size() + 1);
+    for (auto const* const element : elements)
+    {
+        cell_types.push_back(static_cast<std::uint8_t>(element->getCellType()));
+        offsets.push_back(offsets.back() + element->getNumberOfNodes());
+    }
+
+    bool const small_ids =
+        nodes.size() <= std::numeric_limits<std::uint32_t>::max();
+
+    FileHeader header{};
+    std::memcpy(header.magic, file_magic, 8);
+    header.version = format_version;
+    header.byte_order_mark = byte_order_mark;
+    header.n_nodes = nodes.size();
+    header.n_base_nodes = mesh.getNumberOfBaseNodes();
+    header.n_elements = elements.size();
+    header.n_connectivity = offsets.back();
+    header.node_id_size =
+        small_ids ? sizeof(std::uint32_t) : sizeof(std::uint64_t);
+    header.name_length = mesh.getName().size();
+
+    // The number of property vectors is known after writing them, hence the
+    // header is written again at the end.
+    ArrayWriter writer(os);
+    writer.write(&header, sizeof(header));
+    writer.write(mesh.getName().data(), mesh.getName().size());
+    writer.write(coordinates);
+    writer.write(cell_types);
+    writer.write(offsets);
+    if (small_ids)
+        writer.write(getConnectivity<std::uint32_t>(mesh));
+    else
+        writer.write(getConnectivity<std::uint64_t>(mesh));
+
+    auto const& properties = mesh.getProperties();
+    for (auto const& name : properties.getPropertyVectorNames())
+    {
+        if (writePropertyVector<double>(properties, name, writer,
+                                        header.n_properties) ||
+            writePropertyVector<float>(properties, name, writer,
+                                       header.n_properties) ||
+            writePropertyVector<int>(properties, name, writer,
+                                     header.n_properties) ||
+            writePropertyVector<unsigned>(properties, name, writer,
+                                          header.n_properties) ||
+            writePropertyVector<long>(properties, name, writer,
+                                      header.n_properties) ||
+            writePropertyVector<unsigned long>(properties, name, writer,
+                                               header.n_properties) ||
+            writePropertyVector<long long>(properties, name, writer,
+                                           header.n_properties) ||
+            writePropertyVector<unsigned long long>(properties, name, writer,
+                                                    header.n_properties) ||
+            writePropertyVector<char>(properties, name, writer,
+                                      header.n_properties) ||
+            writePropertyVector<unsigned char>(properties, name, writer,
+                                               header.n_properties))
+            continue;
+
+        WARN("BinaryMeshIO: Property vector \"%s\" of unsupported type is not "
+             "written.",
+             name.c_str());
+    }
+
+    os.seekp(0);
+    writer.write(&header, sizeof(header));
+
+    if (!os)
+    {
+        ERR("BinaryMeshIO: Writing to file \"%s\" failed.", file_name.c_str());
+        return false;
+    }
+    return true;
+}
+
+}  // end namespace IO
+}  // end namespace MeshLib
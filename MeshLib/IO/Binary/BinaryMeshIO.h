@@ -0,0 +1,53 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+
+namespace MeshLib
+{
+class Mesh;
+
+namespace IO
+{
+/**
+ * \brief Reads and writes meshes in the OGS binary mesh format (bmsh).
+ *
+ * A bmsh file consists of a fixed size header followed by the mesh name, the
+ * node coordinates, the cell types, the element offsets and the connectivity,
+ * and the property vectors. Every array is stored contiguously and aligned to
+ * eight bytes, such that the file can be mapped into memory and the mesh is
+ * created from the mapped arrays without any parsing.
+ *
+ * The connectivity is stored with 32 bit node ids if possible, and with 64
+ * bit ids otherwise. The data is stored in the byte order of the writing
+ * machine; files with another byte order or another format version are
+ * rejected.
+ */
+class BinaryMeshIO final
+{
+public:
+    /// Version of the file format, which is increased on every incompatible
+    /// change of the format.
+    static const unsigned format_version;
+
+    /// Reads a mesh from a bmsh file.
+    /// \return The mesh or a nullptr if reading failed
+    static MeshLib::Mesh* readMeshFromFile(std::string const& file_name);
+
+    /// Writes the mesh and all of its property vectors of arithmetic value
+    /// types to a bmsh file.
+    /// \return True on success, false on error
+    static bool writeMeshToFile(MeshLib::Mesh const& mesh,
+                                std::string const& file_name);
+};
+
+}  // end namespace IO
+}  // end namespace MeshLib
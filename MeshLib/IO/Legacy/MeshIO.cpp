@@ -26,6 +26,7 @@
 
 #include "BaseLib/FileTools.h"
 #include "BaseLib/StringTools.h"
+#include "BaseLib/TextTokenizer.h"
 
 #include "MeshLib/Elements/Elements.h"
 #include "MeshLib/Location.h"
@@ -81,13 +82,21 @@ MeshLib::Mesh* MeshIO::loadMeshFromFile(const std::string& file_name)
                 for (unsigned i = 0; i < nNodes; ++i)
                 {
                     getline(in, line_string);
-                    std::stringstream iss(line_string);
-                    iss >> idx >> x >> y >> z;
+                    BaseLib::TextTokenizer iss(line_string);
+                    if (!(iss.read(idx) && iss.read(x) && iss.read(y) &&
+                          iss.read(z)))
+                    {
+                        ERR("Reading mesh node %d from file \"%s\" failed.",
+                            i, file_name.c_str());
+                        std::for_each(nodes.begin(), nodes.end(),
+                            std::default_delete<MeshLib::Node>());
+                        return nullptr;
+                    }
                     MeshLib::Node* node(new MeshLib::Node(x, y, z, idx));
                     nodes.push_back(node);
-                    iss >> s;
+                    iss.readWord(s);
                     if (s.find("$AREA") != std::string::npos)
-                        iss >> double_dummy;
+                        iss.read(double_dummy);
                 }
             }
             else if (line_string.find("$ELEMENTS") != std::string::npos)
@@ -98,7 +107,7 @@ MeshLib::Mesh* MeshIO::loadMeshFromFile(const std::string& file_name)
                 for (unsigned i = 0; i < nElements; ++i)
                 {
                     getline(in, line_string);
-                    std::stringstream ss(line_string);
+                    BaseLib::TextTokenizer ss(line_string);
                     materials.push_back(readMaterialID(ss));
                     MeshLib::Element *elem(readElement(ss,nodes));
                     if (elem == nullptr) {
@@ -154,22 +163,22 @@ MeshLib::Mesh* MeshIO::loadMeshFromFile(const std::string& file_name)
     }
 }
 
-std::size_t MeshIO::readMaterialID(std::istream & in) const
+std::size_t MeshIO::readMaterialID(BaseLib::TextTokenizer& in) const
 {
     unsigned index, material_id;
-    if (!(in >> index >> material_id))
+    if (!(in.read(index) && in.read(material_id)))
         return std::numeric_limits<std::size_t>::max();
     return material_id;
 }
 
-MeshLib::Element* MeshIO::readElement(std::istream& in,
+MeshLib::Element* MeshIO::readElement(BaseLib::TextTokenizer& in,
     const std::vector<MeshLib::Node*> &nodes) const
 {
     std::string elem_type_str("");
     MeshLib::MeshElemType elem_type (MeshLib::MeshElemType::INVALID);
 
     do {
-        if (!(in >> elem_type_str))
+        if (!in.readWord(elem_type_str))
             return nullptr;
         elem_type = MeshLib::String2MeshElemType(elem_type_str);
     } while (elem_type == MeshLib::MeshElemType::INVALID);
@@ -181,7 +190,7 @@ MeshLib::Element* MeshIO::readElement(std::istream& in,
     {
     case MeshLib::MeshElemType::LINE: {
         for (int i = 0; i < 2; ++i)
-            if (!(in >> idx[i]))
+            if (!in.read(idx[i]))
                 return nullptr;
         // edge_nodes array will be deleted from Line object
         MeshLib::Node** edge_nodes = new MeshLib::Node*[2];
@@ -192,7 +201,7 @@ MeshLib::Element* MeshIO::readElement(std::istream& in,
     }
     case MeshLib::MeshElemType::TRIANGLE: {
         for (int i = 0; i < 3; ++i)
-            if (!(in >> idx[i]))
+            if (!in.read(idx[i]))
                 return nullptr;
         MeshLib::Node** tri_nodes = new MeshLib::Node*[3];
         for (unsigned k(0); k < 3; ++k)
@@ -202,7 +211,7 @@ MeshLib::Element* MeshIO::readElement(std::istream& in,
     }
     case MeshLib::MeshElemType::QUAD: {
         for (int i = 0; i < 4; ++i)
-            if (!(in >> idx[i]))
+            if (!in.read(idx[i]))
                 return nullptr;
         MeshLib::Node** quad_nodes = new MeshLib::Node*[4];
         for (unsigned k(0); k < 4; ++k)
@@ -212,7 +221,7 @@ MeshLib::Element* MeshIO::readElement(std::istream& in,
     }
     case MeshLib::MeshElemType::TETRAHEDRON: {
         for (int i = 0; i < 4; ++i)
-            if (!(in >> idx[i]))
+            if (!in.read(idx[i]))
                 return nullptr;
         MeshLib::Node** tet_nodes = new MeshLib::Node*[4];
         for (unsigned k(0); k < 4; ++k)
@@ -222,7 +231,7 @@ MeshLib::Element* MeshIO::readElement(std::istream& in,
     }
     case MeshLib::MeshElemType::HEXAHEDRON: {
         for (int i = 0; i < 8; ++i)
-            if (!(in >> idx[i]))
+            if (!in.read(idx[i]))
                 return nullptr;
         MeshLib::Node** hex_nodes = new MeshLib::Node*[8];
         for (unsigned k(0); k < 8; ++k)
@@ -232,7 +241,7 @@ MeshLib::Element* MeshIO::readElement(std::istream& in,
     }
     case MeshLib::MeshElemType::PYRAMID: {
         for (int i = 0; i < 5; ++i)
-            if (!(in >> idx[i]))
+            if (!in.read(idx[i]))
                 return nullptr;
         MeshLib::Node** pyramid_nodes = new MeshLib::Node*[5];
         for (unsigned k(0); k < 5; ++k)
@@ -242,7 +251,7 @@ MeshLib::Element* MeshIO::readElement(std::istream& in,
     }
     case MeshLib::MeshElemType::PRISM: {
         for (int i = 0; i < 6; ++i)
-            if (!(in >> idx[i]))
+            if (!in.read(idx[i]))
                 return nullptr;
         MeshLib::Node** prism_nodes = new MeshLib::Node*[6];
         for (unsigned k(0); k < 6; ++k)
@@ -20,6 +20,11 @@
 #include "BaseLib/IO/Writer.h"
 #include "MeshLib/MeshEnums.h"
 
+namespace BaseLib
+{
+class TextTokenizer;
+}
+
 namespace MeshLib
 {
 class Mesh;
@@ -55,8 +60,8 @@ private:
     void writeElements(std::vector<MeshLib::Element*> const& ele_vec,
                        MeshLib::PropertyVector<int> const* const material_ids,
                        std::ostream& out) const;
-    std::size_t readMaterialID(std::istream & in) const;
-    MeshLib::Element* readElement(std::istream& line, const std::vector<MeshLib::Node*> &nodes) const;
+    std::size_t readMaterialID(BaseLib::TextTokenizer& in) const;
+    MeshLib::Element* readElement(BaseLib::TextTokenizer& line, const std::vector<MeshLib::Node*> &nodes) const;
     std::string ElemType2StringOutput(const MeshLib::MeshElemType t) const;
 
     const MeshLib::Mesh* _mesh;
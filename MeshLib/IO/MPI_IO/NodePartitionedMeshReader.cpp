@@ -14,6 +14,13 @@
 
 #include "NodePartitionedMeshReader.h"
 
+#include <cstring>
+#include <exception>
+#include <sstream>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
 #include <logog/include/logog.hpp>
 
 #ifdef USE_PETSC
@@ -44,8 +51,9 @@ namespace MeshLib
 {
 namespace IO
 {
-NodePartitionedMeshReader::NodePartitionedMeshReader(MPI_Comm comm)
-    : _mpi_comm(comm)
+NodePartitionedMeshReader::NodePartitionedMeshReader(
+    MPI_Comm comm, bool const use_memory_mapping)
+    : _mpi_comm(comm), _use_memory_mapping(use_memory_mapping)
 {
     MPI_Comm_size(_mpi_comm, &_mpi_comm_size);
     MPI_Comm_rank(_mpi_comm, &_mpi_rank);
@@ -78,10 +86,18 @@ MeshLib::NodePartitionedMesh* NodePartitionedMeshReader::read(
     MeshLib::NodePartitionedMesh* mesh = nullptr;
 
     // Always try binary file first
+    std::string const fname_container = PartitionedMeshFormat::getFileName(
+        file_name_base, static_cast<std::size_t>(_mpi_comm_size));
     std::string const fname_new = file_name_base + "_partitioned_msh_cfg" +
         std::to_string(_mpi_comm_size) + ".bin";
 
-    if(!BaseLib::IsFileExisting(fname_new)) // doesn't exist binary file.
+    if (BaseLib::IsFileExisting(fname_container))
+    {
+        INFO("Reading binary mesh file %s ...", fname_container.c_str());
+
+        mesh = readContainer(fname_container, file_name_base);
+    }
+    else if(!BaseLib::IsFileExisting(fname_new)) // doesn't exist binary file.
     {
         INFO("Reading ASCII mesh file ...");
 
@@ -195,6 +211,372 @@ MeshLib::NodePartitionedMesh* NodePartitionedMeshReader::readBinary(
                    glb_node_ids, mesh_elems, p);
 }
 
+bool NodePartitionedMeshReader::isValidContainerHeader(
+    PartitionedMeshFormat::Header const& header) const
+{
+    if (std::memcmp(header.magic, PartitionedMeshFormat::magic,
+                    sizeof(header.magic)) != 0)
+    {
+        ERR("The file is not a partitioned OGS mesh.");
+        return false;
+    }
+    if (header.version != PartitionedMeshFormat::version)
+    {
+        ERR("Unsupported version %d of the partitioned mesh format, expected "
+            "version %d.",
+            header.version, PartitionedMeshFormat::version);
+        return false;
+    }
+    if (header.number_of_partitions !=
+        static_cast<unsigned long>(_mpi_comm_size))
+    {
+        ERR("The mesh has %d partitions, but %d processes are used.",
+            header.number_of_partitions, _mpi_comm_size);
+        return false;
+    }
+    return true;
+}
+
+MeshLib::NodePartitionedMesh* NodePartitionedMeshReader::readContainer(
+    std::string const& file_name, std::string const& file_name_base)
+{
+    if (_use_memory_mapping)
+        return readContainerMemoryMapped(file_name, file_name_base);
+
+    using PartitionedMeshFormat::Header;
+    using PartitionedMeshFormat::TableEntry;
+
+    MPI_File file;
+    char* filename_char = const_cast<char*>(file_name.data());
+    int const file_status = MPI_File_open(_mpi_comm, filename_char,
+            MPI_MODE_RDONLY, MPI_INFO_NULL, &file);
+    if (file_status != 0)
+    {
+        ERR("Error opening file %s. MPI error code %d", file_name.c_str(),
+            file_status);
+        return nullptr;
+    }
+    char file_mode[] = "native";
+
+    // Read the header and the table entry of this process at once.
+    char head[sizeof(Header) + sizeof(TableEntry)] = {};
+    int head_count = 0;
+    {
+        int block_lengths[2] = {sizeof(Header), sizeof(TableEntry)};
+        MPI_Aint displacements[2] = {
+            0, static_cast<MPI_Aint>(sizeof(Header) +
+                                     static_cast<unsigned>(_mpi_rank) *
+                                         sizeof(TableEntry))};
+        MPI_Datatype head_type;
+        MPI_Type_create_hindexed(2, block_lengths, displacements, MPI_BYTE,
+                                 &head_type);
+        MPI_Type_commit(&head_type);
+        MPI_File_set_view(file, 0, MPI_BYTE, head_type, file_mode,
+                          MPI_INFO_NULL);
+        MPI_Status status;
+        int const read_status = MPI_File_read_all(
+            file, head, sizeof(head), MPI_BYTE, &status);
+        if (read_status == MPI_SUCCESS)
+            MPI_Get_count(&status, MPI_BYTE, &head_count);
+        MPI_Type_free(&head_type);
+    }
+    Header header;
+    TableEntry entry;
+    std::memcpy(&header, head, sizeof(Header));
+    std::memcpy(&entry, head + sizeof(Header), sizeof(TableEntry));
+
+    // The data block has to be within the file before it is allocated.
+    MPI_Offset file_size = 0;
+    MPI_File_get_size(file, &file_size);
+    bool entry_ok = false;
+    if (head_count != static_cast<int>(sizeof(head)))
+    {
+        ERR("The file %s is too small.", file_name.c_str());
+    }
+    else if (isValidContainerHeader(header))
+    {
+        unsigned long const size = static_cast<unsigned long>(file_size);
+        entry_ok = entry.block_offset <= size &&
+                   entry.block_size <= size - entry.block_offset;
+        if (!entry_ok)
+        {
+            ERR("The data block of partition %d exceeds the file %s.",
+                _mpi_rank, file_name.c_str());
+        }
+    }
+
+    bool all_entries_ok;
+    MPI_Allreduce(&entry_ok, &all_entries_ok, 1, MPI_C_BOOL, MPI_LAND,
+                  _mpi_comm);
+    if (!all_entries_ok)
+    {
+        MPI_File_close(&file);
+        return nullptr;
+    }
+
+    // Read the data block of this process at once. The block is described by
+    // chunks of 1 MiB and a remainder, which avoids the limitation of the
+    // count argument of MPI_File_read_all() to int.
+    std::vector<char> block(entry.block_size);
+    bool read_ok = false;
+    {
+        unsigned long const chunk_size = 1 << 20;
+        MPI_Datatype chunk_type;
+        MPI_Type_contiguous(chunk_size, MPI_BYTE, &chunk_type);
+
+        int block_lengths[2] = {static_cast<int>(entry.block_size / chunk_size),
+                                static_cast<int>(entry.block_size % chunk_size)};
+        MPI_Aint displacements[2] = {
+            0, static_cast<MPI_Aint>(entry.block_size - block_lengths[1])};
+        MPI_Datatype types[2] = {chunk_type, MPI_BYTE};
+        MPI_Datatype block_type;
+        MPI_Type_create_struct(2, block_lengths, displacements, types,
+                               &block_type);
+        MPI_Type_commit(&block_type);
+
+        MPI_File_set_view(file, static_cast<MPI_Offset>(entry.block_offset),
+                          MPI_BYTE, MPI_BYTE, file_mode, MPI_INFO_NULL);
+        MPI_Status status;
+        int const read_status =
+            MPI_File_read_all(file, block.data(), 1, block_type, &status);
+        int block_count = 0;
+        if (read_status == MPI_SUCCESS)
+            MPI_Get_count(&status, block_type, &block_count);
+        MPI_Type_free(&block_type);
+        MPI_Type_free(&chunk_type);
+
+        read_ok = block_count == 1;
+        if (!read_ok)
+        {
+            ERR("Could not read the data block of partition %d from file %s.",
+                _mpi_rank, file_name.c_str());
+        }
+    }
+    MPI_File_close(&file);
+
+    MeshLib::NodePartitionedMesh* mesh = nullptr;
+    // All exceptions are caught, because every process has to take part in
+    // the reduction below.
+    try
+    {
+        if (read_ok)
+            mesh = createMeshFromBlock(
+                block.data(), entry, BaseLib::extractBaseName(file_name_base));
+    }
+    catch (std::exception const& e)
+    {
+        ERR("Could not read partition %d from file %s: %s", _mpi_rank,
+            file_name.c_str(), e.what());
+        read_ok = false;
+    }
+    catch (...)
+    {
+        ERR("Could not read partition %d from file %s.", _mpi_rank,
+            file_name.c_str());
+        read_ok = false;
+    }
+
+    bool all_read_ok;
+    MPI_Allreduce(&read_ok, &all_read_ok, 1, MPI_C_BOOL, MPI_LAND, _mpi_comm);
+    if (!all_read_ok)
+    {
+        delete mesh;
+        return nullptr;
+    }
+    return mesh;
+}
+
+MeshLib::NodePartitionedMesh*
+NodePartitionedMeshReader::readContainerMemoryMapped(
+    std::string const& file_name, std::string const& file_name_base)
+{
+    using PartitionedMeshFormat::Header;
+    using PartitionedMeshFormat::TableEntry;
+    namespace bip = boost::interprocess;
+
+    // Every process maps the file, such that processes on the same node share
+    // the pages of the file.
+    MeshLib::NodePartitionedMesh* mesh = nullptr;
+    bool read_ok = false;
+    // All exceptions are caught, because every process has to take part in
+    // the reduction below.
+    try
+    {
+        bip::file_mapping const mapping(file_name.c_str(), bip::read_only);
+        bip::mapped_region const region(mapping, bip::read_only);
+        char const* const data = static_cast<char const*>(region.get_address());
+        std::size_t const size = region.get_size();
+
+        unsigned long const entry_position =
+            sizeof(Header) +
+            static_cast<unsigned>(_mpi_rank) * sizeof(TableEntry);
+        Header header;
+        TableEntry entry;
+        if (size < entry_position + sizeof(TableEntry))
+        {
+            ERR("The file %s is too small.", file_name.c_str());
+        }
+        else
+        {
+            std::memcpy(&header, data, sizeof(Header));
+            std::memcpy(&entry, data + entry_position, sizeof(TableEntry));
+            if (isValidContainerHeader(header))
+            {
+                read_ok = entry.block_offset + entry.block_size <= size;
+                if (!read_ok)
+                {
+                    ERR("The data block of partition %d exceeds the file %s.",
+                        _mpi_rank, file_name.c_str());
+                }
+            }
+        }
+
+        if (read_ok)
+            mesh = createMeshFromBlock(
+                data + entry.block_offset, entry,
+                BaseLib::extractBaseName(file_name_base));
+    }
+    catch (bip::interprocess_exception const& e)
+    {
+        ERR("Could not map file %s: %s", file_name.c_str(), e.what());
+        read_ok = false;
+    }
+    catch (std::exception const& e)
+    {
+        ERR("Could not read partition %d from file %s: %s", _mpi_rank,
+            file_name.c_str(), e.what());
+        read_ok = false;
+    }
+    catch (...)
+    {
+        ERR("Could not read partition %d from file %s.", _mpi_rank,
+            file_name.c_str());
+        read_ok = false;
+    }
+
+    bool all_read_ok;
+    MPI_Allreduce(&read_ok, &all_read_ok, 1, MPI_C_BOOL, MPI_LAND, _mpi_comm);
+    if (!all_read_ok)
+    {
+        delete mesh;
+        return nullptr;
+    }
+    return mesh;
+}
+
+MeshLib::NodePartitionedMesh* NodePartitionedMeshReader::createMeshFromBlock(
+    char const* block, PartitionedMeshFormat::TableEntry const& entry,
+    std::string const& mesh_name)
+{
+    std::copy_n(entry.mesh_info, _mesh_info.size(), _mesh_info.data());
+
+    //----------------------------------------------------------------------------------
+    // Property meta data
+    std::istringstream meta_data(
+        std::string(block, entry.property_meta_data_size));
+    std::vector<MeshLib::IO::PropertyVectorMetaData> vec_pvmd;
+    for (std::size_t i = 0; i < entry.number_of_properties; ++i)
+    {
+        auto const pvmd = MeshLib::IO::readPropertyVectorMetaData(meta_data);
+        if (!pvmd)
+        {
+            OGS_FATAL(
+                "Error in NodePartitionedMeshReader::createMeshFromBlock: "
+                "Could not read the meta data for the PropertyVector %d",
+                i);
+        }
+        vec_pvmd.push_back(*pvmd);
+    }
+
+    unsigned long const nodes_end =
+        _mesh_info.offset[2] + _mesh_info.nodes * sizeof(NodeData);
+    unsigned long const elements_end =
+        _mesh_info.offset[3] +
+        (_mesh_info.regular_elements + _mesh_info.offset[0]) *
+            sizeof(unsigned long);
+    unsigned long const ghost_elements_end =
+        _mesh_info.offset[4] +
+        (_mesh_info.ghost_elements + _mesh_info.offset[1]) *
+            sizeof(unsigned long);
+    unsigned long block_end = ghost_elements_end;
+    for (auto const& pvmd : vec_pvmd)
+        block_end += pvmd.data_type_size_in_bytes * pvmd.number_of_tuples *
+                     pvmd.number_of_components;
+    if (_mesh_info.offset[2] < entry.property_meta_data_size ||
+        nodes_end > _mesh_info.offset[3] ||
+        elements_end > _mesh_info.offset[4] || block_end > entry.block_size)
+    {
+        OGS_FATAL(
+            "Error in NodePartitionedMeshReader::createMeshFromBlock: The "
+            "data of partition %d is inconsistent with its data block.",
+            _mpi_rank);
+    }
+
+    //----------------------------------------------------------------------------------
+    // Nodes
+    std::vector<NodeData> nodes(_mesh_info.nodes);
+    std::memcpy(nodes.data(), block + _mesh_info.offset[2],
+                nodes.size() * sizeof(NodeData));
+
+    std::vector<MeshLib::Node*> mesh_nodes;
+    std::vector<unsigned long> glb_node_ids;
+    setNodes(nodes, mesh_nodes, glb_node_ids);
+
+    //----------------------------------------------------------------------------------
+    // Non-ghost and ghost elements
+    std::vector<unsigned long> elem_data(
+        _mesh_info.regular_elements + _mesh_info.offset[0]);
+    std::memcpy(elem_data.data(), block + _mesh_info.offset[3],
+                elem_data.size() * sizeof(unsigned long));
+
+    std::vector<MeshLib::Element*> mesh_elems(
+        _mesh_info.regular_elements + _mesh_info.ghost_elements);
+    setElements(mesh_nodes, elem_data, mesh_elems);
+
+    std::vector<unsigned long> ghost_elem_data(
+        _mesh_info.ghost_elements + _mesh_info.offset[1]);
+    std::memcpy(ghost_elem_data.data(), block + _mesh_info.offset[4],
+                ghost_elem_data.size() * sizeof(unsigned long));
+
+    const bool process_ghost = true;
+    setElements(mesh_nodes, ghost_elem_data, mesh_elems, process_ghost);
+
+    //----------------------------------------------------------------------------------
+    // Property values following the ghost elements
+    char const* values = block + ghost_elements_end;
+    MeshLib::Properties p;
+    for (auto const& pvmd : vec_pvmd)
+    {
+        if (pvmd.is_int_type)
+        {
+            if (pvmd.is_data_type_signed)
+            {
+                if (pvmd.data_type_size_in_bytes == sizeof(int))
+                    createPropertyVectorPart<int>(values, pvmd, p);
+                if (pvmd.data_type_size_in_bytes == sizeof(long))
+                    createPropertyVectorPart<long>(values, pvmd, p);
+            }
+            else
+            {
+                if (pvmd.data_type_size_in_bytes == sizeof(unsigned int))
+                    createPropertyVectorPart<unsigned int>(values, pvmd, p);
+                if (pvmd.data_type_size_in_bytes == sizeof(unsigned long))
+                    createPropertyVectorPart<unsigned long>(values, pvmd, p);
+            }
+        }
+        else
+        {
+            if (pvmd.data_type_size_in_bytes == sizeof(float))
+                createPropertyVectorPart<float>(values, pvmd, p);
+            if (pvmd.data_type_size_in_bytes == sizeof(double))
+                createPropertyVectorPart<double>(values, pvmd, p);
+        }
+        values += pvmd.data_type_size_in_bytes * pvmd.number_of_tuples *
+                  pvmd.number_of_components;
+    }
+    return newMesh(mesh_name, mesh_nodes, glb_node_ids, mesh_elems, p);
+}
+
 MeshLib::Properties NodePartitionedMeshReader::readPropertiesBinary(
     const std::string& file_name_base) const
 {
@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iosfwd>
 #include <string>
 #include <vector>
@@ -21,6 +22,7 @@
 
 #include "MeshLib/NodePartitionedMesh.h"
 #include "MeshLib/Properties.h"
+#include "MeshLib/IO/MPI_IO/PartitionedMeshFormat.h"
 #include "MeshLib/IO/MPI_IO/PropertyVectorMetaData.h"
 
 namespace MeshLib
@@ -37,14 +39,20 @@ class NodePartitionedMeshReader
 {
 public:
     ///  \param comm   MPI communicator.
-    NodePartitionedMeshReader(MPI_Comm comm);
+    ///  \param use_memory_mapping If set, a single file partitioned mesh is
+    ///         mapped into the memory of each process instead of being read
+    ///         with collective MPI-IO calls.
+    explicit NodePartitionedMeshReader(MPI_Comm comm,
+                                       bool const use_memory_mapping = false);
 
     ~NodePartitionedMeshReader();
 
     /*!
          \brief Create a NodePartitionedMesh object, read data to it,
                 and return a pointer to it. Data files are either in
-                ASCII format or binary format.
+                ASCII format or binary format. A single file binary mesh
+                (see PartitionedMeshFormat) is preferred over the legacy
+                binary files, which are preferred over the ASCII files.
          \param file_name_base  Name of file to be read, and it must be base name without name extension.
          \return                Pointer to Mesh object. If the creation of mesh object
                                 fails, return a null pointer.
@@ -61,6 +69,9 @@ private:
     /// Rank of compute core.
     int _mpi_rank;
 
+    /// Map the single file partitioned mesh instead of reading it via MPI-IO.
+    bool const _use_memory_mapping;
+
     /// MPI data type for struct NodeData.
     MPI_Datatype _mpi_node_type;
 
@@ -167,6 +178,52 @@ private:
 
     MeshLib::Properties readPropertiesBinary(const std::string& file_name_base) const;
 
+    /*!
+         \brief Create a NodePartitionedMesh object from a single file
+                partitioned mesh, see PartitionedMeshFormat.
+
+                Each process reads the file header and its table entry with
+                one collective call and its data block with a second one. If
+                memory mapping is enabled, the file is mapped instead and the
+                data block is taken directly from the mapped memory.
+         \param file_name       Name of the single file partitioned mesh.
+         \param file_name_base  Name of the mesh without file extension.
+         \return Pointer to Mesh object or nullptr on failure.
+     */
+    MeshLib::NodePartitionedMesh* readContainer(
+        std::string const& file_name, std::string const& file_name_base);
+
+    MeshLib::NodePartitionedMesh* readContainerMemoryMapped(
+        std::string const& file_name, std::string const& file_name_base);
+
+    /// Check the header of a single file partitioned mesh.
+    bool isValidContainerHeader(
+        PartitionedMeshFormat::Header const& header) const;
+
+    /*!
+         \brief Create the mesh from the data block of this process.
+         \param block      The data block of the partition.
+         \param entry      The table entry of the partition.
+         \param mesh_name  Name assigned to the new mesh.
+     */
+    MeshLib::NodePartitionedMesh* createMeshFromBlock(
+        char const* block, PartitionedMeshFormat::TableEntry const& entry,
+        std::string const& mesh_name);
+
+    template <typename T>
+    void createPropertyVectorPart(
+        char const* values, MeshLib::IO::PropertyVectorMetaData const& pvmd,
+        MeshLib::Properties& p) const
+    {
+        MeshLib::PropertyVector<T>* pv =
+            p.createNewPropertyVector<T>(pvmd.property_name,
+                                         MeshLib::MeshItemType::Node,
+                                         pvmd.number_of_components);
+        pv->resize(pvmd.number_of_tuples * pvmd.number_of_components);
+        std::copy_n(values, pv->size() * sizeof(T),
+                    reinterpret_cast<char*>(pv->data()));
+    }
+
     template <typename T>
     void createPropertyVectorPart(
         std::istream& is, MeshLib::IO::PropertyVectorMetaData const& pvmd,
@@ -0,0 +1,77 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+
+namespace MeshLib
+{
+namespace IO
+{
+/// Layout of the single file container of a node-wise partitioned mesh.
+///
+/// The file starts with a Header, followed by a table with one TableEntry per
+/// partition and the data blocks of the partitions. The table entry of a
+/// partition holds the partition's configuration and the position of its data
+/// block, such that every process reads its table entry and afterwards its
+/// whole data block at once.
+///
+/// The data block of a partition consists of
+/// 1. the meta data of the property vectors (PropertyVectorMetaData),
+/// 2. the nodes, each of which is a global node id followed by three
+///    coordinates,
+/// 3. the integer variables of the non-ghost elements and
+/// 4. of the ghost elements, both as in the legacy binary element files,
+/// 5. the values of the property vectors at the nodes of the partition in the
+///    order of their meta data.
+namespace PartitionedMeshFormat
+{
+char const magic[8] = {'O', 'G', 'S', 'P', 'M', 'S', 'H', '\0'};
+unsigned long const version = 1;
+
+struct Header
+{
+    char magic[8];
+    unsigned long version;
+    unsigned long number_of_partitions;
+};
+
+struct TableEntry
+{
+    /// Configuration of the partition, which has the same layout as the
+    /// entries of the legacy _partitioned_msh_cfg files. The entries 10 to 12
+    /// are the positions of the nodes, the non-ghost and the ghost elements
+    /// within the data block.
+    unsigned long mesh_info[14];
+    /// Position of the data block in the file.
+    unsigned long block_offset;
+    /// Size of the data block in bytes.
+    unsigned long block_size;
+    unsigned long number_of_properties;
+    /// Size of the property meta data at the beginning of the data block.
+    unsigned long property_meta_data_size;
+};
+
+/// Both structs contain no padding and are read as bytes.
+static_assert(sizeof(Header) == 8 + 2 * sizeof(unsigned long),
+              "Unexpected size of the header.");
+static_assert(sizeof(TableEntry) == 18 * sizeof(unsigned long),
+              "Unexpected size of the table entry.");
+
+inline std::string getFileName(std::string const& file_name_base,
+                               std::size_t const number_of_partitions)
+{
+    return file_name_base + "_partitioned_msh" +
+           std::to_string(number_of_partitions) + ".bin";
+}
+}  // namespace PartitionedMeshFormat
+
+}  // end namespace IO
+}  // end namespace MeshLib
@@ -0,0 +1,302 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "VtuBinaryData.h"
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <ostream>
+
+#include <vtk_zlib.h>
+
+namespace
+{
+char const base64_alphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/// Streaming base64 encoder. Bytes which do not complete a group of three are
+/// kept until the next write() or finish().
+class Base64Encoder final
+{
+public:
+    explicit Base64Encoder(std::ostream& os) : _os(os) {}
+
+    void write(unsigned char const* data, std::size_t size)
+    {
+        while (_n_pending > 0 && _n_pending < 3 && size > 0)
+        {
+            _pending[_n_pending++] = *data++;
+            --size;
+        }
+        if (_n_pending == 3)
+        {
+            encodeGroups(_pending.data(), 3);
+            _n_pending = 0;
+        }
+
+        std::size_t const n_full = size / 3 * 3;
+        encodeGroups(data, n_full);
+        for (std::size_t i = n_full; i < size; ++i)
+            _pending[_n_pending++] = data[i];
+    }
+
+    void finish()
+    {
+        if (_n_pending == 0)
+            return;
+
+        std::array<unsigned char, 3> group{{0, 0, 0}};
+        std::copy_n(_pending.begin(), _n_pending, group.begin());
+        char out[4];
+        encodeGroup(group.data(), out);
+        if (_n_pending == 1)
+            out[2] = '=';
+        out[3] = '=';
+        _os.write(out, 4);
+        _n_pending = 0;
+    }
+
+private:
+    static void encodeGroup(unsigned char const* const in, char* const out)
+    {
+        out[0] = base64_alphabet[in[0] >> 2];
+        out[1] = base64_alphabet[((in[0] & 0x03) << 4) | (in[1] >> 4)];
+        out[2] = base64_alphabet[((in[1] & 0x0f) << 2) | (in[2] >> 6)];
+        out[3] = base64_alphabet[in[2] & 0x3f];
+    }
+
+    /// Encodes \c size bytes, a multiple of three, in chunks.
+    void encodeGroups(unsigned char const* const data, std::size_t const size)
+    {
+        std::size_t const chunk_size = 3 * 4096;
+        char buffer[4 * 4096];
+        for (std::size_t begin = 0; begin < size; begin += chunk_size)
+        {
+            std::size_t const end = std::min(size, begin + chunk_size);
+            char* out = buffer;
+            for (std::size_t i = begin; i < end; i += 3, out += 4)
+                encodeGroup(data + i, out);
+            _os.write(buffer, out - buffer);
+        }
+    }
+
+    std::ostream& _os;
+    std::array<unsigned char, 3> _pending;
+    std::size_t _n_pending = 0;
+};
+
+int decodeBase64Character(char const c)
+{
+    if (c >= 'A' && c <= 'Z')
+        return c - 'A';
+    if (c >= 'a' && c <= 'z')
+        return c - 'a' + 26;
+    if (c >= '0' && c <= '9')
+        return c - '0' + 52;
+    if (c == '+')
+        return 62;
+    if (c == '/')
+        return 63;
+    return -1;
+}
+
+bool isWhitespace(char const c)
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+unsigned char const* asBytes(std::uint64_t const* const words)
+{
+    return reinterpret_cast<unsigned char const*>(words);
+}
+}  // namespace
+
+namespace MeshLib
+{
+namespace IO
+{
+namespace VtuBinaryData
+{
+EncodedArray encode(unsigned char const* const data, std::size_t const size,
+                    bool const compress)
+{
+    EncodedArray encoded;
+    if (!compress)
+    {
+        encoded.header = {size};
+        encoded.data = data;
+        encoded.data_size = size;
+        return encoded;
+    }
+
+    std::size_t const n_blocks =
+        (size + compression_block_size - 1) / compression_block_size;
+    std::vector<std::vector<unsigned char>> blocks(n_blocks);
+
+    OPENMP_LOOP_TYPE const n = n_blocks;
+#pragma omp parallel for schedule(dynamic)
+    for (OPENMP_LOOP_TYPE b = 0; b < n; ++b)
+    {
+        std::size_t const begin = b * compression_block_size;
+        std::size_t const block_size =
+            std::min(compression_block_size, size - begin);
+        uLongf compressed_size = compressBound(block_size);
+        blocks[b].resize(compressed_size);
+        // Compression cannot fail for a buffer of compressBound() bytes.
+        compress2(blocks[b].data(), &compressed_size, data + begin, block_size,
+                  Z_DEFAULT_COMPRESSION);
+        blocks[b].resize(compressed_size);
+    }
+
+    encoded.compressed = true;
+    encoded.header.reserve(3 + n_blocks);
+    encoded.header.push_back(n_blocks);
+    encoded.header.push_back(compression_block_size);
+    encoded.header.push_back(size % compression_block_size);
+    for (auto const& block : blocks)
+        encoded.header.push_back(block.size());
+
+    encoded.compressed_data.reserve(
+        std::accumulate(encoded.header.begin() + 3, encoded.header.end(),
+                        std::size_t{0}));
+    for (auto& block : blocks)
+    {
+        encoded.compressed_data.insert(encoded.compressed_data.end(),
+                                       block.begin(), block.end());
+        std::vector<unsigned char>().swap(block);
+    }
+    encoded.data = encoded.compressed_data.data();
+    encoded.data_size = encoded.compressed_data.size();
+    return encoded;
+}
+
+std::size_t getRawSize(EncodedArray const& encoded)
+{
+    return encoded.header.size() * sizeof(std::uint64_t) + encoded.data_size;
+}
+
+std::size_t getBase64Size(EncodedArray const& encoded)
+{
+    std::size_t const header_size =
+        encoded.header.size() * sizeof(std::uint64_t);
+    if (!encoded.compressed)
+        return getBase64Length(header_size + encoded.data_size);
+    return getBase64Length(header_size) + getBase64Length(encoded.data_size);
+}
+
+void writeRaw(std::ostream& os, EncodedArray const& encoded)
+{
+    os.write(reinterpret_cast<char const*>(encoded.header.data()),
+             encoded.header.size() * sizeof(std::uint64_t));
+    os.write(reinterpret_cast<char const*>(encoded.data), encoded.data_size);
+}
+
+void writeBase64(std::ostream& os, EncodedArray const& encoded)
+{
+    Base64Encoder encoder(os);
+    encoder.write(asBytes(encoded.header.data()),
+                  encoded.header.size() * sizeof(std::uint64_t));
+    // The header of compressed data is encoded separately.
+    if (encoded.compressed)
+        encoder.finish();
+    encoder.write(encoded.data, encoded.data_size);
+    encoder.finish();
+}
+
+bool decodeBase64(char const* const text, std::size_t const length,
+                  std::vector<unsigned char>& data)
+{
+    data.clear();
+    data.reserve(length / 4 * 3);
+
+    unsigned value = 0;
+    unsigned n_bits = 0;
+    std::size_t n_padding = 0;
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        char const c = text[i];
+        if (isWhitespace(c))
+            continue;
+        if (c == '=')
+        {
+            ++n_padding;
+            continue;
+        }
+        int const d = decodeBase64Character(c);
+        if (d < 0)
+            return false;
+        // Characters after padding only occur if separately encoded parts are
+        // concatenated.
+        if (n_padding > 0)
+        {
+            value = 0;
+            n_bits = 0;
+            n_padding = 0;
+        }
+
+        value = (value << 6) | static_cast<unsigned>(d);
+        n_bits += 6;
+        if (n_bits >= 8)
+        {
+            n_bits -= 8;
+            data.push_back(static_cast<unsigned char>(value >> n_bits));
+            value &= (1u << n_bits) - 1;
+        }
+    }
+    return true;
+}
+
+bool decompress(std::vector<std::uint64_t> const& header,
+                unsigned char const* const compressed_data,
+                std::size_t const compressed_size, unsigned char* const data,
+                std::size_t const size)
+{
+    if (header.size() < 3 || header.size() != 3 + header[0])
+        return false;
+
+    std::size_t const n_blocks = header[0];
+    std::size_t const block_size = header[1];
+    std::size_t const last_block_size = header[2];
+    if (n_blocks == 0)
+        return size == 0;
+
+    std::size_t const total_size =
+        last_block_size == 0 ? n_blocks * block_size
+                             : (n_blocks - 1) * block_size + last_block_size;
+    if (total_size != size)
+        return false;
+
+    std::vector<std::size_t> offsets(n_blocks + 1, 0);
+    std::partial_sum(header.begin() + 3, header.end(), offsets.begin() + 1);
+    if (offsets.back() > compressed_size)
+        return false;
+
+    bool success = true;
+    OPENMP_LOOP_TYPE const n = n_blocks;
+#pragma omp parallel for schedule(dynamic) reduction(&& : success)
+    for (OPENMP_LOOP_TYPE b = 0; b < n; ++b)
+    {
+        std::size_t const expected_size =
+            (static_cast<std::size_t>(b) + 1 == n_blocks && last_block_size != 0)
+                ? last_block_size
+                : block_size;
+        uLongf uncompressed_size = expected_size;
+        int const result = uncompress(
+            data + b * block_size, &uncompressed_size,
+            compressed_data + offsets[b], offsets[b + 1] - offsets[b]);
+        success = success && result == Z_OK &&
+                  uncompressed_size == expected_size;
+    }
+    return success;
+}
+
+}  // namespace VtuBinaryData
+}  // namespace IO
+}  // namespace MeshLib
@@ -0,0 +1,89 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ * \brief Encoding of the binary data arrays of VTK XML files.
+ *
+ * A binary data array is stored as a header followed by the data. The header
+ * words are of the file's header type (UInt32 or UInt64). Uncompressed data
+ * has a header consisting of the number of data bytes. Compressed data is
+ * split into blocks which are compressed independently. Its header consists of
+ * the number of blocks, the uncompressed block size, the uncompressed size of
+ * the last block (zero if it is a full block), and the compressed size of each
+ * block.
+ *
+ * In base64 encoded files the header of uncompressed data is encoded together
+ * with the data, whereas the header of compressed data is encoded separately.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace MeshLib
+{
+namespace IO
+{
+namespace VtuBinaryData
+{
+/// Uncompressed size of the blocks of compressed data arrays, as used by VTK.
+std::size_t const compression_block_size = 32768;
+
+/// Data array in the form stored in the file: a header with 64 bit words and
+/// the (compressed) data. For uncompressed data \c data points to the
+/// original array.
+struct EncodedArray
+{
+    bool compressed = false;
+    std::vector<std::uint64_t> header;
+    std::vector<unsigned char> compressed_data;
+    unsigned char const* data = nullptr;
+    std::size_t data_size = 0;
+};
+
+/// Prepares the \c size bytes at \c data for writing. If \c compress is set,
+/// the data is split into blocks which are compressed concurrently with zlib.
+EncodedArray encode(unsigned char const* const data, std::size_t const size,
+                    bool const compress);
+
+/// Size in bytes of the \c encoded array in the file, when written in raw
+/// binary form or base64 encoded, respectively.
+std::size_t getRawSize(EncodedArray const& encoded);
+std::size_t getBase64Size(EncodedArray const& encoded);
+
+/// Writes the \c encoded array to \c os in raw binary form or base64
+/// encoded, respectively.
+void writeRaw(std::ostream& os, EncodedArray const& encoded);
+void writeBase64(std::ostream& os, EncodedArray const& encoded);
+
+/// Number of characters of \c size bytes encoded in base64.
+inline std::size_t getBase64Length(std::size_t const size)
+{
+    return (size + 2) / 3 * 4;
+}
+
+/// Decodes the base64 encoded \c text of the given length into \c data.
+/// Whitespace is skipped.
+/// \return false if \c text is not valid base64.
+bool decodeBase64(char const* const text, std::size_t const length,
+                  std::vector<unsigned char>& data);
+
+/// Decompresses the zlib compressed blocks described by the \c header into
+/// \c data, which must hold \c size bytes. The blocks are decompressed
+/// concurrently.
+/// \return false if the data is corrupted or does not have the expected size.
+bool decompress(std::vector<std::uint64_t> const& header,
+                unsigned char const* const compressed_data,
+                std::size_t const compressed_size, unsigned char* const data,
+                std::size_t const size);
+
+}  // namespace VtuBinaryData
+}  // namespace IO
+}  // namespace MeshLib
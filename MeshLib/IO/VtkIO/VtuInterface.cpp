@@ -35,6 +35,9 @@
 #include "MeshLib/MeshGenerators/VtkMeshConverter.h"
 #include "MeshLib/Vtk/VtkMappedMeshSource.h"
 
+#include "VtuReader.h"
+#include "VtuWriter.h"
+
 namespace MeshLib
 {
 namespace IO
@@ -54,6 +57,12 @@ MeshLib::Mesh* VtuInterface::readVTUFile(std::string const &file_name)
         return nullptr;
     }
 
+#ifdef OGS_USE_NATIVE_VTU_IO
+    if (auto* const mesh = VtuReader::readVTUFile(file_name))
+        return mesh;
+    DBUG("Reading file \"%s\" with the VTK reader.", file_name.c_str());
+#endif
+
     vtkSmartPointer<vtkXMLUnstructuredGridReader> reader =
         vtkSmartPointer<vtkXMLUnstructuredGridReader>::New();
     reader->SetFileName(file_name.c_str());
@@ -87,7 +96,14 @@ bool VtuInterface::writeToFile(std::string const &file_name)
 
     const std::string file_name_rank = vtu_file_name + "_"
                                        + std::to_string(mpi_rank) + ".vtu";
+#ifdef OGS_USE_NATIVE_VTU_IO
+    bool vtu_status_i =
+        _data_mode == vtkXMLWriter::Ascii
+            ? writeVTU<vtkXMLUnstructuredGridWriter>(file_name_rank)
+            : writeVTUDirectly(file_name_rank);
+#else
     bool vtu_status_i = writeVTU<vtkXMLUnstructuredGridWriter>(file_name_rank);
+#endif
     bool vtu_status = false;
     MPI_Allreduce(&vtu_status_i, &vtu_status, 1, MPI_C_BOOL, MPI_LAND, PETSC_COMM_WORLD);
 
@@ -103,8 +119,28 @@ bool VtuInterface::writeToFile(std::string const &file_name)
     return vtu_status && pvtu_status;
 
 #else
+#ifdef OGS_USE_NATIVE_VTU_IO
+    if (_data_mode != vtkXMLWriter::Ascii)
+        return writeVTUDirectly(file_name);
+#endif
     return writeVTU<vtkXMLUnstructuredGridWriter>(file_name);
 #endif
 }
+
+bool VtuInterface::writeVTUDirectly(std::string const& file_name) const
+{
+    if (!_mesh)
+    {
+        ERR("VtuInterface::write(): No mesh specified.");
+        return false;
+    }
+
+    // Appended data is base64 encoded as done for the VTK writer.
+    auto const data_mode = _data_mode == vtkXMLWriter::Appended
+                               ? VtuWriter::DataMode::Appended
+                               : VtuWriter::DataMode::Binary;
+    return VtuWriter(*_mesh, data_mode, _use_compressor)
+        .writeToFile(file_name);
+}
 } // end namespace IO
 } // end namespace MeshLib
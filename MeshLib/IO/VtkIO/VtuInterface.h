@@ -34,11 +34,15 @@ public:
     /// Provide the mesh to write and set if compression should be used.
     VtuInterface(const MeshLib::Mesh* mesh, int dataMode = vtkXMLWriter::Binary, bool compressed = false);
 
-    /// Read an unstructured grid from a VTU file
+    /// Read an unstructured grid from a VTU file. If OGS_USE_NATIVE_VTU_IO is
+    /// enabled, binary files are read directly by the VtuReader; other files
+    /// are read with VTK.
     /// \return The converted mesh or a nullptr if reading failed
     static MeshLib::Mesh* readVTUFile(std::string const &file_name);
 
-    /// Writes the given mesh to file.
+    /// Writes the given mesh to file. If OGS_USE_NATIVE_VTU_IO is enabled, the
+    /// file is written directly by the VtuWriter in binary and appended data
+    /// mode; otherwise, and for ascii files, it is written with VTK.
     /// \return True on success, false on error
     bool writeToFile(std::string const &file_name);
 
@@ -49,6 +53,9 @@ public:
     template<typename UnstructuredGridWriter> bool writeVTU(std::string const &file_name, const int num_partitions = 1);
 
 private:
+    /// Writes the mesh to a vtu file with the VtuWriter.
+    bool writeVTUDirectly(std::string const& file_name) const;
+
     const MeshLib::Mesh* _mesh;
     int _data_mode;
     bool _use_compressor;
@@ -0,0 +1,762 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "VtuReader.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include <vtkCellType.h>
+
+#include <logog/include/logog.hpp>
+
+#include "RapidXML/rapidxml.hpp"
+
+#include "BaseLib/FileTools.h"
+#include "MeshLib/Elements/Elements.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+
+#include "VtuBinaryData.h"
+
+namespace
+{
+using XmlNode = rapidxml::xml_node<>;
+
+char const* getAttribute(XmlNode const& node, char const* const name)
+{
+    auto const* const attribute = node.first_attribute(name);
+    return attribute ? attribute->value() : nullptr;
+}
+
+bool hasAttribute(XmlNode const& node, char const* const name,
+                  char const* const value)
+{
+    auto const* const v = getAttribute(node, name);
+    return v && std::strcmp(v, value) == 0;
+}
+
+std::size_t getSizeAttribute(XmlNode const& node, char const* const name,
+                             std::size_t const default_value)
+{
+    auto const* const v = getAttribute(node, name);
+    return v ? std::stoull(v) : default_value;
+}
+
+/// Reads the binary data arrays of a vtu file.
+class DataArrayReader final
+{
+public:
+    DataArrayReader(std::ifstream& in, std::size_t const header_size,
+                    bool const compressed, bool const appended_raw,
+                    std::streamoff const appended_begin)
+        : _in(in),
+          _header_size(header_size),
+          _compressed(compressed),
+          _appended_raw(appended_raw),
+          _appended_begin(appended_begin)
+    {
+    }
+
+    /// Reads the values of the \c data_array into \c data, which must hold
+    /// exactly the \c size bytes of the array.
+    bool read(XmlNode const& data_array, unsigned char* const data,
+              std::size_t const size)
+    {
+        if (hasAttribute(data_array, "format", "appended"))
+        {
+            if (_appended_begin < 0)
+                return false;
+            std::streamoff const position =
+                _appended_begin + getSizeAttribute(data_array, "offset", 0);
+            if (_appended_raw)
+                return readRaw(position, data, size);
+
+            return readBase64(
+                [this, position](std::size_t const length) -> char const* {
+                    _text.resize(length);
+                    _in.clear();
+                    _in.seekg(position);
+                    _in.read(&_text[0], length);
+                    return _in ? _text.data() : nullptr;
+                },
+                data, size);
+        }
+
+        if (hasAttribute(data_array, "format", "binary"))
+        {
+            char const* text = data_array.value();
+            std::size_t length = data_array.value_size();
+            while (length > 0 && std::isspace(static_cast<unsigned char>(*text)))
+            {
+                ++text;
+                --length;
+            }
+            return readBase64(
+                [text, length](std::size_t const n) -> char const* {
+                    return n <= length ? text : nullptr;
+                },
+                data, size);
+        }
+
+        return false;
+    }
+
+private:
+    std::uint64_t getHeaderWord(unsigned char const* const p) const
+    {
+        if (_header_size == 4)
+        {
+            std::uint32_t word;
+            std::memcpy(&word, p, 4);
+            return word;
+        }
+        std::uint64_t word;
+        std::memcpy(&word, p, 8);
+        return word;
+    }
+
+    std::vector<std::uint64_t> getHeader(unsigned char const* const p,
+                                         std::size_t const n_words) const
+    {
+        std::vector<std::uint64_t> header(n_words);
+        for (std::size_t i = 0; i < n_words; ++i)
+            header[i] = getHeaderWord(p + i * _header_size);
+        return header;
+    }
+
+    static std::size_t getCompressedSize(
+        std::vector<std::uint64_t> const& header)
+    {
+        return std::accumulate(header.begin() + 3, header.end(),
+                               std::size_t{0});
+    }
+
+    bool readRaw(std::streamoff const position, unsigned char* const data,
+                 std::size_t const size)
+    {
+        _in.clear();
+        _in.seekg(position);
+        std::vector<unsigned char> words(3 * _header_size);
+        if (!_compressed)
+        {
+            _in.read(reinterpret_cast<char*>(words.data()), _header_size);
+            if (!_in || getHeaderWord(words.data()) != size)
+                return false;
+            _in.read(reinterpret_cast<char*>(data), size);
+            return static_cast<bool>(_in);
+        }
+
+        _in.read(reinterpret_cast<char*>(words.data()), 3 * _header_size);
+        if (!_in)
+            return false;
+        std::size_t const n_blocks = getHeaderWord(words.data());
+        words.resize((3 + n_blocks) * _header_size);
+        _in.read(reinterpret_cast<char*>(words.data()) + 3 * _header_size,
+                 n_blocks * _header_size);
+        if (!_in)
+            return false;
+        auto const header = getHeader(words.data(), 3 + n_blocks);
+
+        std::vector<unsigned char> compressed_data(getCompressedSize(header));
+        _in.read(reinterpret_cast<char*>(compressed_data.data()),
+                 compressed_data.size());
+        return _in && MeshLib::IO::VtuBinaryData::decompress(
+                          header, compressed_data.data(),
+                          compressed_data.size(), data, size);
+    }
+
+    /// Reads base64 encoded data. \c get_text returns the given number of
+    /// characters of the encoded array or a nullptr if there are not enough.
+    bool readBase64(
+        std::function<char const*(std::size_t const)> const& get_text,
+        unsigned char* const data, std::size_t const size)
+    {
+        using MeshLib::IO::VtuBinaryData::decodeBase64;
+        using MeshLib::IO::VtuBinaryData::getBase64Length;
+
+        std::vector<unsigned char> decoded;
+        if (!_compressed)
+        {
+            // The header is encoded together with the data.
+            std::size_t const length = getBase64Length(_header_size + size);
+            char const* const text = get_text(length);
+            if (!text || !decodeBase64(text, length, decoded) ||
+                decoded.size() != _header_size + size ||
+                getHeaderWord(decoded.data()) != size)
+                return false;
+            std::copy(decoded.begin() + _header_size, decoded.end(), data);
+            return true;
+        }
+
+        // The header is encoded separately. Its length depends on the number
+        // of blocks given by the first header word.
+        std::size_t const prefix_length = getBase64Length(3 * _header_size);
+        char const* text = get_text(prefix_length);
+        if (!text || !decodeBase64(text, prefix_length, decoded) ||
+            decoded.size() < 3 * _header_size)
+            return false;
+        std::size_t const n_blocks = getHeaderWord(decoded.data());
+
+        std::size_t const header_length =
+            getBase64Length((3 + n_blocks) * _header_size);
+        text = get_text(header_length);
+        if (!text || !decodeBase64(text, header_length, decoded) ||
+            decoded.size() < (3 + n_blocks) * _header_size)
+            return false;
+        auto const header = getHeader(decoded.data(), 3 + n_blocks);
+
+        std::size_t const length =
+            header_length + getBase64Length(getCompressedSize(header));
+        text = get_text(length);
+        if (!text || !decodeBase64(text + header_length,
+                                   length - header_length, decoded))
+            return false;
+        return MeshLib::IO::VtuBinaryData::decompress(
+            header, decoded.data(), decoded.size(), data, size);
+    }
+
+    std::ifstream& _in;
+    std::size_t const _header_size;
+    bool const _compressed;
+    bool const _appended_raw;
+    std::streamoff const _appended_begin;
+    /// Buffer for base64 encoded appended data.
+    std::string _text;
+};
+
+template <typename T>
+bool readArray(DataArrayReader& reader, XmlNode const& data_array,
+               std::vector<T>& values)
+{
+    return reader.read(data_array,
+                       reinterpret_cast<unsigned char*>(values.data()),
+                       values.size() * sizeof(T));
+}
+
+/// Reads an integer array stored as type T and converts it to std::int64_t.
+template <typename T>
+bool readIndexArrayAs(DataArrayReader& reader, XmlNode const& data_array,
+                      std::size_t const n_values,
+                      std::vector<std::int64_t>& values)
+{
+    std::vector<T> v(n_values);
+    if (!readArray(reader, data_array, v))
+        return false;
+    values.assign(v.begin(), v.end());
+    return true;
+}
+
+/// Reads an integer array of any of the VTK index types.
+bool readIndexArray(DataArrayReader& reader, XmlNode const& data_array,
+                    std::size_t const n_values,
+                    std::vector<std::int64_t>& values)
+{
+    if (hasAttribute(data_array, "type", "Int64"))
+    {
+        values.resize(n_values);
+        return readArray(reader, data_array, values);
+    }
+    if (hasAttribute(data_array, "type", "Int32"))
+        return readIndexArrayAs<std::int32_t>(reader, data_array, n_values,
+                                              values);
+    if (hasAttribute(data_array, "type", "UInt64"))
+        return readIndexArrayAs<std::uint64_t>(reader, data_array, n_values,
+                                               values);
+    if (hasAttribute(data_array, "type", "UInt32"))
+        return readIndexArrayAs<std::uint32_t>(reader, data_array, n_values,
+                                               values);
+    return false;
+}
+
+XmlNode const* findDataArray(XmlNode const& parent, char const* const name)
+{
+    for (auto const* da = parent.first_node("DataArray"); da;
+         da = da->next_sibling("DataArray"))
+        if (hasAttribute(*da, "Name", name))
+            return da;
+    return nullptr;
+}
+
+template <typename ElementType>
+MeshLib::Element* createElement(std::vector<MeshLib::Node*> const& nodes,
+                                std::int64_t const* const ids,
+                                std::initializer_list<unsigned> const order)
+{
+    auto** const element_nodes = new MeshLib::Node*[ElementType::n_all_nodes];
+    unsigned k = 0;
+    for (auto const i : order)
+        element_nodes[k++] = nodes[ids[i]];
+    return new ElementType(element_nodes);
+}
+
+template <typename ElementType>
+MeshLib::Element* createElement(std::vector<MeshLib::Node*> const& nodes,
+                                std::int64_t const* const ids)
+{
+    auto** const element_nodes = new MeshLib::Node*[ElementType::n_all_nodes];
+    for (unsigned k = 0; k < ElementType::n_all_nodes; ++k)
+        element_nodes[k] = nodes[ids[k]];
+    return new ElementType(element_nodes);
+}
+
+/// Creates an element from the VTK cell type and node ids, for which the VTK
+/// node order is converted into the OGS node order. Returns a nullptr for
+/// unsupported cell types or a wrong number of nodes.
+MeshLib::Element* createElement(int const type,
+                                std::vector<MeshLib::Node*> const& nodes,
+                                std::int64_t const* const ids,
+                                std::size_t const n_ids)
+{
+    auto const check = [n_ids](std::size_t const n) { return n == n_ids; };
+
+    switch (type)
+    {
+        case VTK_LINE:
+            return check(2) ? createElement<MeshLib::Line>(nodes, ids)
+                            : nullptr;
+        case VTK_TRIANGLE:
+            return check(3) ? createElement<MeshLib::Tri>(nodes, ids)
+                            : nullptr;
+        case VTK_QUAD:
+            return check(4) ? createElement<MeshLib::Quad>(nodes, ids)
+                            : nullptr;
+        case VTK_PIXEL:
+            return check(4) ? createElement<MeshLib::Quad>(nodes, ids,
+                                                           {0, 1, 3, 2})
+                            : nullptr;
+        case VTK_TETRA:
+            return check(4) ? createElement<MeshLib::Tet>(nodes, ids)
+                            : nullptr;
+        case VTK_HEXAHEDRON:
+            return check(8) ? createElement<MeshLib::Hex>(nodes, ids)
+                            : nullptr;
+        case VTK_VOXEL:
+            return check(8) ? createElement<MeshLib::Hex>(
+                                  nodes, ids, {0, 1, 3, 2, 4, 5, 7, 6})
+                            : nullptr;
+        case VTK_PYRAMID:
+            return check(5) ? createElement<MeshLib::Pyramid>(nodes, ids)
+                            : nullptr;
+        case VTK_WEDGE:
+            return check(6) ? createElement<MeshLib::Prism>(
+                                  nodes, ids, {3, 4, 5, 0, 1, 2})
+                            : nullptr;
+        case VTK_QUADRATIC_EDGE:
+            return check(3) ? createElement<MeshLib::Line3>(nodes, ids)
+                            : nullptr;
+        case VTK_QUADRATIC_TRIANGLE:
+            return check(6) ? createElement<MeshLib::Tri6>(nodes, ids)
+                            : nullptr;
+        case VTK_QUADRATIC_QUAD:
+            return check(8) ? createElement<MeshLib::Quad8>(nodes, ids)
+                            : nullptr;
+        case VTK_BIQUADRATIC_QUAD:
+            return check(9) ? createElement<MeshLib::Quad9>(nodes, ids)
+                            : nullptr;
+        case VTK_QUADRATIC_TETRA:
+            return check(10) ? createElement<MeshLib::Tet10>(nodes, ids)
+                             : nullptr;
+        case VTK_QUADRATIC_HEXAHEDRON:
+            return check(20) ? createElement<MeshLib::Hex20>(nodes, ids)
+                             : nullptr;
+        case VTK_QUADRATIC_PYRAMID:
+            return check(13) ? createElement<MeshLib::Pyramid13>(nodes, ids)
+                             : nullptr;
+        case VTK_QUADRATIC_WEDGE:
+            return check(15)
+                       ? createElement<MeshLib::Prism15>(
+                             nodes, ids,
+                             {3, 4, 5, 0, 1, 2, 8, 7, 6, 12, 14, 13, 11, 10, 9})
+                       : nullptr;
+        default:
+            return nullptr;
+    }
+}
+
+template <typename T>
+bool readPropertyVector(DataArrayReader& reader, XmlNode const& data_array,
+                        std::string const& name,
+                        MeshLib::MeshItemType const item_type,
+                        std::size_t const n_tuples,
+                        std::size_t const n_components,
+                        MeshLib::Properties& properties)
+{
+    auto* const property = properties.createNewPropertyVector<T>(
+        name, item_type, n_components);
+    if (!property)
+    {
+        WARN("Array %s could not be converted to PropertyVector.",
+             name.c_str());
+        return true;
+    }
+    property->resize(n_tuples * n_components);
+    return readArray(reader, data_array, *property);
+}
+
+/// Reads a bit array, whose values are packed into bytes starting with the
+/// most significant bit, into a property vector of bools.
+bool readBitPropertyVector(DataArrayReader& reader, XmlNode const& data_array,
+                           std::string const& name,
+                           MeshLib::MeshItemType const item_type,
+                           std::size_t const n_tuples,
+                           std::size_t const n_components,
+                           MeshLib::Properties& properties)
+{
+    std::size_t const n_values = n_tuples * n_components;
+    std::vector<unsigned char> bytes((n_values + 7) / 8);
+    if (!readArray(reader, data_array, bytes))
+        return false;
+    auto* const property = properties.createNewPropertyVector<bool>(
+        name, item_type, n_components);
+    if (!property)
+    {
+        WARN("Array %s could not be converted to PropertyVector.",
+             name.c_str());
+        return true;
+    }
+    property->resize(n_values);
+    for (std::size_t i = 0; i < n_values; ++i)
+        (*property)[i] = (bytes[i / 8] & (0x80 >> (i % 8))) != 0;
+    return true;
+}
+
+/// Reads all data arrays of \c section into property vectors. If
+/// \c n_tuples is zero it is taken from the arrays' NumberOfTuples attribute.
+///
+/// The array types are mapped to property vector types as by
+/// MeshLib::VtkMeshConverter for the arrays VTK creates from the file; arrays
+/// of other types, e.g., Float32 or Int8, which VTK reads as signed char
+/// arrays, are skipped.
+bool readPropertyVectors(DataArrayReader& reader, XmlNode const* const section,
+                         MeshLib::MeshItemType const item_type,
+                         std::size_t const n_tuples,
+                         MeshLib::Properties& properties)
+{
+    if (!section)
+        return true;
+
+    for (auto const* da = section->first_node("DataArray"); da;
+         da = da->next_sibling("DataArray"))
+    {
+        auto const* const name_attribute = getAttribute(*da, "Name");
+        std::string const name = name_attribute ? name_attribute : "";
+        auto const n_components =
+            getSizeAttribute(*da, "NumberOfComponents", 1);
+        auto const n = n_tuples > 0
+                           ? n_tuples
+                           : getSizeAttribute(*da, "NumberOfTuples", 0);
+
+        auto const is_type = [da](char const* const type) {
+            return hasAttribute(*da, "type", type);
+        };
+
+        bool success = true;
+        if (is_type("Float64"))
+            success = readPropertyVector<double>(
+                reader, *da, name, item_type, n, n_components, properties);
+        else if (is_type("Int32"))
+            success = readPropertyVector<int>(reader, *da, name, item_type, n,
+                                              n_components, properties);
+        // MaterialIDs are assumed to be integers.
+        else if (is_type("UInt32") && name.compare(0, 11, "MaterialIDs") == 0)
+            success = readPropertyVector<int>(reader, *da, name, item_type, n,
+                                              n_components, properties);
+        else if (is_type("UInt32"))
+            success = readPropertyVector<unsigned>(
+                reader, *da, name, item_type, n, n_components, properties);
+        // VTK reads these as unsigned long arrays if long has 64 bits and as
+        // unsigned long long arrays otherwise.
+        else if (is_type("UInt64"))
+            success = readPropertyVector<std::conditional<
+                sizeof(unsigned long) == 8, unsigned long,
+                unsigned long long>::type>(reader, *da, name, item_type, n,
+                                           n_components, properties);
+        else if (is_type("Bit"))
+            success = readBitPropertyVector(reader, *da, name, item_type, n,
+                                            n_components, properties);
+        else
+            ERR("Array \"%s\" in VTU file uses unsupported data type.",
+                name.c_str());
+
+        if (!success)
+        {
+            ERR("Reading the data of array \"%s\" failed.", name.c_str());
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Reads the XML part of the file, i.e., the whole file for inline data or
+/// everything up to the appended data otherwise. In the latter case the
+/// returned document text is closed and the encoding and the file position of
+/// the appended data are returned.
+bool readXml(std::ifstream& in, std::string& xml, std::string& encoding,
+             std::streamoff& appended_begin)
+{
+    std::size_t const chunk_size = 1 << 20;
+    std::vector<char> chunk(chunk_size);
+    std::string::size_type search_begin = 0;
+    while (in)
+    {
+        in.read(chunk.data(), chunk_size);
+        xml.append(chunk.data(), in.gcount());
+
+        auto const tag_begin = xml.find("<AppendedData", search_begin);
+        if (tag_begin == std::string::npos)
+        {
+            // A tag name split between chunks is found in the next round.
+            search_begin = xml.size() < 13 ? 0 : xml.size() - 13;
+            continue;
+        }
+        search_begin = tag_begin;
+
+        auto const tag_end = xml.find('>', tag_begin);
+        auto const marker = xml.find('_', tag_end);
+        if (tag_end == std::string::npos || marker == std::string::npos)
+            continue;
+
+        std::string const tag = xml.substr(tag_begin, tag_end - tag_begin);
+        auto const encoding_begin = tag.find("encoding=\"");
+        if (encoding_begin != std::string::npos)
+        {
+            auto const value_begin = encoding_begin + 10;
+            encoding =
+                tag.substr(value_begin, tag.find('"', value_begin) - value_begin);
+        }
+        appended_begin = marker + 1;
+        xml.resize(tag_begin);
+        xml += "</VTKFile>";
+        return true;
+    }
+    return !in.bad();
+}
+}  // namespace
+
+namespace MeshLib
+{
+namespace IO
+{
+MeshLib::Mesh* VtuReader::readVTUFile(std::string const& file_name)
+{
+    std::ifstream in(file_name, std::ios::binary);
+    if (!in)
+    {
+        ERR("File \"%s\" does not exist.", file_name.c_str());
+        return nullptr;
+    }
+
+    std::string xml;
+    std::string encoding = "base64";
+    std::streamoff appended_begin = -1;
+    if (!readXml(in, xml, encoding, appended_begin))
+    {
+        ERR("Could not read file \"%s\".", file_name.c_str());
+        return nullptr;
+    }
+
+    rapidxml::xml_document<> doc;
+    try
+    {
+        doc.parse<0>(&xml[0]);
+    }
+    catch (rapidxml::parse_error const& e)
+    {
+        ERR("VtuReader: Invalid XML in file \"%s\": %s.", file_name.c_str(),
+            e.what());
+        return nullptr;
+    }
+
+    auto const* const vtk_file = doc.first_node("VTKFile");
+    if (!vtk_file || !hasAttribute(*vtk_file, "type", "UnstructuredGrid"))
+    {
+        ERR("VtuReader: File \"%s\" is not an unstructured grid file.",
+            file_name.c_str());
+        return nullptr;
+    }
+
+    if (getAttribute(*vtk_file, "byte_order") &&
+        !hasAttribute(*vtk_file, "byte_order", "LittleEndian"))
+    {
+        DBUG("VtuReader: Only little endian byte order is supported.");
+        return nullptr;
+    }
+
+    std::size_t header_size = 4;
+    if (hasAttribute(*vtk_file, "header_type", "UInt64"))
+        header_size = 8;
+    else if (getAttribute(*vtk_file, "header_type") &&
+             !hasAttribute(*vtk_file, "header_type", "UInt32"))
+    {
+        DBUG("VtuReader: Unsupported header type.");
+        return nullptr;
+    }
+
+    bool const compressed = getAttribute(*vtk_file, "compressor") != nullptr;
+    if (compressed &&
+        !hasAttribute(*vtk_file, "compressor", "vtkZLibDataCompressor"))
+    {
+        DBUG("VtuReader: Unsupported compressor %s.",
+             getAttribute(*vtk_file, "compressor"));
+        return nullptr;
+    }
+
+    if (appended_begin >= 0 && encoding != "raw" && encoding != "base64")
+    {
+        DBUG("VtuReader: Unsupported encoding %s of the appended data.",
+             encoding.c_str());
+        return nullptr;
+    }
+
+    auto const* const grid = vtk_file->first_node("UnstructuredGrid");
+    auto const* const piece = grid ? grid->first_node("Piece") : nullptr;
+    if (!piece || piece->next_sibling("Piece"))
+    {
+        DBUG("VtuReader: Only files with a single piece are supported.");
+        return nullptr;
+    }
+
+    auto const n_points = getSizeAttribute(*piece, "NumberOfPoints", 0);
+    auto const n_cells = getSizeAttribute(*piece, "NumberOfCells", 0);
+    if (n_points == 0)
+        return nullptr;
+
+    DataArrayReader reader(in, header_size, compressed, encoding == "raw",
+                           appended_begin);
+
+    // Nodes
+    auto const* const points = piece->first_node("Points");
+    auto const* const points_array =
+        points ? points->first_node("DataArray") : nullptr;
+    if (!points_array ||
+        getSizeAttribute(*points_array, "NumberOfComponents", 1) != 3)
+    {
+        ERR("VtuReader: No point coordinates in file \"%s\".",
+            file_name.c_str());
+        return nullptr;
+    }
+
+    std::vector<double> coordinates(3 * n_points);
+    bool points_read = false;
+    if (hasAttribute(*points_array, "type", "Float64"))
+        points_read = readArray(reader, *points_array, coordinates);
+    else if (hasAttribute(*points_array, "type", "Float32"))
+    {
+        std::vector<float> values(3 * n_points);
+        points_read = readArray(reader, *points_array, values);
+        std::copy(values.begin(), values.end(), coordinates.begin());
+    }
+    if (!points_read)
+    {
+        DBUG("VtuReader: Could not read the point coordinates.");
+        return nullptr;
+    }
+
+    // Cells
+    auto const* const cells = piece->first_node("Cells");
+    auto const* const connectivity_array =
+        cells ? findDataArray(*cells, "connectivity") : nullptr;
+    auto const* const offsets_array =
+        cells ? findDataArray(*cells, "offsets") : nullptr;
+    auto const* const types_array =
+        cells ? findDataArray(*cells, "types") : nullptr;
+    if (!connectivity_array || !offsets_array || !types_array)
+    {
+        ERR("VtuReader: No cells in file \"%s\".", file_name.c_str());
+        return nullptr;
+    }
+
+    std::vector<std::int64_t> offsets;
+    std::vector<std::uint8_t> types(n_cells);
+    if (!readIndexArray(reader, *offsets_array, n_cells, offsets) ||
+        !hasAttribute(*types_array, "type", "UInt8") ||
+        !readArray(reader, *types_array, types))
+    {
+        DBUG("VtuReader: Could not read the cell offsets and types.");
+        return nullptr;
+    }
+
+    std::vector<std::int64_t> connectivity;
+    std::size_t const n_connectivity = n_cells > 0 ? offsets.back() : 0;
+    if (!readIndexArray(reader, *connectivity_array, n_connectivity,
+                        connectivity))
+    {
+        DBUG("VtuReader: Could not read the cell connectivity.");
+        return nullptr;
+    }
+
+    std::vector<MeshLib::Node*> nodes(n_points);
+    OPENMP_LOOP_TYPE const n_nodes = n_points;
+#pragma omp parallel for
+    for (OPENMP_LOOP_TYPE i = 0; i < n_nodes; ++i)
+        nodes[i] = new MeshLib::Node(&coordinates[3 * i], i);
+    std::vector<double>().swap(coordinates);
+
+    std::vector<MeshLib::Element*> elements(n_cells, nullptr);
+    bool valid_cells = true;
+    OPENMP_LOOP_TYPE const n_elements = n_cells;
+#pragma omp parallel for reduction(&& : valid_cells)
+    for (OPENMP_LOOP_TYPE i = 0; i < n_elements; ++i)
+    {
+        std::int64_t const begin = i == 0 ? 0 : offsets[i - 1];
+        std::int64_t const end = offsets[i];
+        bool const valid_ids =
+            0 <= begin && begin <= end &&
+            end <= static_cast<std::int64_t>(connectivity.size()) &&
+            std::all_of(connectivity.begin() + begin,
+                        connectivity.begin() + end, [n_points](std::int64_t id) {
+                            return 0 <= id &&
+                                   id < static_cast<std::int64_t>(n_points);
+                        });
+        if (valid_ids)
+            elements[i] = createElement(types[i], nodes, &connectivity[begin],
+                                        end - begin);
+        valid_cells = valid_cells && elements[i] != nullptr;
+    }
+
+    if (!valid_cells)
+    {
+        ERR("VtuReader: Invalid or unsupported cells in file \"%s\".",
+            file_name.c_str());
+        for (auto* e : elements)
+            delete e;
+        for (auto* n : nodes)
+            delete n;
+        return nullptr;
+    }
+
+    std::unique_ptr<MeshLib::Mesh> mesh(new MeshLib::Mesh(
+        BaseLib::extractBaseNameWithoutExtension(file_name), nodes, elements));
+
+    auto& properties = mesh->getProperties();
+    if (!readPropertyVectors(reader, piece->first_node("PointData"),
+                             MeshLib::MeshItemType::Node, n_points,
+                             properties) ||
+        !readPropertyVectors(reader, piece->first_node("CellData"),
+                             MeshLib::MeshItemType::Cell, n_cells,
+                             properties) ||
+        !readPropertyVectors(reader, grid->first_node("FieldData"),
+                             MeshLib::MeshItemType::IntegrationPoint, 0,
+                             properties))
+        return nullptr;
+
+    return mesh.release();
+}
+
+}  // end namespace IO
+}  // end namespace MeshLib
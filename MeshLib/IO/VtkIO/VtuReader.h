@@ -0,0 +1,44 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+
+namespace MeshLib
+{
+class Mesh;
+
+namespace IO
+{
+/**
+ * \brief Reads VtkXMLUnstructuredGrid-files (vtu) directly into OGS data
+ * structures.
+ *
+ * The data arrays are read straight into the node coordinates, the element
+ * connectivity and the property vectors without setting up a
+ * vtkUnstructuredGrid first. Uncompressed raw appended data is read from the
+ * file into the property vectors without intermediate copies, compressed
+ * blocks are decompressed concurrently.
+ *
+ * Supported are single piece files in little endian byte order with binary
+ * data arrays, inline or appended (raw or base64 encoded), uncompressed or
+ * zlib compressed. Other files, e.g., ascii files, are rejected.
+ */
+class VtuReader final
+{
+public:
+    /// Reads an unstructured grid from a vtu file.
+    /// \return The mesh or a nullptr if reading failed, also if the file uses
+    /// features which are not supported.
+    static MeshLib::Mesh* readVTUFile(std::string const& file_name);
+};
+
+}  // end namespace IO
+}  // end namespace MeshLib
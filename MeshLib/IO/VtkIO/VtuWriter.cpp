@@ -0,0 +1,338 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "VtuWriter.h"
+
+#include <cstdint>
+#include <fstream>
+#include <type_traits>
+#include <vector>
+
+#include <vtkCellType.h>
+
+#include <logog/include/logog.hpp>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/VtkOGSEnum.h"
+
+#include "VtuBinaryData.h"
+
+namespace
+{
+/// A data array of the vtu file referring to the memory of its values.
+struct DataArray
+{
+    std::string name;
+    std::string type;
+    std::size_t n_components;
+    /// Only written for field data.
+    std::size_t n_tuples;
+    unsigned char const* data;
+    std::size_t size;
+    MeshLib::IO::VtuBinaryData::EncodedArray encoded;
+};
+
+template <typename T>
+std::string getVtkTypeName()
+{
+    static_assert(std::is_arithmetic<T>::value,
+                  "Only arithmetic types can be written.");
+    if (std::is_floating_point<T>::value)
+        return "Float" + std::to_string(8 * sizeof(T));
+    return (std::is_signed<T>::value ? "Int" : "UInt") +
+           std::to_string(8 * sizeof(T));
+}
+
+template <typename T>
+DataArray makeDataArray(std::string const& name, std::vector<T> const& values,
+                        std::size_t const n_components)
+{
+    return {name,
+            getVtkTypeName<T>(),
+            n_components,
+            values.size() / n_components,
+            reinterpret_cast<unsigned char const*>(values.data()),
+            values.size() * sizeof(T),
+            {}};
+}
+
+/// Adds the property vector \c name to the arrays of the respective mesh item
+/// type, if it has value type \c T.
+template <typename T>
+bool addPropertyVector(MeshLib::Properties const& properties,
+                       std::string const& name,
+                       std::vector<DataArray>& point_arrays,
+                       std::vector<DataArray>& cell_arrays,
+                       std::vector<DataArray>& field_arrays)
+{
+    if (!properties.existsPropertyVector<T>(name))
+        return false;
+    auto const* const property = properties.getPropertyVector<T>(name);
+    if (!property)
+        return false;
+
+    auto const array =
+        makeDataArray(name, static_cast<std::vector<T> const&>(*property),
+                      property->getNumberOfComponents());
+    switch (property->getMeshItemType())
+    {
+        case MeshLib::MeshItemType::Node:
+            point_arrays.push_back(array);
+            break;
+        case MeshLib::MeshItemType::Cell:
+            cell_arrays.push_back(array);
+            break;
+        case MeshLib::MeshItemType::IntegrationPoint:
+            field_arrays.push_back(array);
+            break;
+        default:
+            DBUG("Property vector \"%s\" of unsupported mesh item type.",
+                 name.c_str());
+    }
+    return true;
+}
+
+std::string escapeXml(std::string const& s)
+{
+    std::string escaped;
+    escaped.reserve(s.size());
+    for (char const c : s)
+    {
+        switch (c)
+        {
+            case '&':
+                escaped += "&amp;";
+                break;
+            case '<':
+                escaped += "&lt;";
+                break;
+            case '>':
+                escaped += "&gt;";
+                break;
+            case '"':
+                escaped += "&quot;";
+                break;
+            default:
+                escaped += c;
+        }
+    }
+    return escaped;
+}
+
+/// Appends the VTK node ids of the element to the connectivity array. For
+/// prisms the VTK node order differs from the OGS node order.
+void appendConnectivity(MeshLib::Element const& element,
+                        std::vector<std::int64_t>& connectivity)
+{
+    auto const* const* const nodes = element.getNodes();
+    auto const node_id = [nodes](unsigned const i) {
+        return static_cast<std::int64_t>(nodes[i]->getID());
+    };
+
+    switch (element.getCellType())
+    {
+        case MeshLib::CellType::PRISM6:
+            for (unsigned i : {3, 4, 5, 0, 1, 2})
+                connectivity.push_back(node_id(i));
+            break;
+        case MeshLib::CellType::PRISM15:
+            for (unsigned i :
+                 {3, 4, 5, 0, 1, 2, 8, 7, 6, 14, 13, 12, 9, 11, 10})
+                connectivity.push_back(node_id(i));
+            break;
+        default:
+            for (unsigned i = 0; i < element.getNumberOfNodes(); ++i)
+                connectivity.push_back(node_id(i));
+    }
+}
+
+void writeDataArrays(std::ostream& os, std::string const& section,
+                     std::vector<DataArray> const& arrays,
+                     std::string const& indent, bool const appended,
+                     std::vector<std::size_t>::const_iterator& offset)
+{
+    if (arrays.empty())
+        return;
+
+    if (!section.empty())
+        os << indent << "<" << section << ">\n";
+    std::string const array_indent = section.empty() ? indent : indent + "  ";
+    for (auto const& array : arrays)
+    {
+        os << array_indent << "<DataArray type=\"" << array.type
+           << "\" Name=\"" << escapeXml(array.name)
+           << "\" NumberOfComponents=\"" << array.n_components << "\"";
+        if (section == "FieldData")
+            os << " NumberOfTuples=\"" << array.n_tuples << "\"";
+
+        if (appended)
+        {
+            os << " format=\"appended\" offset=\"" << *offset++ << "\"/>\n";
+            continue;
+        }
+        os << " format=\"binary\">\n" << array_indent << "  ";
+        MeshLib::IO::VtuBinaryData::writeBase64(os, array.encoded);
+        os << "\n" << array_indent << "</DataArray>\n";
+    }
+    if (!section.empty())
+        os << indent << "</" << section << ">\n";
+}
+}  // namespace
+
+namespace MeshLib
+{
+namespace IO
+{
+VtuWriter::VtuWriter(MeshLib::Mesh const& mesh, DataMode const data_mode,
+                     bool const compress)
+    : _mesh(mesh), _data_mode(data_mode), _compress(compress)
+{
+}
+
+bool VtuWriter::writeToFile(std::string const& file_name) const
+{
+    // Points
+    auto const& nodes = _mesh.getNodes();
+    std::vector<double> coordinates;
+    coordinates.reserve(3 * nodes.size());
+    for (auto const* const node : nodes)
+        coordinates.insert(coordinates.end(), node->getCoords(),
+                           node->getCoords() + 3);
+
+    // Cells
+    auto const& elements = _mesh.getElements();
+    std::vector<std::int64_t> connectivity;
+    std::vector<std::int64_t> offsets;
+    std::vector<std::uint8_t> types;
+    offsets.reserve(elements.size());
+    types.reserve(elements.size());
+    for (auto const* const element : elements)
+    {
+        int const type = element->getCellType() == MeshLib::CellType::POINT1
+                             ? VTK_VERTEX
+                             : OGSToVtkCellType(element->getCellType());
+        if (type < 0)
+        {
+            ERR("VtuWriter: Element type %s cannot be written to vtu files.",
+                CellType2String(element->getCellType()).c_str());
+            return false;
+        }
+        appendConnectivity(*element, connectivity);
+        offsets.push_back(connectivity.size());
+        types.push_back(static_cast<std::uint8_t>(type));
+    }
+
+    // Property vectors
+    std::vector<DataArray> point_arrays;
+    std::vector<DataArray> cell_arrays;
+    std::vector<DataArray> field_arrays;
+    auto const& properties = _mesh.getProperties();
+    for (auto const& name : properties.getPropertyVectorNames())
+    {
+        // The same property types as by MeshLib::VtkMappedMeshSource.
+        if (addPropertyVector<double>(properties, name, point_arrays,
+                                      cell_arrays, field_arrays) ||
+            addPropertyVector<int>(properties, name, point_arrays, cell_arrays,
+                                   field_arrays) ||
+            addPropertyVector<unsigned>(properties, name, point_arrays,
+                                        cell_arrays, field_arrays) ||
+            addPropertyVector<std::size_t>(properties, name, point_arrays,
+                                           cell_arrays, field_arrays) ||
+            addPropertyVector<char>(properties, name, point_arrays,
+                                    cell_arrays, field_arrays))
+            continue;
+
+        DBUG("Mesh property \"%s\" with unknown data type.", name.c_str());
+    }
+
+    std::vector<DataArray> point_coordinates{
+        makeDataArray("Points", coordinates, 3)};
+    std::vector<DataArray> cell_arrays_topology{
+        makeDataArray("connectivity", connectivity, 1),
+        makeDataArray("offsets", offsets, 1), makeDataArray("types", types, 1)};
+
+    // Encode all arrays in the order they appear in the file to compute the
+    // offsets into the appended data.
+    std::vector<DataArray*> all_arrays;
+    for (auto* arrays : {&field_arrays, &point_arrays, &cell_arrays,
+                         &point_coordinates, &cell_arrays_topology})
+        for (auto& array : *arrays)
+            all_arrays.push_back(&array);
+
+    bool const appended = _data_mode != DataMode::Binary;
+    std::vector<std::size_t> appended_offsets;
+    std::size_t appended_size = 0;
+    for (auto* array : all_arrays)
+    {
+        array->encoded =
+            VtuBinaryData::encode(array->data, array->size, _compress);
+        appended_offsets.push_back(appended_size);
+        appended_size += _data_mode == DataMode::AppendedRaw
+                             ? VtuBinaryData::getRawSize(array->encoded)
+                             : VtuBinaryData::getBase64Size(array->encoded);
+    }
+
+    std::ofstream os(file_name, std::ios::binary);
+    if (!os)
+    {
+        ERR("VtuWriter: Could not open file \"%s\" for writing.",
+            file_name.c_str());
+        return false;
+    }
+
+    os << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" "
+          "byte_order=\"LittleEndian\" header_type=\"UInt64\"";
+    if (_compress)
+        os << " compressor=\"vtkZLibDataCompressor\"";
+    os << ">\n"
+       << "  <UnstructuredGrid>\n";
+
+    auto offset = appended_offsets.cbegin();
+    writeDataArrays(os, "FieldData", field_arrays, "    ", appended, offset);
+    os << "    <Piece NumberOfPoints=\"" << nodes.size()
+       << "\" NumberOfCells=\"" << elements.size() << "\">\n";
+    writeDataArrays(os, "PointData", point_arrays, "      ", appended, offset);
+    writeDataArrays(os, "CellData", cell_arrays, "      ", appended, offset);
+    writeDataArrays(os, "Points", point_coordinates, "      ", appended,
+                    offset);
+    writeDataArrays(os, "Cells", cell_arrays_topology, "      ", appended,
+                    offset);
+    os << "    </Piece>\n"
+       << "  </UnstructuredGrid>\n";
+
+    if (appended)
+    {
+        os << "  <AppendedData encoding=\""
+           << (_data_mode == DataMode::AppendedRaw ? "raw" : "base64")
+           << "\">\n"
+           << "   _";
+        for (auto const* array : all_arrays)
+        {
+            if (_data_mode == DataMode::AppendedRaw)
+                VtuBinaryData::writeRaw(os, array->encoded);
+            else
+                VtuBinaryData::writeBase64(os, array->encoded);
+        }
+        os << "\n  </AppendedData>\n";
+    }
+    os << "</VTKFile>\n";
+
+    if (!os)
+    {
+        ERR("VtuWriter: Writing to file \"%s\" failed.", file_name.c_str());
+        return false;
+    }
+    return true;
+}
+
+}  // end namespace IO
+}  // end namespace MeshLib
@@ -0,0 +1,54 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+
+namespace MeshLib
+{
+class Mesh;
+
+namespace IO
+{
+/**
+ * \brief Writes meshes to VtkXMLUnstructuredGrid-files (vtu) directly from the
+ * OGS data structures.
+ *
+ * The nodes, elements and property vectors are serialized without setting up
+ * a VTK pipeline. Property vectors are written from their own storage. The
+ * data arrays are stored in binary form, inline or appended, optionally zlib
+ * compressed, where the compression of the blocks of an array runs
+ * concurrently.
+ */
+class VtuWriter final
+{
+public:
+    enum class DataMode
+    {
+        Binary,      ///< base64 encoded inline data
+        Appended,    ///< base64 encoded appended data
+        AppendedRaw  ///< raw binary appended data
+    };
+
+    VtuWriter(MeshLib::Mesh const& mesh, DataMode const data_mode,
+              bool const compress);
+
+    /// Writes the mesh to the given file.
+    /// \return True on success, false on error
+    bool writeToFile(std::string const& file_name) const;
+
+private:
+    MeshLib::Mesh const& _mesh;
+    DataMode const _data_mode;
+    bool const _compress;
+};
+
+}  // end namespace IO
+}  // end namespace MeshLib
@@ -30,6 +30,7 @@
 
 #include "MeshLib/Mesh.h"
 
+#include "MeshLib/IO/Binary/BinaryMeshIO.h"
 #include "MeshLib/IO/Legacy/MeshIO.h"
 #include "MeshLib/IO/VtkIO/VtuInterface.h"
 
@@ -42,14 +43,16 @@ namespace MeshLib
 {
 namespace IO
 {
-MeshLib::Mesh* readMeshFromFile(const std::string &file_name)
+MeshLib::Mesh* readMeshFromFile(const std::string& file_name,
+                                bool const use_memory_mapping)
 {
 #ifdef USE_PETSC
     int world_size;
     MPI_Comm_size(MPI_COMM_WORLD, &world_size);
     if (world_size > 1)
     {
-        MeshLib::IO::NodePartitionedMeshReader read_pmesh(PETSC_COMM_WORLD);
+        MeshLib::IO::NodePartitionedMeshReader read_pmesh(PETSC_COMM_WORLD,
+                                                          use_memory_mapping);
         const std::string file_name_base = BaseLib::dropFileExtension(file_name);
         return read_pmesh.read(file_name_base);
     }
@@ -63,6 +66,7 @@ MeshLib::Mesh* readMeshFromFile(const std::string &file_name)
     }
     return nullptr;
 #else
+    (void)use_memory_mapping;
     return readMeshFromFileSerial(file_name);
 #endif
 }
@@ -78,6 +82,9 @@ MeshLib::Mesh* readMeshFromFileSerial(const std::string &file_name)
     if (BaseLib::hasFileExtension("vtu", file_name))
         return MeshLib::IO::VtuInterface::readVTUFile(file_name);
 
+    if (BaseLib::hasFileExtension("bmsh", file_name))
+        return MeshLib::IO::BinaryMeshIO::readMeshFromFile(file_name);
+
     ERR("readMeshFromFile(): Unknown mesh file format in file %s.", file_name.c_str());
     return nullptr;
 }
@@ -27,6 +27,12 @@ class Mesh;
 namespace IO
 {
 MeshLib::Mesh* readMeshFromFileSerial(const std::string &file_name);
-MeshLib::Mesh* readMeshFromFile(const std::string &file_name);
+/// Reads a mesh from a file. In parallel runs the partitioned mesh of the
+/// process is read.
+/// \param file_name Name of the mesh file.
+/// \param use_memory_mapping Map a single file partitioned mesh into memory
+///        instead of reading it with MPI-IO. Ignored in serial runs.
+MeshLib::Mesh* readMeshFromFile(const std::string& file_name,
+                                bool const use_memory_mapping = false);
 }
 }
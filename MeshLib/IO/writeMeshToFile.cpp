@@ -15,6 +15,7 @@
 
 #include "MeshLib/Mesh.h"
 
+#include "MeshLib/IO/Binary/BinaryMeshIO.h"
 #include "MeshLib/IO/Legacy/MeshIO.h"
 #include "MeshLib/IO/VtkIO/VtuInterface.h"
 
@@ -34,6 +35,10 @@ int writeMeshToFile(const MeshLib::Mesh &mesh, const std::string &file_name)
         MeshLib::IO::VtuInterface writer(&mesh);
         writer.writeToFile(file_name);
         return 0;
+    } else if (BaseLib::hasFileExtension("bmsh", file_name)) {
+        return MeshLib::IO::BinaryMeshIO::writeMeshToFile(mesh, file_name)
+                   ? 0
+                   : -1;
     }
 
     ERR("writeMeshToFile(): Unknown mesh file format in file %s.", file_name.c_str());
@@ -12,8 +12,11 @@
  *
  */
 
-#include <vector>
+#include <algorithm>
+#include <cmath>
 #include <fstream>
+#include <limits>
+#include <vector>
 
 #include "Mesh2MeshPropertyInterpolation.h"
 
@@ -26,6 +29,7 @@
 #include "MeshLib/Mesh.h"
 #include "MeshLib/Node.h"
 #include "MeshLib/Elements/Element.h"
+#include "MeshLib/MeshSearch/MeshElementGrid.h"
 
 namespace MeshLib {
 
@@ -97,8 +101,12 @@ void Mesh2MeshPropertyInterpolation::interpolatePropertiesForMesh(
                                          64);
 
     auto const& dest_elements(dest_mesh.getElements());
-    const std::size_t n_dest_elements(dest_elements.size());
-    for (std::size_t k(0); k < n_dest_elements; k++)
+    // Elements not containing any source node, i.e., the destination mesh is
+    // locally finer than the source mesh.
+    std::vector<char> without_src_nodes(dest_elements.size(), 0);
+    OPENMP_LOOP_TYPE const n_dest_elements = dest_elements.size();
+#pragma omp parallel for schedule(dynamic, 256)
+    for (OPENMP_LOOP_TYPE k = 0; k < n_dest_elements; k++)
     {
         MeshLib::Element& dest_element(*dest_elements[k]);
         if (dest_element.getGeomType() == MeshElemType::LINE)
@@ -132,12 +140,42 @@ void Mesh2MeshPropertyInterpolation::interpolatePropertiesForMesh(
         }
 
         if (cnt == 0)
-            OGS_FATAL(
-                "Mesh2MeshInterpolation: Could not find values in source mesh "
-                "for the element %d.",
-                k);
-        dest_properties[k] = average_value / cnt;
+            without_src_nodes[k] = 1;
+        else
+            dest_properties[k] = average_value / cnt;
     }
+
+    if (std::find(without_src_nodes.begin(), without_src_nodes.end(), 1) ==
+        without_src_nodes.end())
+        return;
+
+    // Interpolate the node properties of the source mesh at the centers of the
+    // remaining destination elements.
+    MeshLib::MeshElementGrid const src_element_grid(_src_mesh);
+#pragma omp parallel for
+    for (OPENMP_LOOP_TYPE k = 0; k < n_dest_elements; k++)
+    {
+        if (!without_src_nodes[k])
+            continue;
+        double const value(src_element_grid.interpolateNodeValuesXY(
+            dest_elements[k]->getCenterOfGravity(),
+            interpolated_src_node_properties,
+            std::numeric_limits<double>::quiet_NaN()));
+        if (!std::isnan(value))
+        {
+            dest_properties[k] = value;
+            without_src_nodes[k] = 0;
+        }
+    }
+
+    auto const not_found(
+        std::find(without_src_nodes.begin(), without_src_nodes.end(), 1));
+    if (not_found != without_src_nodes.end())
+        OGS_FATAL(
+            "Mesh2MeshInterpolation: Could not find values in source mesh "
+            "for the element %d.",
+            static_cast<int>(
+                std::distance(without_src_nodes.begin(), not_found)));
 }
 
 void Mesh2MeshPropertyInterpolation::interpolateElementPropertiesToNodeProperties(
@@ -93,7 +93,10 @@ MeshElementGrid::MeshElementGrid(MeshLib::Mesh const& sfc_mesh) :
     // cell
     for (std::size_t k(0); k<3; k++) {
         _step_sizes[k] = delta[k] / _n_steps[k];
-        _inverse_step_sizes[k] = 1.0 / _step_sizes[k];
+        // In a direction without extension, e.g. z for a mesh in the plane
+        // z = 0, the step size can be a denormalized number and its inverse
+        // infinite. All elements are in the same grid cell then.
+        _inverse_step_sizes[k] = dim[k] ? 1.0 / _step_sizes[k] : 0.0;
     }
 
     _elements_in_grid_box.resize(_n_steps[0]*_n_steps[1]*_n_steps[2]);
@@ -192,6 +195,66 @@ MeshElementGrid::getGridCellCoordinates(MathLib::Point3d const& p) const
     return std::make_pair(valid, coords);
 }
 
+std::array<std::size_t, 3> MeshElementGrid::getClampedGridCellCoordinates(
+    MathLib::Point3d const& p) const
+{
+    auto coords(getGridCellCoordinates(p).second);
+    for (std::size_t k(0); k < 3; ++k)
+        coords[k] = std::min(coords[k], _n_steps[k] - 1);
+    return coords;
+}
+
+MeshLib::Element const* MeshElementGrid::findElementContainingPoint(
+    MathLib::Point3d const& p, double const eps) const
+{
+    auto const c(getClampedGridCellCoordinates(p));
+    for (auto const* element :
+         _elements_in_grid_box[c[0] + c[1] * _n_steps[0] +
+                               c[2] * _n_steps[0] * _n_steps[1]])
+    {
+        if (element->isPntInElement(p, eps))
+            return element;
+    }
+    return nullptr;
+}
+
+MeshLib::Element const* MeshElementGrid::findElementContainingPointXY(
+    MathLib::Point3d const& p, std::array<double, 4>& weights) const
+{
+    auto const c(getClampedGridCellCoordinates(p));
+    // The elements containing the projected point are stored in the column of
+    // grid cells above and below the point.
+    for (std::size_t k(0); k < _n_steps[2]; ++k)
+    {
+        for (auto const* element :
+             _elements_in_grid_box[c[0] + c[1] * _n_steps[0] +
+                                   k * _n_steps[0] * _n_steps[1]])
+        {
+            if (element->getGeomType() != MeshElemType::TRIANGLE &&
+                element->getGeomType() != MeshElemType::QUAD)
+                continue;
+            if (MeshLib::computeInterpolationWeightsXY(p, *element, weights))
+                return element;
+        }
+    }
+    return nullptr;
+}
+
+double MeshElementGrid::interpolateNodeValuesXY(
+    MathLib::Point3d const& p, std::vector<double> const& node_values,
+    double const default_value) const
+{
+    std::array<double, 4> weights;
+    auto const* const element(findElementContainingPointXY(p, weights));
+    if (!element)
+        return default_value;
+
+    double value(0.0);
+    for (unsigned k(0); k < element->getNumberOfBaseNodes(); ++k)
+        value += weights[k] * node_values[element->getNode(k)->getID()];
+    return value;
+}
+
 #ifndef NDEBUG
 void getGridGeometry(MeshElementGrid const& grid,
                      GeoLib::GEOObjects& geometries,
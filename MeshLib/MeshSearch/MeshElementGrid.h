@@ -71,6 +71,68 @@ public:
         return elements_vec;
     }
 
+    /// Returns an element containing the point, see
+    /// MeshLib::Element::isPntInElement(). Only the elements of the grid cell
+    /// containing the point are tested.
+    /// @return the element or nullptr if the point is not in the mesh
+    MeshLib::Element const* findElementContainingPoint(
+        MathLib::Point3d const& p,
+        double eps = std::numeric_limits<double>::epsilon()) const;
+
+    /// Returns a triangle or quad element \f$e\f$ with \f$p' \in e'\f$, where
+    /// \f$p'\f$ and \f$e'\f$ are the orthogonal projections to the
+    /// \f$x\f$-\f$y\f$ plane of the point and the element. Only the elements of
+    /// the grid cells above and below the point are tested.
+    /// @param p the point
+    /// @param weights the weights for the linear interpolation at \f$p'\f$ in
+    /// \f$e'\f$, see MeshLib::computeInterpolationWeightsXY()
+    /// @return the element or nullptr if the point is not in the projection of
+    /// the mesh
+    MeshLib::Element const* findElementContainingPointXY(
+        MathLib::Point3d const& p, std::array<double, 4>& weights) const;
+
+    /// Interpolates the values given at the nodes linearly at the orthogonal
+    /// projection of the point to the \f$x\f$-\f$y\f$ plane, see
+    /// findElementContainingPointXY().
+    /// @param p the point
+    /// @param node_values the values at the nodes, indexed by the node ids
+    /// @param default_value the value returned if the point is not in the
+    /// projection of the mesh
+    double interpolateNodeValuesXY(MathLib::Point3d const& p,
+                                   std::vector<double> const& node_values,
+                                   double default_value) const;
+
+    /// Finds concurrently for each of the points an element containing it, see
+    /// findElementContainingPoint().
+    template <typename POINT>
+    std::vector<MeshLib::Element const*> findElementsContainingPoints(
+        std::vector<POINT*> const& pnts,
+        double eps = std::numeric_limits<double>::epsilon()) const
+    {
+        std::vector<MeshLib::Element const*> elements(pnts.size());
+        OPENMP_LOOP_TYPE const n_pnts = pnts.size();
+#pragma omp parallel for
+        for (OPENMP_LOOP_TYPE k = 0; k < n_pnts; ++k)
+            elements[k] = findElementContainingPoint(*pnts[k], eps);
+        return elements;
+    }
+
+    /// Interpolates concurrently the values given at the nodes at each of the
+    /// points, see interpolateNodeValuesXY().
+    template <typename POINT>
+    std::vector<double> interpolateNodeValuesXY(
+        std::vector<POINT*> const& pnts, std::vector<double> const& node_values,
+        double default_value) const
+    {
+        std::vector<double> values(pnts.size());
+        OPENMP_LOOP_TYPE const n_pnts = pnts.size();
+#pragma omp parallel for
+        for (OPENMP_LOOP_TYPE k = 0; k < n_pnts; ++k)
+            values[k] =
+                interpolateNodeValuesXY(*pnts[k], node_values, default_value);
+        return values;
+    }
+
     /// Returns the min point of the internal AABB. The method is a wrapper for
     /// GeoLib::AABB::getMinPoint().
     MathLib::Point3d const& getMinPoint() const;
@@ -88,6 +150,10 @@ private:
     /// false.
     std::pair<bool, std::array<std::size_t,3>>
         getGridCellCoordinates(MathLib::Point3d const& p) const;
+    /// Computes the grid cell coordinates for the given point, the coordinates
+    /// of points outside of the grid are clamped to the valid range.
+    std::array<std::size_t, 3> getClampedGridCellCoordinates(
+        MathLib::Point3d const& p) const;
     std::array<double,3> _step_sizes;
     std::array<double,3> _inverse_step_sizes;
     std::array<std::size_t,3> _n_steps;
@@ -11,6 +11,8 @@
 
 #include <memory>
 
+#include <logog/include/logog.hpp>
+
 #include "SimpleMatrixVectorProvider.h"
 
 
@@ -35,4 +37,14 @@ void cleanupGlobalMatrixProviders()
 {
     globalSetupGlobalMatrixVectorProvider.reset();
 }
+
+void shrinkGlobalMatrixProviders()
+{
+    auto& provider = *globalSetupGlobalMatrixVectorProvider;
+    provider.shrink();
+    INFO("%u global matrices and vectors use %g MiB (peak %g MiB).",
+         provider.getNumberOfObjects(),
+         provider.getMemoryUsage() / 1024.0 / 1024.0,
+         provider.getPeakMemoryUsage() / 1024.0 / 1024.0);
+}
 }
@@ -25,4 +25,8 @@ struct GlobalMatrixProvider
 
 void cleanupGlobalMatrixProviders();
 
+//! Frees the global matrices and vectors that are currently not in use, and
+//! logs the memory usage of the remaining ones.
+void shrinkGlobalMatrixProviders();
+
 } // MathLib
@@ -9,7 +9,9 @@
 
 #include "SimpleMatrixVectorProvider.h"
 
+#include <algorithm>
 #include <cassert>
+#include <functional>
 #include <logog/include/logog.hpp>
 
 #include "BaseLib/Error.h"
@@ -21,34 +23,43 @@ namespace LinAlg = MathLib::LinAlg;
 namespace detail
 {
 
-template<typename MatVec>
-MatVec*
-transfer(std::map<std::size_t, MatVec*>& from_unused,
-         std::map<MatVec*, std::size_t>& to_used,
-         typename std::map<std::size_t, MatVec*>::iterator it)
+#ifdef USE_PETSC
+std::size_t memorySize(GlobalVector const& x)
 {
-    auto const id = it->first;
-    auto& ptr = it->second;
+    return x.getLocalSize() * sizeof(PetscScalar);
+}
 
-    auto res = to_used.emplace(ptr, id);
-    assert(res.second && "Emplacement failed.");
-    from_unused.erase(it);
-    return res.first->first;
+std::size_t memorySize(GlobalMatrix const& A)
+{
+    MatInfo info;
+    MatGetInfo(A.getRawMatrix(), MAT_LOCAL, &info);
+    return static_cast<std::size_t>(info.memory);
+}
+#else
+std::size_t memorySize(GlobalVector const& x)
+{
+    return x.size() * sizeof(double);
 }
 
-template<typename MatVec>
-void
-transfer(std::map<MatVec*, std::size_t>& from_used,
-         std::map<std::size_t, MatVec*>& to_unused,
-         typename std::map<MatVec*, std::size_t>::iterator it)
+std::size_t memorySize(GlobalMatrix const& A)
 {
-    auto& ptr = it->first;
-    auto const id = it->second;
+    auto const& raw = A.getRawMatrix();
+    using Raw = std::decay<decltype(raw)>::type;
+    using Scalar = Raw::Scalar;
+    using StorageIndex = Raw::StorageIndex;
+
+    std::size_t bytes = raw.data().allocatedSize() *
+                            (sizeof(Scalar) + sizeof(StorageIndex)) +
+                        (raw.outerSize() + 1) * sizeof(StorageIndex);
+    if (!raw.isCompressed())
+        bytes += raw.outerSize() * sizeof(StorageIndex);
+    return bytes;
+}
+#endif
 
-    auto res = to_unused.emplace(id, ptr);
-    assert(res.second && "Emplacement failed.");
-    (void) res; // res unused if NDEBUG
-    from_used.erase(it);
+void hashCombine(std::size_t& seed, std::size_t const value)
+{
+    seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
 }
 
 } // detail
@@ -57,14 +68,33 @@ transfer(std::map<MatVec*, std::size_t>& from_used,
 namespace NumLib
 {
 
-template<bool do_search, typename MatVec, typename... Args>
-std::pair<MatVec*, bool>
-SimpleMatrixVectorProvider::
-get_(std::size_t& id,
-     std::map<std::size_t, MatVec*>& unused_map,
-     std::map<MatVec*, std::size_t>& used_map,
-     Args&&... args)
+std::size_t SimpleMatrixVectorProvider::ShapeHash::operator()(
+    Shape const& s) const
 {
+    std::size_t seed = std::hash<std::size_t>{}(s.nrows);
+    ::detail::hashCombine(seed, std::hash<std::size_t>{}(s.ncols));
+    ::detail::hashCombine(seed, std::hash<void const*>{}(s.ghost_indices));
+    ::detail::hashCombine(seed, std::hash<void const*>{}(s.sparsity_pattern));
+    return seed;
+}
+
+template <typename MatVec>
+void SimpleMatrixVectorProvider::updateMemoryUsage(
+    MatVec const& x, typename Storage<MatVec>::Entry& entry)
+{
+    _memory_usage -= entry.bytes;
+    entry.bytes = ::detail::memorySize(x);
+    _memory_usage += entry.bytes;
+    _peak_memory_usage = std::max(_peak_memory_usage, _memory_usage);
+}
+
+template <typename MatVec, typename... Args>
+std::pair<MatVec*, bool> SimpleMatrixVectorProvider::get_(
+    std::size_t& id, bool const do_search, Shape const* const shape,
+    Storage<MatVec>& storage, Args&&... args)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
     if (id >= _next_id) {
         OGS_FATAL("An obviously uninitialized id argument has been passed."
             " This might not be a serious error for the current implementation,"
@@ -72,28 +102,129 @@ get_(std::size_t& id,
             " Hence, I will abort now.");
     }
 
+    // Removes the given unused object from its pool and marks it as used.
+    auto const take = [&](MatVec* const ptr) {
+        auto& entry = storage.entries.at(ptr);
+        if (entry.poolable)
+        {
+            auto& pool = storage.unused.at(entry.shape);
+            auto* const last = pool.back();
+            pool[entry.pool_index] = last;
+            storage.entries.at(last).pool_index = entry.pool_index;
+            pool.pop_back();
+        }
+        entry.in_use = true;
+        id = entry.id;
+        updateMemoryUsage(*ptr, entry);
+        return std::make_pair(ptr, false);
+    };
+
     if (do_search)
     {
-        auto it = unused_map.find(id);
-        if (it != unused_map.end()) // unused matrix/vector found
-            return { ::detail::transfer(unused_map, used_map, it), false };
+        auto const it = storage.by_id.find(id);
+        if (it != storage.by_id.end())
+        {
+            auto const& entry = storage.entries.at(it->second);
+            if (!entry.in_use && (!shape || entry.shape == *shape))
+                return take(it->second);
+        }
     }
 
-    // not searched or not found, so create a new one
+    if (shape)
+    {
+        auto const pool = storage.unused.find(*shape);
+        if (pool != storage.unused.end() && !pool->second.empty())
+            return take(pool->second.back());
+    }
+
+    // not found, so create a new one
+    auto* const ptr = MathLib::MatrixVectorTraits<MatVec>::newInstance(
+                          std::forward<Args>(args)...)
+                          .release();
     id = _next_id++;
-    auto res = used_map.emplace(
-        MathLib::MatrixVectorTraits<MatVec>::newInstance(std::forward<Args>(args)...).release(),
-        id);
-    assert(res.second && "Emplacement failed.");
-    return { res.first->first, true };
+    auto& entry =
+        storage.entries
+            .emplace(ptr, typename Storage<MatVec>::Entry{
+                              id, shape ? *shape : Shape{0, 0, nullptr, nullptr},
+                              shape != nullptr, true, 0, 0})
+            .first->second;
+    storage.by_id.emplace(id, ptr);
+    updateMemoryUsage(*ptr, entry);
+    return {ptr, true};
 }
 
-template<bool do_search, typename... Args>
-std::pair<GlobalMatrix*, bool>
-SimpleMatrixVectorProvider::
-getMatrix_(std::size_t& id, Args&&... args)
+template <typename MatVec>
+void SimpleMatrixVectorProvider::release_(MatVec const& x,
+                                          Storage<MatVec>& storage)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto const it = storage.entries.find(&x);
+    if (it == storage.entries.end() || !it->second.in_use) {
+        OGS_FATAL("The given matrix or vector has not been found. Cannot"
+                  " release it. Aborting.");
+    }
+
+    auto& entry = it->second;
+    if (!entry.poolable)
+    {
+        // Nobody else can use an object of unknown shape.
+        _memory_usage -= entry.bytes;
+        storage.by_id.erase(entry.id);
+        storage.entries.erase(it);
+        delete &x;
+        return;
+    }
+
+    auto& pool = storage.unused[entry.shape];
+    entry.in_use = false;
+    entry.pool_index = pool.size();
+    pool.push_back(const_cast<MatVec*>(&x));
+    updateMemoryUsage(x, entry);
+}
+
+template <typename MatVec>
+void SimpleMatrixVectorProvider::shrink_(Storage<MatVec>& storage)
+{
+    for (auto& shape_pool : storage.unused)
+    {
+        for (auto* ptr : shape_pool.second)
+        {
+            auto const it = storage.entries.find(ptr);
+            _memory_usage -= it->second.bytes;
+            storage.by_id.erase(it->second.id);
+            storage.entries.erase(it);
+            delete ptr;
+        }
+    }
+    storage.unused.clear();
+}
+
+template <typename MatVec>
+bool SimpleMatrixVectorProvider::getShape(MatVec const& x,
+                                          Storage<MatVec> const& storage,
+                                          Shape& shape) const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto const it = storage.entries.find(&x);
+    if (it == storage.entries.end() || !it->second.poolable)
+        return false;
+    shape = it->second.shape;
+    return true;
+}
+
+SimpleMatrixVectorProvider::Shape SimpleMatrixVectorProvider::getVectorShape(
+    MathLib::MatrixSpecifications const& ms)
+{
+    // The number of columns and the sparsity pattern do not matter for vectors.
+    return {ms.nrows, 0, ms.ghost_indices, nullptr};
+}
+
+SimpleMatrixVectorProvider::Shape SimpleMatrixVectorProvider::getMatrixShape(
+    MathLib::MatrixSpecifications const& ms)
 {
-    return get_<do_search>(id, _unused_matrices, _used_matrices, std::forward<Args>(args)...);
+    return {ms.nrows, ms.ncols, ms.ghost_indices, ms.sparsity_pattern};
 }
 
 
@@ -102,14 +233,16 @@ SimpleMatrixVectorProvider::
 getMatrix()
 {
     std::size_t id = 0u;
-    return *getMatrix_<false>(id).first;
+    Shape const shape{0, 0, nullptr, nullptr};
+    return *get_(id, false, &shape, _matrices).first;
 }
 
 GlobalMatrix&
 SimpleMatrixVectorProvider::
 getMatrix(std::size_t& id)
 {
-    return *getMatrix_<true>(id).first;
+    Shape const shape{0, 0, nullptr, nullptr};
+    return *get_(id, true, &shape, _matrices).first;
 }
 
 GlobalMatrix&
@@ -117,16 +250,16 @@ SimpleMatrixVectorProvider::
 getMatrix(MathLib::MatrixSpecifications const& ms)
 {
     std::size_t id = 0u;
-    return *getMatrix_<false>(id, ms).first;
-    // TODO assert that the returned object always is of the right size
+    auto const shape = getMatrixShape(ms);
+    return *get_(id, false, &shape, _matrices, ms).first;
 }
 
 GlobalMatrix&
 SimpleMatrixVectorProvider::
 getMatrix(MathLib::MatrixSpecifications const& ms, std::size_t& id)
 {
-    return *getMatrix_<true>(id, ms).first;
-    // TODO assert that the returned object always is of the right size
+    auto const shape = getMatrixShape(ms);
+    return *get_(id, true, &shape, _matrices, ms).first;
 }
 
 GlobalMatrix&
@@ -134,7 +267,10 @@ SimpleMatrixVectorProvider::
 getMatrix(GlobalMatrix const& A)
 {
     std::size_t id = 0u;
-    auto const& res = getMatrix_<false>(id, A);
+    Shape shape;
+    auto const known_shape = getShape(A, _matrices, shape);
+    auto const& res =
+        get_(id, false, known_shape ? &shape : nullptr, _matrices, A);
     if (!res.second) // no new object has been created
         LinAlg::copy(A, *res.first);
     return *res.first;
@@ -144,7 +280,10 @@ GlobalMatrix&
 SimpleMatrixVectorProvider::
 getMatrix(GlobalMatrix const& A, std::size_t& id)
 {
-    auto const& res = getMatrix_<true>(id, A);
+    Shape shape;
+    auto const known_shape = getShape(A, _matrices, shape);
+    auto const& res =
+        get_(id, true, known_shape ? &shape : nullptr, _matrices, A);
     if (!res.second) // no new object has been created
         LinAlg::copy(A, *res.first);
     return *res.first;
@@ -154,36 +293,24 @@ void
 SimpleMatrixVectorProvider::
 releaseMatrix(GlobalMatrix const& A)
 {
-    auto it = _used_matrices.find(const_cast<GlobalMatrix*>(&A));
-    if (it == _used_matrices.end()) {
-        OGS_FATAL("The given matrix has not been found. Cannot release it. Aborting.");
-    } else {
-        ::detail::transfer(_used_matrices, _unused_matrices, it);
-    }
-}
-
-template<bool do_search, typename... Args>
-std::pair<GlobalVector*, bool>
-SimpleMatrixVectorProvider::
-getVector_(std::size_t& id, Args&&... args)
-{
-    return get_<do_search>(id, _unused_vectors, _used_vectors, std::forward<Args>(args)...);
+    release_(A, _matrices);
 }
 
-
 GlobalVector&
 SimpleMatrixVectorProvider::
 getVector()
 {
     std::size_t id = 0u;
-    return *getVector_<false>(id).first;
+    Shape const shape{0, 0, nullptr, nullptr};
+    return *get_(id, false, &shape, _vectors).first;
 }
 
 GlobalVector&
 SimpleMatrixVectorProvider::
 getVector(std::size_t& id)
 {
-    return *getVector_<true>(id).first;
+    Shape const shape{0, 0, nullptr, nullptr};
+    return *get_(id, true, &shape, _vectors).first;
 }
 
 GlobalVector&
@@ -191,16 +318,16 @@ SimpleMatrixVectorProvider::
 getVector(MathLib::MatrixSpecifications const& ms)
 {
     std::size_t id = 0u;
-    return *getVector_<false>(id, ms).first;
-    // TODO assert that the returned object always is of the right size
+    auto const shape = getVectorShape(ms);
+    return *get_(id, false, &shape, _vectors, ms).first;
 }
 
 GlobalVector&
 SimpleMatrixVectorProvider::
 getVector(MathLib::MatrixSpecifications const& ms, std::size_t& id)
 {
-    return *getVector_<true>(id, ms).first;
-    // TODO assert that the returned object always is of the right size
+    auto const shape = getVectorShape(ms);
+    return *get_(id, true, &shape, _vectors, ms).first;
 }
 
 GlobalVector&
@@ -208,7 +335,10 @@ SimpleMatrixVectorProvider::
 getVector(GlobalVector const& x)
 {
     std::size_t id = 0u;
-    auto const& res = getVector_<false>(id, x);
+    Shape shape;
+    auto const known_shape = getShape(x, _vectors, shape);
+    auto const& res =
+        get_(id, false, known_shape ? &shape : nullptr, _vectors, x);
     if (!res.second) // no new object has been created
         LinAlg::copy(x, *res.first);
     return *res.first;
@@ -218,7 +348,10 @@ GlobalVector&
 SimpleMatrixVectorProvider::
 getVector(GlobalVector const& x, std::size_t& id)
 {
-    auto const& res = getVector_<true>(id, x);
+    Shape shape;
+    auto const known_shape = getShape(x, _vectors, shape);
+    auto const& res =
+        get_(id, true, known_shape ? &shape : nullptr, _vectors, x);
     if (!res.second) // no new object has been created
         LinAlg::copy(x, *res.first);
     return *res.first;
@@ -228,33 +361,52 @@ void
 SimpleMatrixVectorProvider::
 releaseVector(GlobalVector const& x)
 {
-    auto it = _used_vectors.find(const_cast<GlobalVector*>(&x));
-    if (it == _used_vectors.end()) {
-        OGS_FATAL("The given vector has not been found. Cannot release it. Aborting.");
-    } else {
-        ::detail::transfer(_used_vectors, _unused_vectors, it);
-    }
+    release_(x, _vectors);
+}
+
+void SimpleMatrixVectorProvider::shrink()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    shrink_(_matrices);
+    shrink_(_vectors);
+}
+
+std::size_t SimpleMatrixVectorProvider::getMemoryUsage() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _memory_usage;
+}
+
+std::size_t SimpleMatrixVectorProvider::getPeakMemoryUsage() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _peak_memory_usage;
+}
+
+std::size_t SimpleMatrixVectorProvider::getNumberOfObjects() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _matrices.entries.size() + _vectors.entries.size();
 }
 
 SimpleMatrixVectorProvider::
 ~SimpleMatrixVectorProvider()
 {
-    if ((!_used_matrices.empty()) || (!_used_vectors.empty())) {
+    if (_matrices.isAnyInUse() || _vectors.isAnyInUse()) {
         WARN("There are still some matrices and vectors in use."
              " This might be an indicator of a possible waste of memory.");
     }
 
-    for (auto& id_ptr : _unused_matrices)
-        delete id_ptr.second;
-
-    for (auto& ptr_id : _used_matrices)
-        delete ptr_id.first;
+    if (_peak_memory_usage > 0)
+        INFO("Peak memory of the global matrices and vectors: %g MiB.",
+             _peak_memory_usage / 1024.0 / 1024.0);
 
-    for (auto& id_ptr : _unused_vectors)
-        delete id_ptr.second;
+    for (auto& ptr_entry : _matrices.entries)
+        delete ptr_entry.first;
 
-    for (auto& ptr_id : _used_vectors)
-        delete ptr_id.first;
+    for (auto& ptr_entry : _vectors.entries)
+        delete ptr_entry.first;
 }
 
 } // MathLib
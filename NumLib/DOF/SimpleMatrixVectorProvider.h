@@ -9,8 +9,10 @@
 
 #pragma once
 
-#include <map>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #include "MatrixProviderUser.h"
 
@@ -21,8 +23,17 @@ namespace NumLib
  *
  * This is a simple implementation of the MatrixProvider and VectorProvider interfaces.
  *
- * It is simple insofar it does not reuse released matrices/vectors, but keeps them in
- * memory until they are acquired again by the user.
+ * Released matrices/vectors are kept in pools, one per shape, i.e., per
+ * MathLib::MatrixSpecifications. They are handed out again to subsequent
+ * requests for the same shape, or for the same id, in constant time. Copies of
+ * matrices/vectors not managed by this provider have no known shape; they
+ * are freed when they are released.
+ *
+ * The memory of all managed matrices/vectors is accounted. The unused ones can
+ * be freed by shrink(), e.g., after temporary objects of the initialization are
+ * not needed anymore.
+ *
+ * Acquiring and releasing matrices/vectors is thread-safe.
  */
 class SimpleMatrixVectorProvider final
         : public MatrixProvider
@@ -57,31 +68,108 @@ public:
 
     void releaseMatrix(GlobalMatrix const& A) override;
 
+    //! Frees all matrices/vectors that are currently not in use.
+    void shrink();
+
+    //! Estimated memory in bytes of all managed matrices/vectors, as of their
+    //! last acquisition or release.
+    std::size_t getMemoryUsage() const;
+
+    //! The maximum of getMemoryUsage() so far.
+    std::size_t getPeakMemoryUsage() const;
+
+    //! Number of managed matrices and vectors, both used and unused.
+    std::size_t getNumberOfObjects() const;
+
     ~SimpleMatrixVectorProvider();
 
 private:
-    template<bool do_search, typename... Args>
-    std::pair<GlobalMatrix*, bool> getMatrix_(std::size_t& id, Args&&... args);
-
-    template<bool do_search, typename... Args>
-    std::pair<GlobalVector*, bool> getVector_(std::size_t& id, Args&&... args);
+    //! Identifies matrices/vectors that can be used interchangeably.
+    struct Shape
+    {
+        std::size_t nrows;
+        std::size_t ncols;
+        void const* ghost_indices;
+        void const* sparsity_pattern;
+
+        bool operator==(Shape const& other) const
+        {
+            return nrows == other.nrows && ncols == other.ncols &&
+                   ghost_indices == other.ghost_indices &&
+                   sparsity_pattern == other.sparsity_pattern;
+        }
+    };
+
+    struct ShapeHash
+    {
+        std::size_t operator()(Shape const& s) const;
+    };
+
+    template <typename MatVec>
+    struct Storage
+    {
+        struct Entry
+        {
+            std::size_t id;
+            Shape shape;
+            //! False for copies of unmanaged objects, which have no known shape.
+            bool poolable;
+            bool in_use;
+            //! Position in the pool of unused objects of the same shape.
+            std::size_t pool_index;
+            //! Memory estimate as of the last acquisition or release.
+            std::size_t bytes;
+        };
+
+        std::unordered_map<MatVec const*, Entry> entries;
+        std::unordered_map<std::size_t, MatVec*> by_id;
+        std::unordered_map<Shape, std::vector<MatVec*>, ShapeHash> unused;
+
+        bool isAnyInUse() const
+        {
+            for (auto const& ptr_entry : entries)
+                if (ptr_entry.second.in_use)
+                    return true;
+            return false;
+        }
+    };
 
     // returns a pair with the pointer to the matrix/vector and
     // a boolean indicating if a new object has been built (then true else false)
-    template<bool do_search, typename MatVec, typename... Args>
-    std::pair<MatVec*, bool>
-    get_(std::size_t& id,
-         std::map<std::size_t, MatVec*>& unused_map,
-         std::map<MatVec*, std::size_t>& used_map,
-         Args&&... args);
+    template <typename MatVec, typename... Args>
+    std::pair<MatVec*, bool> get_(std::size_t& id, bool const do_search,
+                                  Shape const* const shape,
+                                  Storage<MatVec>& storage, Args&&... args);
+
+    template <typename MatVec>
+    void release_(MatVec const& x, Storage<MatVec>& storage);
+
+    template <typename MatVec>
+    void shrink_(Storage<MatVec>& storage);
+
+    //! Determines the shape of the given managed object.
+    //! \return false if the object has no known shape.
+    template <typename MatVec>
+    bool getShape(MatVec const& x, Storage<MatVec> const& storage,
+                  Shape& shape) const;
+
+    static Shape getVectorShape(MathLib::MatrixSpecifications const& ms);
+    static Shape getMatrixShape(MathLib::MatrixSpecifications const& ms);
+
+    template <typename MatVec>
+    void updateMemoryUsage(MatVec const& x,
+                           typename Storage<MatVec>::Entry& entry);
 
     std::size_t _next_id = 1;
 
-    std::map<std::size_t, GlobalMatrix*> _unused_matrices;
-    std::map<GlobalMatrix*, std::size_t> _used_matrices;
+    Storage<GlobalMatrix> _matrices;
+    Storage<GlobalVector> _vectors;
+
+    std::size_t _memory_usage = 0;
+    std::size_t _peak_memory_usage = 0;
 
-    std::map<std::size_t, GlobalVector*> _unused_vectors;
-    std::map<GlobalVector*, std::size_t> _used_vectors;
+    //! Guards the bookkeeping of the used and unused matrices/vectors.
+    mutable std::mutex _mutex;
 };
 
 
@@ -9,6 +9,8 @@
 
 #include "LocalLinearLeastSquaresExtrapolator.h"
 
+#include <algorithm>
+
 #include <Eigen/SVD>
 #include <logog/include/logog.hpp>
 
@@ -21,8 +23,14 @@
 
 namespace NumLib
 {
+namespace
+{
+//! Number of columns multiplied by one thread at a time.
+Eigen::MatrixXd::Index const column_chunk_size = 256;
+}  // namespace
+
 LocalLinearLeastSquaresExtrapolator::LocalLinearLeastSquaresExtrapolator(
-    NumLib::LocalToGlobalIndexMap const& dof_table)
+    NumLib::LocalToGlobalIndexMap const& dof_table, bool const concurrent)
     : _nodal_values(NumLib::GlobalVectorProvider::provider.getVector(
           MathLib::MatrixSpecifications(dof_table.dofSizeWithoutGhosts(),
                                         dof_table.dofSizeWithoutGhosts(),
@@ -34,6 +42,7 @@ LocalLinearLeastSquaresExtrapolator::LocalLinearLeastSquaresExtrapolator(
     , _residuals(dof_table.size(), false)
 #endif
     , _local_to_global(dof_table)
+    , _concurrent(concurrent)
 {
     /* Note in case the following assertion fails:
      * If you copied the extrapolation code, for your processes from
@@ -52,44 +61,216 @@ void LocalLinearLeastSquaresExtrapolator::extrapolate(
 {
     _nodal_values.setZero();
 
-    // counts the writes to each nodal value, i.e., the summands in order to
-    // compute the average afterwards
-    auto counts =
-        MathLib::MatrixVectorTraits<GlobalVector>::newInstance(_nodal_values);
-    counts->setZero();  // TODO BLAS?
+    gatherIntegrationPointValues(extrapolatables);
 
-    auto const size = extrapolatables.size();
-    for (std::size_t i=0; i<size; ++i) {
-        extrapolateElement(i, extrapolatables, *counts);
+    for (auto& key_data : _qr_decomposition_cache)
+    {
+        auto& data = key_data.second;
+        if (data.element_indices.empty())
+            continue;
+
+        // Apply the pre-computed pseudo-inverse to all elements at once.
+        data.nodal_values.resize(data.A.cols(), data.element_indices.size());
+        multiplyColumnwise(data.A_pinv, getIntegrationPointValues(data),
+                           data.nodal_values);
+
+        for (std::size_t k = 0; k < data.element_indices.size(); ++k)
+        {
+            // TODO: for now always zeroth component is used. This has to be
+            // extended if multi-component properties shall be extrapolated
+            auto const& global_indices =
+                _local_to_global(data.element_indices[k], 0).rows;
+
+            // With PETSc the negative indices of ghost nodes are ignored.
+            // That is correct since each partition contains all elements
+            // adjacent to its own nodes, the values at the ghost nodes are
+            // obtained from their owners.
+            _nodal_values.add(global_indices, data.nodal_values.col(k));
+        }
     }
 
-    MathLib::LinAlg::componentwiseDivide(_nodal_values, _nodal_values, *counts);
+    MathLib::LinAlg::finalizeAssembly(_nodal_values);
+    MathLib::LinAlg::componentwiseDivide(_nodal_values, _nodal_values,
+                                         *_counts);
 }
 
 void LocalLinearLeastSquaresExtrapolator::calculateResiduals(
     ExtrapolatableElementCollection const& extrapolatables)
 {
+#ifdef USE_PETSC
+    assert(static_cast<std::size_t>(_residuals.getLocalSize()) ==
+           extrapolatables.size());
+#else
     assert(static_cast<std::size_t>(_residuals.size()) ==
            extrapolatables.size());
+#endif
+
+    // The values at ghost nodes, which have negative indices, are only
+    // readable during a local access.
+    MathLib::LinAlg::ScopedLocalAccess<GlobalVector> const local_access(
+        {&_nodal_values});
+
+    gatherIntegrationPointValues(extrapolatables);
+    auto const element_index_offset = _residuals.getRangeBegin();
+
+    std::vector<double> element_nodal_values;
+
+    for (auto& key_data : _qr_decomposition_cache)
+    {
+        auto& data = key_data.second;
+        if (data.element_indices.empty())
+            continue;
+
+        auto const num_nodes = data.A.cols();
+
+        // filter nodal values of the elements
+        data.nodal_values.resize(num_nodes, data.element_indices.size());
+        for (std::size_t k = 0; k < data.element_indices.size(); ++k)
+        {
+            // TODO: for now always zeroth component is used
+            auto const& global_indices =
+                _local_to_global(data.element_indices[k], 0).rows;
+            _nodal_values.get(global_indices, element_nodal_values);
+            data.nodal_values.col(k) =
+                MathLib::toVector(element_nodal_values);
+        }
+
+        Eigen::MatrixXd interpolated(data.A.rows(),
+                                     data.element_indices.size());
+        multiplyColumnwise(data.A, data.nodal_values, interpolated);
+        Eigen::RowVectorXd const residuals =
+            (interpolated - getIntegrationPointValues(data))
+                .colwise()
+                .squaredNorm();
+
+        auto const num_int_pts = data.A.rows();
+        for (std::size_t k = 0; k < data.element_indices.size(); ++k)
+        {
+            _residuals.set(element_index_offset + data.element_indices[k],
+                           std::sqrt(residuals[k] / num_int_pts));
+        }
+    }
 
+    MathLib::LinAlg::finalizeAssembly(_residuals);
+}
+
+void LocalLinearLeastSquaresExtrapolator::gatherIntegrationPointValues(
+    ExtrapolatableElementCollection const& extrapolatables)
+{
     auto const size = extrapolatables.size();
-    for (std::size_t i=0; i<size; ++i) {
-        calculateResidualElement(i, extrapolatables);
+
+    if (_element_cached_data.size() != size)
+    {
+        // Group the elements by their interpolation matrices. The values are
+        // appended to the groups in the order of the elements.
+        _element_cached_data.assign(size, nullptr);
+        _element_columns.resize(size);
+        for (auto& key_data : _qr_decomposition_cache)
+        {
+            key_data.second.element_indices.clear();
+            key_data.second.integration_point_values.clear();
+        }
+
+        _counts = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(
+            _nodal_values);
+        _counts->setZero();  // TODO BLAS?
+
+        std::vector<double> ones;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            auto const& integration_point_values =
+                extrapolatables.getIntegrationPointValues(
+                    i, _integration_point_values_cache.get());
+
+            auto& data = getCachedData(i, integration_point_values.size(),
+                                       extrapolatables);
+            _element_cached_data[i] = &data;
+            _element_columns[i] = data.element_indices.size();
+            data.element_indices.push_back(i);
+            data.integration_point_values.insert(
+                data.integration_point_values.end(),
+                integration_point_values.begin(),
+                integration_point_values.end());
+
+            // counts the writes to each nodal value, i.e., the summands in
+            // order to compute the average afterwards
+            auto const& global_indices = _local_to_global(i, 0).rows;
+            ones.resize(global_indices.size(), 1.0);
+            _counts->add(global_indices, ones);
+        }
+        // Communicates the counts of the nodes owned by other ranks.
+        MathLib::LinAlg::finalizeAssembly(*_counts);
+        return;
     }
+
+    // Each element writes to its own column of its group.
+    auto gather = [this, &extrapolatables](std::size_t const i) {
+        auto const& integration_point_values =
+            extrapolatables.getIntegrationPointValues(
+                i, _integration_point_values_cache.get());
+
+        auto& data = *_element_cached_data[i];
+        auto const num_int_pts = static_cast<std::size_t>(data.A.rows());
+        if (integration_point_values.size() != num_int_pts)
+        {
+            OGS_FATAL(
+                "The number of integration point values of element %zu changed "
+                "from %zu to %zu.",
+                i, num_int_pts, integration_point_values.size());
+        }
+        std::copy(integration_point_values.begin(),
+                  integration_point_values.end(),
+                  data.integration_point_values.begin() +
+                      _element_columns[i] * num_int_pts);
+    };
+
+    if (!_concurrent || BaseLib::isInParallelRegion())
+    {
+        for (std::size_t i = 0; i < size; ++i)
+            gather(i);
+        return;
+    }
+
+    // Errors of single elements are raised after the parallel loop.
+    BaseLib::FirstException first_exception;
+    OPENMP_LOOP_TYPE const n_elements = size;
+#pragma omp parallel for schedule(dynamic, 64)
+    for (OPENMP_LOOP_TYPE i = 0; i < n_elements; ++i)
+        first_exception.run([&gather, i] { gather(i); });
+    first_exception.rethrow();
 }
 
-void LocalLinearLeastSquaresExtrapolator::extrapolateElement(
-    std::size_t const element_index,
-    ExtrapolatableElementCollection const& extrapolatables,
-    GlobalVector& counts)
+template <typename Result, typename Values>
+void LocalLinearLeastSquaresExtrapolator::multiplyColumnwise(
+    Eigen::MatrixXd const& matrix, Values const& values, Result& result) const
 {
-    auto const& integration_point_values =
-        extrapolatables.getIntegrationPointValues(
-            element_index, _integration_point_values_cache);
+    auto const n_columns = values.cols();
+    if (!_concurrent || BaseLib::isInParallelRegion() ||
+        n_columns <= column_chunk_size)
+    {
+        result.noalias() = matrix * values;
+        return;
+    }
 
+    OPENMP_LOOP_TYPE const n_chunks =
+        (n_columns + column_chunk_size - 1) / column_chunk_size;
+#pragma omp parallel for
+    for (OPENMP_LOOP_TYPE c = 0; c < n_chunks; ++c)
+    {
+        auto const first = c * column_chunk_size;
+        auto const n = std::min(column_chunk_size, n_columns - first);
+        result.middleCols(first, n).noalias() =
+            matrix * values.middleCols(first, n);
+    }
+}
+
+LocalLinearLeastSquaresExtrapolator::CachedData&
+LocalLinearLeastSquaresExtrapolator::getCachedData(
+    std::size_t const element_index, unsigned const num_int_pts,
+    ExtrapolatableElementCollection const& extrapolatables)
+{
     auto const& N_0 = extrapolatables.getShapeMatrix(element_index, 0);
     const unsigned num_nodes = static_cast<unsigned>(N_0.cols());
-    const unsigned num_int_pts = integration_point_values.size();
 
     assert(num_int_pts >= num_nodes &&
            "Least squares is not possible if there are more nodes than"
@@ -145,51 +326,7 @@ void LocalLinearLeastSquaresExtrapolator::extrapolateElement(
         OGS_FATAL("The cached and the passed shapematrices differ.");
     }
 
-    // TODO make gp_vals an Eigen::VectorXd const& ?
-    auto const integration_point_values_vec =
-        MathLib::toVector(integration_point_values);
-
-    // Apply the pre-computed pseudo-inverse.
-    Eigen::VectorXd const nodal_values =
-        cached_data.A_pinv * integration_point_values_vec;
-
-    // TODO: for now always zeroth component is used. This has to be extended if
-    // multi-component properties shall be extrapolated
-    auto const& global_indices = _local_to_global(element_index, 0).rows;
-
-    // TODO does that give rise to PETSc problems?
-    _nodal_values.add(global_indices, nodal_values);
-    counts.add(global_indices, std::vector<double>(global_indices.size(), 1.0));
-}
-
-void LocalLinearLeastSquaresExtrapolator::calculateResidualElement(
-    std::size_t const element_index,
-    ExtrapolatableElementCollection const& extrapolatables)
-{
-    auto const& int_pt_vals = extrapolatables.getIntegrationPointValues(
-        element_index, _integration_point_values_cache);
-
-    // TODO: for now always zeroth component is used
-    const auto& global_indices = _local_to_global(element_index, 0).rows;
-
-    const unsigned num_int_pts = int_pt_vals.size();
-    const unsigned num_nodes = global_indices.size();
-
-    // filter nodal values of the current element
-    Eigen::VectorXd nodal_vals_element(num_nodes);
-    for (unsigned i = 0; i < num_nodes; ++i) {
-        // TODO PETSc negative indices?
-        nodal_vals_element[i] = _nodal_values[global_indices[i]];
-    }
-
-    auto const& interpolation_matrix =
-        _qr_decomposition_cache.find({num_nodes, num_int_pts})->second.A;
-
-    double const residual = (interpolation_matrix * nodal_vals_element -
-                             MathLib::toVector(int_pt_vals))
-                                .squaredNorm();
-
-    _residuals.set(element_index, std::sqrt(residual / num_int_pts));
+    return cached_data;
 }
 
 }  // namespace NumLib
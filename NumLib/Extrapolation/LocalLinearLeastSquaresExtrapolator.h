@@ -10,7 +10,10 @@
 #pragma once
 
 #include <map>
+#include <memory>
+#include <vector>
 
+#include "BaseLib/PerThread.h"
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
 #include "NumLib/DOF/GlobalMatrixProviders.h"
 #include "Extrapolator.h"
@@ -35,6 +38,16 @@ namespace NumLib
  * the use of the least squares which requires an exact or overdetermined equation
  * system.
  * \endparblock
+ *
+ * Elements sharing the same interpolation matrix are processed together: Their
+ * integration point values are gathered column-wise into one matrix, such that
+ * the pseudo-inverse is applied to all of them with a single matrix product.
+ * The grouping of the elements and the number of contributions to each nodal
+ * value are computed during the first extrapolation only.
+ *
+ * In the concurrent mode the integration point values of the elements are
+ * collected and the pseudo-inverses are applied by OpenMP threads. The
+ * contributions are added to the global vectors by the calling thread.
  */
 class LocalLinearLeastSquaresExtrapolator : public Extrapolator
 {
@@ -44,9 +57,13 @@ public:
      * \note
      * The \c dof_table must point to a d.o.f. table for one single-component
      * variable.
+     *
+     * If \c concurrent is set, the integration point values are requested
+     * from the extrapolatables by several threads at the same time.
      */
     explicit LocalLinearLeastSquaresExtrapolator(
-        NumLib::LocalToGlobalIndexMap const& dof_table);
+        NumLib::LocalToGlobalIndexMap const& dof_table,
+        bool const concurrent = false);
 
     void extrapolate(
             ExtrapolatableElementCollection const& extrapolatables) override;
@@ -78,35 +95,83 @@ public:
     }
 
 private:
-    //! Extrapolate one element.
-    void extrapolateElement(
-        std::size_t const element_index,
-        ExtrapolatableElementCollection const& extrapolatables,
-        GlobalVector& counts);
-
-    //! Compute the residuals for one element
-    void calculateResidualElement(
-        std::size_t const element_index,
+    //! Stores a matrix and its Moore-Penrose pseudo-inverse.
+    struct CachedData
+    {
+        //! The matrix A.
+        Eigen::MatrixXd A;
+
+        //! Moore-Penrose pseudo-inverse of A.
+        Eigen::MatrixXd A_pinv;
+
+        //! Indices of all elements whose interpolation matrix is A.
+        std::vector<std::size_t> element_indices;
+
+        //! Integration point values of all elements in element_indices,
+        //! stored column-wise, i.e., element after element.
+        std::vector<double> integration_point_values;
+
+        //! Avoids frequent reallocations.
+        Eigen::MatrixXd nodal_values;
+    };
+
+    /*! Collects the integration point values of all elements into the
+     * CachedData::integration_point_values of the element groups.
+     *
+     * During the first call the elements are grouped by their interpolation
+     * matrices and the counts of contributions to the nodal values are
+     * computed. Later calls write the values of each element to its column
+     * of the group, concurrently in the concurrent mode.
+     */
+    void gatherIntegrationPointValues(
         ExtrapolatableElementCollection const& extrapolatables);
 
+    //! Returns the cached data for the element with the given index, computes
+    //! the pseudo-inverse if necessary.
+    CachedData& getCachedData(
+        std::size_t const element_index, unsigned const num_int_pts,
+        ExtrapolatableElementCollection const& extrapolatables);
+
+    //! Returns the integration point values of the elements of \c data as a
+    //! matrix with one column per element.
+    static Eigen::Map<const Eigen::MatrixXd> getIntegrationPointValues(
+        CachedData const& data)
+    {
+        return {data.integration_point_values.data(), data.A.rows(),
+                static_cast<Eigen::MatrixXd::Index>(
+                    data.element_indices.size())};
+    }
+
+    /*! Computes \c result = \c matrix * \c values for all columns of \c
+     * values, in chunks of columns by OpenMP threads in the concurrent mode.
+     * The \c result has to be sized already.
+     */
+    template <typename Result, typename Values>
+    void multiplyColumnwise(Eigen::MatrixXd const& matrix,
+                            Values const& values, Result& result) const;
+
     GlobalVector& _nodal_values;  //!< extrapolated nodal values
     GlobalVector _residuals;      //!< extrapolation residuals
 
+    //! Number of contributions to each nodal value, needed for averaging.
+    std::unique_ptr<GlobalVector> _counts;
+
     //! DOF table used for writing to global vectors.
     NumLib::LocalToGlobalIndexMap const& _local_to_global;
 
+    //! Whether the elements are processed by OpenMP threads.
+    bool const _concurrent;
+
     //! Avoids frequent reallocations.
-    std::vector<double> _integration_point_values_cache;
+    BaseLib::PerThread<std::vector<double>> _integration_point_values_cache;
 
-    //! Stores a matrix and its Moore-Penrose pseudo-inverse.
-    struct CachedData
-    {
-        //! The matrix A.
-        Eigen::MatrixXd A;
+    //! Maps each element to its entry in _qr_decomposition_cache. Empty until
+    //! the first extrapolation.
+    std::vector<CachedData*> _element_cached_data;
 
-        //! Moore-Penrose pseudo-inverse of A.
-        Eigen::MatrixXd A_pinv;
-    };
+    //! The column of each element in the matrix of the integration point
+    //! values of its group.
+    std::vector<std::size_t> _element_columns;
 
     /*! Maps (\#nodes, \#int_pts) to (N_0, QR decomposition), where N_0 is the
      * shape matrix of the first integration point.
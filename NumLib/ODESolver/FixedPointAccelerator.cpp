@@ -0,0 +1,259 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "FixedPointAccelerator.h"
+
+#include <cmath>
+#include <Eigen/Dense>
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/ConfigTree.h"
+#include "BaseLib/Error.h"
+#include "MathLib/LinAlg/LinAlg.h"
+#include "NumLib/DOF/GlobalMatrixProviders.h"
+
+namespace
+{
+//! Scalar product of two block vectors.
+template <typename BlockVector1, typename BlockVector2>
+double blockDot(BlockVector1 const& x, BlockVector2 const& y)
+{
+    double result = 0.0;
+    for (std::size_t i = 0; i < x.size(); ++i)
+        result += MathLib::LinAlg::dot(*x[i], *y[i]);
+    return result;
+}
+
+//! Allocates the blocks of \c x with the sizes of the blocks of \c like,
+//! unless already done.
+void allocate(std::vector<GlobalVector*>& x,
+              std::vector<GlobalVector const*> const& like)
+{
+    if (!x.empty())
+        return;
+    for (auto const* block : like)
+        x.push_back(&NumLib::GlobalVectorProvider::provider.getVector(*block));
+}
+
+void release(std::vector<GlobalVector*>& x)
+{
+    for (auto* block : x)
+        NumLib::GlobalVectorProvider::provider.releaseVector(*block);
+    x.clear();
+}
+
+//! Computes <tt>x = a - b</tt> blockwise.
+template <typename BlockVector>
+void setToDifference(std::vector<GlobalVector*> const& x, BlockVector const& a,
+                     std::vector<GlobalVector*> const& b)
+{
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        MathLib::LinAlg::copy(*a[i], *x[i]);
+        MathLib::LinAlg::axpy(*x[i], -1.0, *b[i]);
+    }
+}
+
+template <typename BlockVector>
+void copyBlocks(BlockVector const& x, std::vector<GlobalVector*> const& y)
+{
+    for (std::size_t i = 0; i < x.size(); ++i)
+        MathLib::LinAlg::copy(*x[i], *y[i]);
+}
+}  // namespace
+
+namespace NumLib
+{
+AitkenRelaxation::AitkenRelaxation(double const initial_relaxation)
+    : _initial_relaxation(initial_relaxation), _omega(initial_relaxation)
+{
+    if (!(initial_relaxation > 0.0))
+        OGS_FATAL(
+            "The initial relaxation factor of the Aitken relaxation must be "
+            "positive, got %g.",
+            initial_relaxation);
+}
+
+void AitkenRelaxation::reset()
+{
+    _omega = _initial_relaxation;
+    _has_previous_iteration = false;
+}
+
+void AitkenRelaxation::accelerate(
+    std::vector<GlobalVector*> const& x,
+    std::vector<GlobalVector const*> const& residual)
+{
+    allocate(_residual_prev, residual);
+
+    if (_has_previous_iteration)
+    {
+        // _residual_prev becomes r_k - r_{k-1}.
+        for (std::size_t i = 0; i < x.size(); ++i)
+            MathLib::LinAlg::aypx(*_residual_prev[i], -1.0, *residual[i]);
+
+        double const delta_r_squared = blockDot(_residual_prev, _residual_prev);
+        if (delta_r_squared > 0.0)
+        {
+            double const r_prev_delta_r =
+                blockDot(residual, _residual_prev) - delta_r_squared;
+            double const omega = -_omega * r_prev_delta_r / delta_r_squared;
+            if (std::isfinite(omega))
+                _omega = omega;
+        }
+    }
+    copyBlocks(residual, _residual_prev);
+    _has_previous_iteration = true;
+
+    DBUG("Aitken relaxation factor %g.", _omega);
+
+    // x_{k+1} = x_k + omega r_k = G(x_k) + (omega - 1) r_k
+    for (std::size_t i = 0; i < x.size(); ++i)
+        MathLib::LinAlg::axpy(*x[i], _omega - 1.0, *residual[i]);
+}
+
+AitkenRelaxation::~AitkenRelaxation()
+{
+    release(_residual_prev);
+}
+
+AndersonMixing::AndersonMixing(unsigned const depth,
+                               double const mixing_parameter)
+    : _depth(depth),
+      _beta(mixing_parameter),
+      _delta_residuals(depth),
+      _delta_gs(depth)
+{
+    if (depth == 0)
+        OGS_FATAL("The depth of the Anderson mixing must be positive.");
+    if (!(mixing_parameter > 0.0))
+        OGS_FATAL(
+            "The mixing parameter of the Anderson mixing must be positive, got "
+            "%g.",
+            mixing_parameter);
+}
+
+void AndersonMixing::reset()
+{
+    _has_previous_iteration = false;
+    _history_begin = 0;
+    _history_size = 0;
+}
+
+void AndersonMixing::accelerate(
+    std::vector<GlobalVector*> const& x,
+    std::vector<GlobalVector const*> const& residual)
+{
+    allocate(_residual_prev, residual);
+    allocate(_g_prev, residual);
+
+    if (_has_previous_iteration)
+    {
+        unsigned index;
+        if (_history_size < _depth)
+        {
+            index = (_history_begin + _history_size) % _depth;
+            ++_history_size;
+        }
+        else
+        {
+            // Overwrite the oldest entry.
+            index = _history_begin;
+            _history_begin = (_history_begin + 1) % _depth;
+        }
+
+        allocate(_delta_residuals[index], residual);
+        allocate(_delta_gs[index], residual);
+        setToDifference(_delta_residuals[index], residual, _residual_prev);
+        setToDifference(_delta_gs[index], x, _g_prev);
+    }
+    copyBlocks(residual, _residual_prev);
+    copyBlocks(x, _g_prev);
+    _has_previous_iteration = true;
+
+    // Without history this is a relaxed fixed-point step.
+    for (std::size_t i = 0; i < x.size(); ++i)
+        MathLib::LinAlg::axpy(*x[i], _beta - 1.0, *residual[i]);
+
+    if (_history_size == 0)
+        return;
+
+    auto const entry = [this](unsigned const i) {
+        return (_history_begin + i) % _depth;
+    };
+
+    Eigen::MatrixXd A(_history_size, _history_size);
+    Eigen::VectorXd b(_history_size);
+    for (unsigned i = 0; i < _history_size; ++i)
+    {
+        auto const& delta_r_i = _delta_residuals[entry(i)];
+        b[i] = blockDot(delta_r_i, residual);
+        for (unsigned j = 0; j <= i; ++j)
+        {
+            A(i, j) = blockDot(delta_r_i, _delta_residuals[entry(j)]);
+            A(j, i) = A(i, j);
+        }
+    }
+    Eigen::VectorXd const gamma = A.colPivHouseholderQr().solve(b);
+
+    for (unsigned i = 0; i < _history_size; ++i)
+    {
+        if (!std::isfinite(gamma[i]))
+            continue;
+        auto const& delta_r_i = _delta_residuals[entry(i)];
+        auto const& delta_g_i = _delta_gs[entry(i)];
+        for (std::size_t k = 0; k < x.size(); ++k)
+        {
+            MathLib::LinAlg::axpy(*x[k], -gamma[i], *delta_g_i[k]);
+            MathLib::LinAlg::axpy(*x[k], (1.0 - _beta) * gamma[i],
+                                  *delta_r_i[k]);
+        }
+    }
+}
+
+AndersonMixing::~AndersonMixing()
+{
+    release(_residual_prev);
+    release(_g_prev);
+    for (auto& delta_r : _delta_residuals)
+        release(delta_r);
+    for (auto& delta_g : _delta_gs)
+        release(delta_g);
+}
+
+std::unique_ptr<FixedPointAccelerator> createFixedPointAccelerator(
+    BaseLib::ConfigTree const& config)
+{
+    //! \ogs_file_param{prj__time_loop__global_process_coupling__acceleration__type}
+    auto const type = config.getConfigParameter<std::string>("type");
+
+    if (type == "Aitken")
+    {
+        auto const initial_relaxation =
+            //! \ogs_file_param{prj__time_loop__global_process_coupling__acceleration__Aitken__initial_relaxation}
+            config.getConfigParameter<double>("initial_relaxation", 0.5);
+        return std::unique_ptr<FixedPointAccelerator>(
+            new AitkenRelaxation(initial_relaxation));
+    }
+    if (type == "Anderson")
+    {
+        auto const depth =
+            //! \ogs_file_param{prj__time_loop__global_process_coupling__acceleration__Anderson__depth}
+            config.getConfigParameter<unsigned>("depth", 5);
+        auto const mixing_parameter =
+            //! \ogs_file_param{prj__time_loop__global_process_coupling__acceleration__Anderson__mixing_parameter}
+            config.getConfigParameter<double>("mixing_parameter", 1.0);
+        return std::unique_ptr<FixedPointAccelerator>(
+            new AndersonMixing(depth, mixing_parameter));
+    }
+
+    OGS_FATAL("Unknown fixed-point acceleration type `%s'.", type.c_str());
+}
+
+}  // namespace NumLib
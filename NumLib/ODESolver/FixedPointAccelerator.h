@@ -0,0 +1,133 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "NumLib/NumericsConfig.h"
+
+namespace BaseLib
+{
+class ConfigTree;
+}
+
+namespace NumLib
+{
+//! \addtogroup ODESolver
+//! @{
+
+/*! Acceleration of a fixed-point iteration \f$ x_{k+1} = G(x_k) \f$, e.g., of
+ * the coupling iteration of the staggered scheme.
+ *
+ * The unknowns may consist of several vectors, e.g., of the solutions of
+ * several processes. They are treated as the blocks of a single vector.
+ */
+class FixedPointAccelerator
+{
+public:
+    //! Forgets the iteration history. To be called before a new fixed-point
+    //! iteration starts, e.g., at the beginning of a time step.
+    virtual void reset() = 0;
+
+    /*! Computes the next iterate.
+     *
+     * \param x        on input the result \f$ G(x_k) \f$ of the last
+     *                 fixed-point iteration, on output the accelerated iterate
+     *                 \f$ x_{k+1} \f$.
+     * \param residual the fixed-point residual \f$ r_k = G(x_k) - x_k \f$.
+     */
+    virtual void accelerate(
+        std::vector<GlobalVector*> const& x,
+        std::vector<GlobalVector const*> const& residual) = 0;
+
+    virtual ~FixedPointAccelerator() = default;
+};
+
+/*! Aitken's dynamic relaxation.
+ *
+ * The next iterate is \f$ x_{k+1} = x_k + \omega_k r_k \f$ with the relaxation
+ * factor
+ * \f[ \omega_k = -\omega_{k-1} \frac{r_{k-1} \cdot (r_k - r_{k-1})}
+ *                                   {|r_k - r_{k-1}|^2}, \f]
+ * which is computed from the last two residuals. The first iteration uses the
+ * given initial relaxation factor.
+ */
+class AitkenRelaxation final : public FixedPointAccelerator
+{
+public:
+    explicit AitkenRelaxation(double const initial_relaxation);
+
+    void reset() override;
+
+    void accelerate(std::vector<GlobalVector*> const& x,
+                    std::vector<GlobalVector const*> const& residual) override;
+
+    //! Relaxation factor used in the last call of accelerate().
+    double getRelaxation() const { return _omega; }
+
+    ~AitkenRelaxation();
+
+private:
+    double const _initial_relaxation;
+    double _omega;
+
+    //! Residual of the previous iteration.
+    std::vector<GlobalVector*> _residual_prev;
+    bool _has_previous_iteration = false;
+};
+
+/*! Anderson mixing (type II Anderson acceleration).
+ *
+ * The residual is minimized in the span of the differences of the last \c
+ * depth residuals \f$ \Delta R \f$:
+ * \f[ \gamma = \arg\min_\gamma |r_k - \Delta R \gamma|. \f]
+ * With the corresponding differences \f$ \Delta G \f$ of the values of
+ * \f$ G \f$ and the mixing parameter \f$ \beta \f$ the next iterate is
+ * \f[ x_{k+1} = G(x_k) - (1-\beta) r_k - (\Delta G - (1-\beta) \Delta R)
+ *               \gamma. \f]
+ * The least squares problem is solved via its small dense normal equations.
+ */
+class AndersonMixing final : public FixedPointAccelerator
+{
+public:
+    AndersonMixing(unsigned const depth, double const mixing_parameter);
+
+    void reset() override;
+
+    void accelerate(std::vector<GlobalVector*> const& x,
+                    std::vector<GlobalVector const*> const& residual) override;
+
+    ~AndersonMixing();
+
+private:
+    unsigned const _depth;
+    double const _beta;
+
+    //! Residual and value of \f$ G \f$ of the previous iteration.
+    std::vector<GlobalVector*> _residual_prev;
+    std::vector<GlobalVector*> _g_prev;
+    bool _has_previous_iteration = false;
+
+    //! Ring buffers of the residual and \f$ G \f$ differences. The newest
+    //! entry is at position <tt>(_history_begin + _history_size - 1) %
+    //! _depth</tt>.
+    std::vector<std::vector<GlobalVector*>> _delta_residuals;
+    std::vector<std::vector<GlobalVector*>> _delta_gs;
+    unsigned _history_begin = 0;
+    unsigned _history_size = 0;
+};
+
+//! Creates a fixed-point accelerator from the given configuration.
+std::unique_ptr<FixedPointAccelerator> createFixedPointAccelerator(
+    BaseLib::ConfigTree const& config);
+
+//! @}
+}  // namespace NumLib
@@ -286,6 +286,15 @@ private:
     mutable std::size_t _tmp_id = 0u;
 };
 
+//! Returns true if the given time discretization scheme is handled by the
+//! MatrixTranslatorGeneral, i.e., if its weights can already be applied to the
+//! element contributions during the assembly.
+inline bool isGeneralTimeDiscretization(TimeDiscretization const& timeDisc)
+{
+    return dynamic_cast<ForwardEuler const*>(&timeDisc) == nullptr &&
+           dynamic_cast<CrankNicolson const*>(&timeDisc) == nullptr;
+}
+
 //! Creates a GlobalMatrix translator suitable to work together with the given
 //! time discretization scheme.
 template <ODESystemTag ODETag>
@@ -158,6 +158,13 @@ bool NonlinearSolver<NonlinearSolverTag::Picard>::solve(
     return error_norms_met;
 }
 
+NonlinearSolver<NonlinearSolverTag::Newton>::~NonlinearSolver()
+{
+    if (_first_minus_delta_x)
+        NumLib::GlobalVectorProvider::provider.releaseVector(
+            *_first_minus_delta_x);
+}
+
 void NonlinearSolver<NonlinearSolverTag::Newton>::assemble(
     GlobalVector const& x,
     ProcessLib::StaggeredCouplingTerm const& coupling_term) const
@@ -188,7 +195,13 @@ bool NonlinearSolver<NonlinearSolverTag::Newton>::solve(
     // TODO be more efficient
     // init _minus_delta_x to the right size and 0.0
     LinAlg::copy(x, minus_delta_x);
-    minus_delta_x.setZero();
+    // The correction of the first iteration changes smoothly from timestep to
+    // timestep and is a better initial guess for iterative linear solvers.
+    if (_linear_solver_warm_start && _first_minus_delta_x &&
+        _first_minus_delta_x->size() == minus_delta_x.size())
+        LinAlg::copy(*_first_minus_delta_x, minus_delta_x);
+    else
+        minus_delta_x.setZero();
 
     _convergence_criterion->preFirstIteration();
 
@@ -227,6 +240,23 @@ bool NonlinearSolver<NonlinearSolverTag::Newton>::solve(
         }
         else
         {
+            if (_linear_solver_warm_start && iteration == 1)
+            {
+                if (_first_minus_delta_x &&
+                    _first_minus_delta_x->size() != minus_delta_x.size())
+                {
+                    NumLib::GlobalVectorProvider::provider.releaseVector(
+                        *_first_minus_delta_x);
+                    _first_minus_delta_x = nullptr;
+                }
+                if (!_first_minus_delta_x)
+                    _first_minus_delta_x =
+                        &NumLib::GlobalVectorProvider::provider.getVector(
+                            minus_delta_x, _first_minus_delta_x_id);
+                else
+                    LinAlg::copy(minus_delta_x, *_first_minus_delta_x);
+            }
+
             // TODO could be solved in a better way
             // cf.
             // http://www.mcs.anl.gov/petsc/petsc-current/docs/manualpages/Vec/VecWAXPY.html
@@ -324,11 +354,14 @@ createNonlinearSolver(GlobalLinearSolver& linear_solver,
                 new ConcreteNLS{linear_solver, max_iter}),
             tag);
     } else if (type == "Newton") {
+        auto const linear_solver_warm_start =
+            //! \ogs_file_param{prj__nonlinear_solvers__nonlinear_solver__linear_solver_warm_start}
+            config.getConfigParameter<bool>("linear_solver_warm_start", false);
         auto const tag = NonlinearSolverTag::Newton;
         using ConcreteNLS = NonlinearSolver<tag>;
         return std::make_pair(
-            std::unique_ptr<AbstractNLS>(
-                new ConcreteNLS{linear_solver, max_iter}),
+            std::unique_ptr<AbstractNLS>(new ConcreteNLS{
+                linear_solver, max_iter, linear_solver_warm_start}),
             tag);
     }
     OGS_FATAL("Unsupported nonlinear solver type");
@@ -71,6 +71,9 @@ public:
                        std::function<void(unsigned, GlobalVector const&)> const&
                            postIterationCallback) = 0;
 
+    //! Returns the linear solver used by this nonlinear solver.
+    virtual GlobalLinearSolver const& getLinearSolver() const = 0;
+
     virtual ~NonlinearSolverBase() = default;
 };
 
@@ -100,15 +103,22 @@ public:
      * \param linear_solver the linear solver used by this nonlinear solver.
      * \param maxiter the maximum number of iterations used to solve the
      *                equation.
+     * \param linear_solver_warm_start if true, the first linear solve of each
+     *                call to solve() starts from the Newton correction of the
+     *                first iteration of the preceding call instead of zero.
      */
     explicit NonlinearSolver(
         GlobalLinearSolver& linear_solver,
-        const unsigned maxiter)
+        const unsigned maxiter,
+        bool const linear_solver_warm_start = false)
         : _linear_solver(linear_solver),
-          _maxiter(maxiter)
+          _maxiter(maxiter),
+          _linear_solver_warm_start(linear_solver_warm_start)
     {
     }
 
+    ~NonlinearSolver();
+
     //! Set the nonlinear equation system that will be solved.
     //! TODO doc
     void setEquationSystem(System& eq, ConvergenceCriterion& conv_crit)
@@ -126,6 +136,11 @@ public:
                std::function<void(unsigned, GlobalVector const&)> const&
                    postIterationCallback) override;
 
+    GlobalLinearSolver const& getLinearSolver() const override
+    {
+        return _linear_solver;
+    }
+
 private:
     GlobalLinearSolver& _linear_solver;
     System* _equation_system = nullptr;
@@ -142,6 +157,14 @@ private:
     std::size_t _minus_delta_x_id = 0u;  //!< ID of the \f$ -\Delta x\f$ vector.
     std::size_t _x_new_id =
         0u;  //!< ID of the vector storing \f$ x - (-\Delta x) \f$.
+
+    bool const _linear_solver_warm_start;
+    //! \f$ -\Delta x\f$ of the first iteration of the last call to solve(),
+    //! the initial guess of the first linear solve if warm started. It is
+    //! kept from the vector provider until the solver is destroyed.
+    GlobalVector* _first_minus_delta_x = nullptr;
+    //! ID of the #_first_minus_delta_x vector.
+    std::size_t _first_minus_delta_x_id = 0u;
 };
 
 /*! Find a solution to a nonlinear equation using the Picard fixpoint iteration
@@ -185,6 +208,11 @@ public:
                std::function<void(unsigned, GlobalVector const&)> const&
                    postIterationCallback) override;
 
+    GlobalLinearSolver const& getLinearSolver() const override
+    {
+        return _linear_solver;
+    }
+
 private:
     GlobalLinearSolver& _linear_solver;
     System* _equation_system = nullptr;
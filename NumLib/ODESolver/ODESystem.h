@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "BaseLib/Error.h"
 #include "MathLib/LinAlg/MatrixVectorTraits.h"
 #include "NumLib/IndexValueVector.h"
 
@@ -55,6 +56,30 @@ public:
         GlobalVector& b,
         ProcessLib::StaggeredCouplingTerm const& coupling_term) = 0;
 
+    //! Indicates whether the ODE can assemble its time discretized form
+    //! directly, i.e., whether assembleTimeDiscretized() and, for the Newton
+    //! method, assembleResidualWithJacobian() are implemented.
+    virtual bool hasTimeDiscretizedAssembly() const { return false; }
+
+    /*! Assembles the time discretized linear system
+     * \f$ A \cdot x_N = \mathtt{rhs} \f$ with
+     * \f$ A = M \cdot \partial \hat x/\partial x_N + K \f$ and
+     * \f$ \mathtt{rhs} = M \cdot \mathtt{weighted\_old\_x} + b \f$
+     * at the provided state (\c t, \c x) without assembling the global
+     * matrices \c M and \c K.
+     *
+     * This is only valid for time discretization schemes for which the current
+     * state \f$ x_C \f$ equals the new state \f$ x_N \f$.
+     */
+    virtual void assembleTimeDiscretized(
+        const double /*t*/, GlobalVector const& /*x*/, const double /*dxdot_dx*/,
+        GlobalVector const& /*weighted_old_x*/, GlobalMatrix& /*A*/,
+        GlobalVector& /*rhs*/,
+        ProcessLib::StaggeredCouplingTerm const& /*coupling_term*/)
+    {
+        OGS_FATAL("The time discretized assembly is not implemented.");
+    }
+
     using Index = MathLib::MatrixVectorTraits<GlobalMatrix>::Index;
 
     //! Provides known solutions (Dirichlet boundary conditions) vector for
@@ -128,6 +153,22 @@ public:
         const double dxdot_dx, const double dx_dx, GlobalMatrix& M,
         GlobalMatrix& K, GlobalVector& b, GlobalMatrix& Jac,
         ProcessLib::StaggeredCouplingTerm const& coupling_term) = 0;
+
+    /*! Assembles the residual
+     * \f$ r = M \cdot \hat x + K \cdot x_N - b \f$ and its Jacobian
+     * \c Jac at the provided state (\c t, \c x) without assembling the
+     * global matrices \c M and \c K.
+     *
+     * The same restrictions as for assembleTimeDiscretized() apply.
+     */
+    virtual void assembleResidualWithJacobian(
+        const double /*t*/, GlobalVector const& /*x*/,
+        GlobalVector const& /*xdot*/, const double /*dxdot_dx*/,
+        const double /*dx_dx*/, GlobalVector& /*res*/, GlobalMatrix& /*Jac*/,
+        ProcessLib::StaggeredCouplingTerm const& /*coupling_term*/)
+    {
+        OGS_FATAL("The time discretized assembly is not implemented.");
+    }
 };
 
 //! @}
@@ -0,0 +1,128 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "SolutionPredictor.h"
+
+#include <algorithm>
+
+#include "BaseLib/Error.h"
+#include "MathLib/LinAlg/LinAlg.h"
+#include "NumLib/DOF/GlobalMatrixProviders.h"
+
+namespace NumLib
+{
+std::size_t SolutionPredictor::getHistoryLength() const
+{
+    switch (_type)
+    {
+        case Type::Linear:
+            return 2;
+        case Type::Quadratic:
+            return 3;
+        case Type::ExplicitEuler:
+            return 1;
+    }
+    OGS_FATAL("Unknown predictor type.");
+}
+
+void SolutionPredictor::pushSolution(double const t, GlobalVector const& x,
+                                     GlobalVector const* const xdot)
+{
+    if (_times.empty() || t != _times.front())
+    {
+        if (_solutions.size() < getHistoryLength())
+        {
+            _solutions.push_back(
+                &NumLib::GlobalVectorProvider::provider.getVector(x));
+            _times.push_back(t);
+        }
+        // Reuse the oldest vector for the new solution.
+        std::rotate(_solutions.rbegin(), _solutions.rbegin() + 1,
+                    _solutions.rend());
+        std::rotate(_times.rbegin(), _times.rbegin() + 1, _times.rend());
+    }
+    _times.front() = t;
+    MathLib::LinAlg::copy(x, *_solutions.front());
+
+    if (needsXdot())
+    {
+        if (!xdot)
+            OGS_FATAL("The explicit Euler predictor needs the time derivative.");
+        if (!_xdot)
+            _xdot = &NumLib::GlobalVectorProvider::provider.getVector(*xdot);
+        MathLib::LinAlg::copy(*xdot, *_xdot);
+    }
+}
+
+void SolutionPredictor::predict(double const t, GlobalVector& x) const
+{
+    if (_solutions.empty())
+        return;
+
+    auto const& x0 = *_solutions[0];
+    double const t0 = _times[0];
+
+    if (_type == Type::ExplicitEuler)
+    {
+        // x = x0 + (t - t0) * xdot0
+        MathLib::LinAlg::copy(x0, x);
+        MathLib::LinAlg::axpy(x, t - t0, *_xdot);
+        return;
+    }
+
+    if (_solutions.size() < 2)
+        return;
+
+    auto const& x1 = *_solutions[1];
+    double const t1 = _times[1];
+
+    if (_type == Type::Quadratic && _solutions.size() == 3)
+    {
+        // Lagrange interpolation through (t0, x0), (t1, x1), (t2, x2).
+        auto const& x2 = *_solutions[2];
+        double const t2 = _times[2];
+        double const l0 = (t - t1) * (t - t2) / ((t0 - t1) * (t0 - t2));
+        double const l1 = (t - t0) * (t - t2) / ((t1 - t0) * (t1 - t2));
+        double const l2 = (t - t0) * (t - t1) / ((t2 - t0) * (t2 - t1));
+
+        MathLib::LinAlg::copy(x0, x);
+        MathLib::LinAlg::scale(x, l0);
+        MathLib::LinAlg::axpy(x, l1, x1);
+        MathLib::LinAlg::axpy(x, l2, x2);
+        return;
+    }
+
+    // x = x0 + (t - t0) / (t0 - t1) * (x0 - x1)
+    double const a = (t - t0) / (t0 - t1);
+    MathLib::LinAlg::copy(x0, x);
+    MathLib::LinAlg::scale(x, 1.0 + a);
+    MathLib::LinAlg::axpy(x, -a, x1);
+}
+
+SolutionPredictor::~SolutionPredictor()
+{
+    for (auto* x : _solutions)
+        NumLib::GlobalVectorProvider::provider.releaseVector(*x);
+    if (_xdot)
+        NumLib::GlobalVectorProvider::provider.releaseVector(*_xdot);
+}
+
+SolutionPredictor::Type convertStringToPredictorType(std::string const& type)
+{
+    if (type == "Linear")
+        return SolutionPredictor::Type::Linear;
+    if (type == "Quadratic")
+        return SolutionPredictor::Type::Quadratic;
+    if (type == "ExplicitEuler")
+        return SolutionPredictor::Type::ExplicitEuler;
+
+    OGS_FATAL("Unknown predictor type `%s'.", type.c_str());
+}
+
+}  // namespace NumLib
@@ -0,0 +1,84 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "NumLib/NumericsConfig.h"
+
+namespace NumLib
+{
+//! \addtogroup ODESolver
+//! @{
+
+/*! Predicts the solution at a new timestep from the solutions of the last
+ * timesteps.
+ *
+ * The prediction is used as the initial guess of the nonlinear solver, and
+ * thereby also of the first linear solve of each timestep.
+ */
+class SolutionPredictor final
+{
+public:
+    enum class Type
+    {
+        //! Linear extrapolation from the last two solutions.
+        Linear,
+        //! Quadratic extrapolation from the last three solutions.
+        Quadratic,
+        //! Explicit Euler step with the time derivative of the last solution.
+        ExplicitEuler
+    };
+
+    explicit SolutionPredictor(Type const type) : _type(type) {}
+
+    //! Tells if the time derivative has to be passed to pushSolution().
+    bool needsXdot() const { return _type == Type::ExplicitEuler; }
+
+    /*! Stores the solution \c x at time \c t.
+     *
+     * If \c t equals the time of the last stored solution, that solution is
+     * replaced, e.g., in subsequent iterations of a coupling loop.
+     *
+     * \param xdot the time derivative of \c x, used by the explicit Euler
+     *             predictor only.
+     */
+    void pushSolution(double const t, GlobalVector const& x,
+                      GlobalVector const* const xdot = nullptr);
+
+    /*! Overwrites \c x with the predicted solution at time \c t.
+     *
+     * \c x is left unchanged as long as not enough solutions are stored.
+     * Quadratic extrapolation falls back to linear extrapolation if only two
+     * solutions are available.
+     */
+    void predict(double const t, GlobalVector& x) const;
+
+    ~SolutionPredictor();
+
+private:
+    //! Number of stored solutions needed by the predictor.
+    std::size_t getHistoryLength() const;
+
+    Type const _type;
+
+    //! Times and solutions, the newest one first.
+    std::vector<double> _times;
+    std::vector<GlobalVector*> _solutions;
+    GlobalVector* _xdot = nullptr;
+};
+
+//! Converts the given string to a predictor type.
+SolutionPredictor::Type convertStringToPredictorType(std::string const& type);
+
+//! @}
+}  // namespace NumLib
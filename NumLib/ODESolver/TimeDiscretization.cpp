@@ -0,0 +1,139 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "TimeDiscretization.h"
+
+#include <algorithm>
+
+#include "BaseLib/Error.h"
+
+namespace NumLib
+{
+VariableStepBDF::VariableStepBDF(const unsigned max_order)
+    : _max_order(max_order)
+{
+    if (max_order < 1 || max_order > 5)
+        OGS_FATAL(
+            "The maximum order of the variable-step BDF must be in the range "
+            "1 through 5, got %u.",
+            max_order);
+}
+
+VariableStepBDF::~VariableStepBDF()
+{
+    for (auto* x : _xs_old)
+        NumLib::GlobalVectorProvider::provider.releaseVector(*x);
+}
+
+void VariableStepBDF::setInitialState(const double t0, GlobalVector const& x0)
+{
+    _t = t0;
+    push(t0, x0);
+}
+
+void VariableStepBDF::pushState(const double t, GlobalVector const& x,
+                                InternalMatrixStorage const&)
+{
+    push(t, x);
+}
+
+void VariableStepBDF::push(const double t, GlobalVector const& x)
+{
+    if (_ts_old.empty() || t != _ts_old.front())
+    {
+        // The error estimate of order k needs k+1 preceding solutions, one
+        // more entry is needed if a timestep is computed anew.
+        if (_xs_old.size() < _max_order + 2)
+        {
+            _xs_old.push_back(
+                &NumLib::GlobalVectorProvider::provider.getVector(x));
+            _ts_old.push_back(t);
+        }
+        // Reuse the oldest entry for the new state.
+        std::rotate(_xs_old.rbegin(), _xs_old.rbegin() + 1, _xs_old.rend());
+        std::rotate(_ts_old.rbegin(), _ts_old.rbegin() + 1, _ts_old.rend());
+    }
+    _ts_old.front() = t;
+    MathLib::LinAlg::copy(x, *_xs_old.front());
+}
+
+void VariableStepBDF::nextTimestep(const double t, const double /*delta_t*/)
+{
+    _t = t;
+    _first = (_ts_old.front() == t) ? 1 : 0;
+    if (_first == _ts_old.size())
+        OGS_FATAL("No preceding timestep is known to the variable-step BDF.");
+
+    // Use order k only if k+1 preceding solutions are known for the error
+    // estimate.
+    auto const n_old = static_cast<unsigned>(_ts_old.size()) - _first;
+    _order = std::min(_max_order, std::max(1u, n_old - 1));
+
+    // Derivatives of the Lagrange polynomials through the points t_0 = t and
+    // t_j = getTOld(j-1), j = 1..k, evaluated at t.
+    _weights.assign(_order + 1, 0.0);
+    auto const node = [&](unsigned const j) {
+        return j == 0 ? t : getTOld(j - 1);
+    };
+    for (unsigned m = 1; m <= _order; ++m)
+        _weights[0] += 1.0 / (t - node(m));
+    for (unsigned j = 1; j <= _order; ++j)
+    {
+        double numerator = 1.0;
+        double denominator = t - node(j);
+        for (unsigned m = 1; m <= _order; ++m)
+        {
+            if (m == j)
+                continue;
+            numerator *= t - node(m);
+            denominator *= node(j) - node(m);
+        }
+        _weights[j] = -numerator / denominator;
+    }
+}
+
+void VariableStepBDF::getWeightedOldX(GlobalVector& y) const
+{
+    namespace LinAlg = MathLib::LinAlg;
+
+    // y = -sum_j w_j x_j, such that xdot = w_0 x_N - y
+    LinAlg::copy(getXOld(0), y);
+    LinAlg::scale(y, -_weights[1]);
+    for (unsigned j = 2; j <= _order; ++j)
+        LinAlg::axpy(y, -_weights[j], getXOld(j - 1));
+}
+
+bool VariableStepBDF::getErrorEstimate(GlobalVector const& x,
+                                       GlobalVector& error) const
+{
+    namespace LinAlg = MathLib::LinAlg;
+
+    unsigned const n_points = _order + 1;
+    if (_ts_old.size() - _first < n_points)
+        return false;
+
+    // error = (x - x_predicted) * delta_t / (t - t_{n-k}), where x_predicted
+    // is the extrapolation from the last k+1 solutions.
+    LinAlg::copy(x, error);
+    for (unsigned j = 0; j < n_points; ++j)
+    {
+        double l_j = 1.0;
+        for (unsigned m = 0; m < n_points; ++m)
+        {
+            if (m != j)
+                l_j *= (_t - getTOld(m)) / (getTOld(j) - getTOld(m));
+        }
+        LinAlg::axpy(error, -l_j, getXOld(j));
+    }
+    LinAlg::scale(error,
+                  (_t - getTOld(0)) / (_t - getTOld(n_points - 1)));
+    return true;
+}
+
+}  // namespace NumLib
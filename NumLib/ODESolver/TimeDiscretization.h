@@ -52,9 +52,9 @@ public:
  * \note The method documentation of this class uses quantities introduced in the
  *       following section.
  *
- * \todo Currently this interface does not yet support adaptive timestepping.
- *       While implementing that will lead to no changes for single-step methods,
- *       for multi-step methods this interface will have to be extended.
+ * \note Changing timestep sizes are only supported by single-step methods and
+ *       by the VariableStepBDF scheme, which also provides an estimate of the
+ *       local truncation error for error-based timestep size control.
  *
  *
  * Discretizing first-order ODEs {#concept_time_discretization}
@@ -108,7 +108,9 @@ public:
  * BDF(2)         | \f$ x_{n+2} \f$ | \f$ t_{n+1} \f$ | \f$ 3/(2\Delta t) \f$ | \f$ x_{n+2} \f$ | \f$ (2\cdot x_{n+1} - x_n/2)/\Delta t \f$
  *
  * The other backward differentiation formulas of orders 1 to 6 are also implemented, but only
- * BDF(2) has bee given here for brevity.
+ * BDF(2) has bee given here for brevity. For the variable-step BDF scheme
+ * \f$ \alpha \f$ and \f$ x_O \f$ depend on the current and preceding timestep
+ * sizes, see VariableStepBDF.
  *
  */
 class TimeDiscretization
@@ -133,8 +135,9 @@ public:
 
     /*! Indicate that the computation of a new timestep is being started now.
      *
-     * \warning Currently changing timestep sizes are not supported. Thus,
-     *          \p delta_t must not change throughout the entire time
+     * \warning Changing timestep sizes are only supported by single-step
+     *          methods and by VariableStepBDF. For the other multi-step
+     *          methods \p delta_t must not change throughout the entire time
      *          integration process! This is not checked by this code!
      */
     virtual void nextTimestep(const double t, const double delta_t) = 0;
@@ -199,6 +202,25 @@ public:
      * The CrankNicolson scheme needs such preload.
      */
     virtual bool needsPreload() const { return false; }
+
+    /*! Computes an estimate of the local truncation error of the solution
+     * \c x at the new timestep.
+     *
+     * \return false if this scheme provides no error estimate, at least not
+     *         at the current timestep.
+     */
+    virtual bool getErrorEstimate(GlobalVector const& /*x*/,
+                                  GlobalVector& /*error*/) const
+    {
+        return false;
+    }
+
+    //! Returns true if this scheme provides error estimates at all, cf.
+    //! getErrorEstimate().
+    virtual bool providesErrorEstimate() const { return false; }
+
+    //! Returns the order of the scheme used in the current timestep.
+    virtual unsigned getOrder() const { return 1; }
     //! @}
 };
 
@@ -498,5 +520,75 @@ private:
     unsigned _offset = 0;  //!< allows treating \c _xs_old as circular buffer
 };
 
+/*! Backward differentiation formula with variable coefficients, which allow
+ * changing timestep sizes.
+ *
+ * The time derivative at the new timestep is approximated by the derivative of
+ * the polynomial interpolating the solutions at the new timestep and at the
+ * last \f$ k \f$ timesteps. The order \f$ k \f$ is increased up to
+ * \c max_order as more solutions become available.
+ *
+ * The local truncation error is estimated from the difference of the solution
+ * to the prediction \f$ x^P \f$ extrapolated from the last \f$ k+1 \f$
+ * solutions:
+ * \f[ e = \frac{\Delta t}{t_{n+1} - t_{n-k}} (x_{n+1} - x^P). \f]
+ */
+class VariableStepBDF final : public TimeDiscretization
+{
+public:
+    //! \param max_order the maximum order of the BDF, from 1 through 5.
+    explicit VariableStepBDF(const unsigned max_order);
+
+    ~VariableStepBDF();
+
+    void setInitialState(const double t0, GlobalVector const& x0) override;
+
+    //! If \p t equals the time of the last pushed state, that state is
+    //! replaced, e.g., in subsequent iterations of a coupling loop.
+    void pushState(const double t, GlobalVector const& x,
+                   InternalMatrixStorage const&) override;
+
+    //! If \p t equals the time of the last pushed state, that state is
+    //! ignored, i.e., the timestep is computed anew.
+    void nextTimestep(const double t, const double delta_t) override;
+
+    double getCurrentTime() const override { return _t; }
+    double getNewXWeight() const override { return _weights[0]; }
+    void getWeightedOldX(GlobalVector& y) const override;
+
+    bool getErrorEstimate(GlobalVector const& x,
+                          GlobalVector& error) const override;
+    bool providesErrorEstimate() const override { return true; }
+
+    unsigned getOrder() const override { return _order; }
+
+private:
+    void push(const double t, GlobalVector const& x);
+
+    //! Solution of the \p i-th preceding timestep, starting from zero.
+    GlobalVector const& getXOld(const unsigned i) const
+    {
+        return *_xs_old[_first + i];
+    }
+
+    //! Time of the \p i-th preceding timestep, starting from zero.
+    double getTOld(const unsigned i) const { return _ts_old[_first + i]; }
+
+    const unsigned _max_order;
+    double _t;            //!< \f$ t_C \f$
+    unsigned _order = 1;  //!< the order used in the current timestep
+    //! Index of the preceding timestep in the history buffers, 1 if the
+    //! current timestep is being computed anew, 0 otherwise.
+    unsigned _first = 0;
+
+    //! Solutions and times of the preceding timesteps, the newest first.
+    std::vector<GlobalVector*> _xs_old;
+    std::vector<double> _ts_old;
+
+    //! Derivatives of the Lagrange polynomials at the new time, the first one
+    //! belonging to the new solution, the others to the preceding timesteps.
+    std::vector<double> _weights;
+};
+
 //! @}
 }
@@ -47,6 +47,13 @@ std::unique_ptr<TimeDiscretization> createTimeDiscretization(
         using ConcreteTD = BackwardDifferentiationFormula;
         return T(new ConcreteTD(order));
     }
+    else if (type == "VariableStepBDF")
+    {
+        //! \ogs_file_param{prj__time_loop__processes__process__time_discretization__VariableStepBDF__max_order}
+        auto const max_order = config.getConfigParameter<unsigned>("max_order", 5);
+        using ConcreteTD = VariableStepBDF;
+        return T(new ConcreteTD(max_order));
+    }
     else
     {
         OGS_FATAL("Unrecognized time discretization type `%s'", type.c_str());
@@ -10,6 +10,7 @@
 #include "TimeDiscretizedODESystem.h"
 
 #include "MathLib/LinAlg/ApplyKnownSolution.h"
+#include "MathLib/LinAlg/LinAlg.h"
 #include "MathLib/LinAlg/UnifiedMatrixSetters.h"
 #include "NumLib/IndexValueVector.h"
 
@@ -43,10 +44,21 @@ TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
     TimeDiscretizedODESystem(ODE& ode, TimeDisc& time_discretization)
     : _ode(ode),
       _time_disc(time_discretization),
-      _mat_trans(createMatrixTranslator<ODETag>(time_discretization))
+      _mat_trans(createMatrixTranslator<ODETag>(time_discretization)),
+      _use_time_discretized_assembly(
+          isGeneralTimeDiscretization(time_discretization) &&
+          ode.hasTimeDiscretizedAssembly())
 {
     _Jac = &NumLib::GlobalMatrixProvider::provider.getMatrix(
         _ode.getMatrixSpecifications(), _Jac_id);
+
+    if (_use_time_discretized_assembly)
+    {
+        _res = &NumLib::GlobalVectorProvider::provider.getVector(
+            _ode.getMatrixSpecifications(), _res_id);
+        return;
+    }
+
     _M = &NumLib::GlobalMatrixProvider::provider.getMatrix(
         _ode.getMatrixSpecifications(), _M_id);
     _K = &NumLib::GlobalMatrixProvider::provider.getMatrix(
@@ -60,6 +72,11 @@ TimeDiscretizedODESystem<
     NonlinearSolverTag::Newton>::~TimeDiscretizedODESystem()
 {
     NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_Jac);
+    if (_use_time_discretized_assembly)
+    {
+        NumLib::GlobalVectorProvider::provider.releaseVector(*_res);
+        return;
+    }
     NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_M);
     NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_K);
     NumLib::GlobalVectorProvider::provider.releaseVector(*_b);
@@ -80,6 +97,21 @@ void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
     auto& xdot = NumLib::GlobalVectorProvider::provider.getVector(_xdot_id);
     _time_disc.getXdot(x_new_timestep, xdot);
 
+    if (_use_time_discretized_assembly)
+    {
+        _res->setZero();
+        _Jac->setZero();
+
+        _ode.assembleResidualWithJacobian(t, x_curr, xdot, dxdot_dx, dx_dx,
+                                          *_res, *_Jac, coupling_term);
+
+        LinAlg::finalizeAssembly(*_res);
+        LinAlg::finalizeAssembly(*_Jac);
+
+        NumLib::GlobalVectorProvider::provider.releaseVector(xdot);
+        return;
+    }
+
     _M->setZero();
     _K->setZero();
     _b->setZero();
@@ -101,6 +133,13 @@ void TimeDiscretizedODESystem<
     NonlinearSolverTag::Newton>::getResidual(GlobalVector const& x_new_timestep,
                                              GlobalVector& res) const
 {
+    if (_use_time_discretized_assembly)
+    {
+        // The residual has already been assembled at x_new_timestep.
+        MathLib::LinAlg::copy(*_res, res);
+        return;
+    }
+
     // TODO Maybe the duplicate calculation of xdot here and in assembleJacobian
     //      can be optimuized. However, that would make the interface a bit more
     //      fragile.
@@ -155,8 +194,20 @@ TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
     TimeDiscretizedODESystem(ODE& ode, TimeDisc& time_discretization)
     : _ode(ode),
       _time_disc(time_discretization),
-      _mat_trans(createMatrixTranslator<ODETag>(time_discretization))
+      _mat_trans(createMatrixTranslator<ODETag>(time_discretization)),
+      _use_time_discretized_assembly(
+          isGeneralTimeDiscretization(time_discretization) &&
+          ode.hasTimeDiscretizedAssembly())
 {
+    if (_use_time_discretized_assembly)
+    {
+        _A = &NumLib::GlobalMatrixProvider::provider.getMatrix(
+            ode.getMatrixSpecifications(), _A_id);
+        _rhs = &NumLib::GlobalVectorProvider::provider.getVector(
+            ode.getMatrixSpecifications(), _rhs_id);
+        return;
+    }
+
     _M = &NumLib::GlobalMatrixProvider::provider.getMatrix(
         ode.getMatrixSpecifications(), _M_id);
     _K = &NumLib::GlobalMatrixProvider::provider.getMatrix(
@@ -169,6 +220,12 @@ TimeDiscretizedODESystem<
     ODESystemTag::FirstOrderImplicitQuasilinear,
     NonlinearSolverTag::Picard>::~TimeDiscretizedODESystem()
 {
+    if (_use_time_discretized_assembly)
+    {
+        NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_A);
+        NumLib::GlobalVectorProvider::provider.releaseVector(*_rhs);
+        return;
+    }
     NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_M);
     NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_K);
     NumLib::GlobalVectorProvider::provider.releaseVector(*_b);
@@ -184,6 +241,26 @@ void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
     auto const t = _time_disc.getCurrentTime();
     auto const& x_curr = _time_disc.getCurrentX(x_new_timestep);
 
+    if (_use_time_discretized_assembly)
+    {
+        auto const dxdot_dx = _time_disc.getNewXWeight();
+        auto& weighted_old_x = NumLib::GlobalVectorProvider::provider.getVector(
+            _weighted_old_x_id);
+        _time_disc.getWeightedOldX(weighted_old_x);
+
+        _A->setZero();
+        _rhs->setZero();
+
+        _ode.assembleTimeDiscretized(t, x_curr, dxdot_dx, weighted_old_x, *_A,
+                                     *_rhs, coupling_term);
+
+        LinAlg::finalizeAssembly(*_A);
+        LinAlg::finalizeAssembly(*_rhs);
+
+        NumLib::GlobalVectorProvider::provider.releaseVector(weighted_old_x);
+        return;
+    }
+
     _M->setZero();
     _K->setZero();
     _b->setZero();
@@ -195,6 +272,26 @@ void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
     LinAlg::finalizeAssembly(*_b);
 }
 
+void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
+                              NonlinearSolverTag::Picard>::
+    getA(GlobalMatrix& A) const
+{
+    if (_use_time_discretized_assembly)
+        MathLib::LinAlg::copy(*_A, A);
+    else
+        _mat_trans->computeA(*_M, *_K, A);
+}
+
+void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
+                              NonlinearSolverTag::Picard>::
+    getRhs(GlobalVector& rhs) const
+{
+    if (_use_time_discretized_assembly)
+        MathLib::LinAlg::copy(*_rhs, rhs);
+    else
+        _mat_trans->computeRhs(*_M, *_K, *_b, rhs);
+}
+
 void TimeDiscretizedODESystem<
     ODESystemTag::FirstOrderImplicitQuasilinear,
     NonlinearSolverTag::Picard>::applyKnownSolutions(GlobalVector& x) const
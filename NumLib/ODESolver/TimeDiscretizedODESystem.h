@@ -117,7 +117,10 @@ public:
 
     void pushMatrices() const override
     {
-        _mat_trans->pushMatrices(*_M, *_K, *_b);
+        // Only needed by time discretization schemes which are not assembled
+        // element-wise, cf. isGeneralTimeDiscretization().
+        if (!_use_time_discretized_assembly)
+            _mat_trans->pushMatrices(*_M, *_K, *_b);
     }
 
     TimeDisc& getTimeDiscretization() override { return _time_disc; }
@@ -133,15 +136,22 @@ private:
     //! the object used to compute the matrix/vector for the nonlinear solver
     std::unique_ptr<MatTrans> _mat_trans;
 
-    GlobalMatrix* _Jac;  //!< the Jacobian of the residual
-    GlobalMatrix* _M;    //!< Matrix \f$ M \f$.
-    GlobalMatrix* _K;    //!< Matrix \f$ K \f$.
-    GlobalVector* _b;    //!< Matrix \f$ b \f$.
+    //! If set, the time discretization is applied element-wise by the ODE,
+    //! and only \c _Jac and \c _res are assembled globally. Otherwise \c _M,
+    //! \c _K, \c _b and \c _Jac are assembled.
+    bool const _use_time_discretized_assembly;
+
+    GlobalMatrix* _Jac = nullptr;  //!< the Jacobian of the residual
+    GlobalMatrix* _M = nullptr;    //!< Matrix \f$ M \f$.
+    GlobalMatrix* _K = nullptr;    //!< Matrix \f$ K \f$.
+    GlobalVector* _b = nullptr;    //!< Matrix \f$ b \f$.
+    GlobalVector* _res = nullptr;  //!< The residual.
 
     std::size_t _Jac_id = 0u;  //!< ID of the \c _Jac matrix.
     std::size_t _M_id = 0u;    //!< ID of the \c _M matrix.
     std::size_t _K_id = 0u;    //!< ID of the \c _K matrix.
     std::size_t _b_id = 0u;    //!< ID of the \c _b vector.
+    std::size_t _res_id = 0u;  //!< ID of the \c _res vector.
 
     //! ID of the vector storing xdot in intermediate computations.
     mutable std::size_t _xdot_id = 0u;
@@ -184,15 +194,9 @@ public:
                   ProcessLib::StaggeredCouplingTerm const& coupling_term)
                   override;
 
-    void getA(GlobalMatrix& A) const override
-    {
-        _mat_trans->computeA(*_M, *_K, A);
-    }
+    void getA(GlobalMatrix& A) const override;
 
-    void getRhs(GlobalVector& rhs) const override
-    {
-        _mat_trans->computeRhs(*_M, *_K, *_b, rhs);
-    }
+    void getRhs(GlobalVector& rhs) const override;
 
     void applyKnownSolutions(GlobalVector& x) const override;
 
@@ -216,7 +220,10 @@ public:
 
     void pushMatrices() const override
     {
-        _mat_trans->pushMatrices(*_M, *_K, *_b);
+        // Only needed by time discretization schemes which are not assembled
+        // element-wise, cf. isGeneralTimeDiscretization().
+        if (!_use_time_discretized_assembly)
+            _mat_trans->pushMatrices(*_M, *_K, *_b);
     }
 
     TimeDisc& getTimeDiscretization() override { return _time_disc; }
@@ -232,13 +239,25 @@ private:
     //! the object used to compute the matrix/vector for the nonlinear solver
     std::unique_ptr<MatTrans> _mat_trans;
 
-    GlobalMatrix* _M;  //!< Matrix \f$ M \f$.
-    GlobalMatrix* _K;  //!< Matrix \f$ K \f$.
-    GlobalVector* _b;  //!< Matrix \f$ b \f$.
+    //! If set, the time discretization is applied element-wise by the ODE,
+    //! and only \c _A and \c _rhs are assembled globally. Otherwise \c _M,
+    //! \c _K and \c _b are assembled.
+    bool const _use_time_discretized_assembly;
+
+    GlobalMatrix* _M = nullptr;    //!< Matrix \f$ M \f$.
+    GlobalMatrix* _K = nullptr;    //!< Matrix \f$ K \f$.
+    GlobalVector* _b = nullptr;    //!< Matrix \f$ b \f$.
+    GlobalMatrix* _A = nullptr;    //!< The time discretized system matrix.
+    GlobalVector* _rhs = nullptr;  //!< The time discretized right-hand side.
+
+    std::size_t _M_id = 0u;    //!< ID of the \c _M matrix.
+    std::size_t _K_id = 0u;    //!< ID of the \c _K matrix.
+    std::size_t _b_id = 0u;    //!< ID of the \c _b vector.
+    std::size_t _A_id = 0u;    //!< ID of the \c _A matrix.
+    std::size_t _rhs_id = 0u;  //!< ID of the \c _rhs vector.
 
-    std::size_t _M_id = 0u;  //!< ID of the \c _M matrix.
-    std::size_t _K_id = 0u;  //!< ID of the \c _K matrix.
-    std::size_t _b_id = 0u;  //!< ID of the \c _b vector.
+    //! ID of the vector storing the weighted old x.
+    std::size_t _weighted_old_x_id = 0u;
 };
 
 //! @}
@@ -0,0 +1,211 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "PIControlledTimeStepping.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/ConfigTree.h"
+#include "BaseLib/Error.h"
+#include "MathLib/LinAlg/LinAlg.h"
+
+namespace
+{
+/// Lower bound of the scaled errors to avoid divisions by zero.
+const double min_error = 1e-10;
+}
+
+namespace NumLib
+{
+PIControlledTimeStepping::PIControlledTimeStepping(
+    double t_initial, double t_end, double initial_dt, double minimum_dt,
+    double maximum_dt, double abstol, double reltol,
+    MathLib::VecNormType norm_type, double safety_factor, double max_increase,
+    double max_decrease)
+    : _t_initial(t_initial),
+      _t_end(t_end),
+      _initial_dt(initial_dt),
+      _minimum_dt(minimum_dt),
+      _maximum_dt(maximum_dt),
+      _abstol(abstol),
+      _reltol(reltol),
+      _norm_type(norm_type),
+      _safety_factor(safety_factor),
+      _max_increase(max_increase),
+      _max_decrease(max_decrease),
+      _ts_prev(t_initial),
+      _ts_current(t_initial)
+{
+    if (minimum_dt <= 0.0 || minimum_dt > maximum_dt)
+        OGS_FATAL(
+            "The minimum time step size %g must be positive and not larger "
+            "than the maximum time step size %g.",
+            minimum_dt, maximum_dt);
+    if (initial_dt < minimum_dt || initial_dt > maximum_dt)
+        OGS_FATAL(
+            "The initial time step size %g is not within [%g, %g].",
+            initial_dt, minimum_dt, maximum_dt);
+    if (abstol < 0.0 || reltol < 0.0 || abstol + reltol <= 0.0)
+        OGS_FATAL("The error tolerances must be non-negative and not both zero.");
+    if (max_decrease <= 0.0 || max_decrease >= 1.0 || max_increase <= 1.0)
+        OGS_FATAL(
+            "The step size ratios must fulfill 0 < max_decrease < 1 < "
+            "max_increase.");
+}
+
+std::unique_ptr<ITimeStepAlgorithm> PIControlledTimeStepping::newInstance(
+    BaseLib::ConfigTree const& config)
+{
+    //! \ogs_file_param{prj__time_loop__time_stepping__type}
+    config.checkConfigParameter("type", "PIControlledTimeStepping");
+
+    //! \ogs_file_param{prj__time_loop__time_stepping__PIControlledTimeStepping__t_initial}
+    auto const t_initial = config.getConfigParameter<double>("t_initial");
+    //! \ogs_file_param{prj__time_loop__time_stepping__PIControlledTimeStepping__t_end}
+    auto const t_end = config.getConfigParameter<double>("t_end");
+    //! \ogs_file_param{prj__time_loop__time_stepping__PIControlledTimeStepping__initial_dt}
+    auto const initial_dt = config.getConfigParameter<double>("initial_dt");
+    //! \ogs_file_param{prj__time_loop__time_stepping__PIControlledTimeStepping__minimum_dt}
+    auto const minimum_dt = config.getConfigParameter<double>("minimum_dt");
+    //! \ogs_file_param{prj__time_loop__time_stepping__PIControlledTimeStepping__maximum_dt}
+    auto const maximum_dt = config.getConfigParameter<double>("maximum_dt");
+    //! \ogs_file_param{prj__time_loop__time_stepping__PIControlledTimeStepping__abstol}
+    auto const abstol = config.getConfigParameter<double>("abstol");
+    //! \ogs_file_param{prj__time_loop__time_stepping__PIControlledTimeStepping__reltol}
+    auto const reltol = config.getConfigParameter<double>("reltol");
+    auto const norm_type = MathLib::convertStringToVecNormType(
+        //! \ogs_file_param{prj__time_loop__time_stepping__PIControlledTimeStepping__norm_type}
+        config.getConfigParameter<std::string>("norm_type", "NORM2"));
+    if (norm_type == MathLib::VecNormType::INVALID)
+        OGS_FATAL("Unknown vector norm type.");
+    auto const safety_factor =
+        //! \ogs_file_param{prj__time_loop__time_stepping__PIControlledTimeStepping__safety_factor}
+        config.getConfigParameter<double>("safety_factor", 0.9);
+    auto const max_increase =
+        //! \ogs_file_param{prj__time_loop__time_stepping__PIControlledTimeStepping__max_increase}
+        config.getConfigParameter<double>("max_increase", 5.0);
+    auto const max_decrease =
+        //! \ogs_file_param{prj__time_loop__time_stepping__PIControlledTimeStepping__max_decrease}
+        config.getConfigParameter<double>("max_decrease", 0.2);
+
+    return std::unique_ptr<ITimeStepAlgorithm>(new PIControlledTimeStepping(
+        t_initial, t_end, initial_dt, minimum_dt, maximum_dt, abstol, reltol,
+        norm_type, safety_factor, max_increase, max_decrease));
+}
+
+bool PIControlledTimeStepping::next()
+{
+    if (_accepted)
+    {
+        // confirm current time and move to the next
+        if (_ts_current.steps() > _ts_prev.steps())
+            _dt_vector.push_back(_ts_current.dt());
+        _ts_prev = _ts_current;
+
+        // check if the end time has been reached
+        if (std::abs(_ts_current.current() - _t_end) <=
+            std::numeric_limits<double>::epsilon() *
+                std::max(1.0, std::abs(_t_end)))
+            return false;
+    }
+    else
+    {
+        ++_n_rejected_steps;
+    }
+
+    // prepare the next time step info
+    auto const dt = getNextTimeStepSize();
+    if (_has_error)
+    {
+        if (_accepted)
+            _error_prev = std::max(_error, min_error);
+        _previous_rejected = !_accepted;
+    }
+    _has_error = false;
+    _accepted = true;
+
+    _ts_current = _ts_prev;
+    _ts_current += dt;
+
+    return true;
+}
+
+double PIControlledTimeStepping::getNextTimeStepSize() const
+{
+    double dt;
+    if (_ts_current.steps() == 0)
+    {
+        dt = _initial_dt;
+    }
+    else if (!_has_error)
+    {
+        dt = _ts_current.dt();
+    }
+    else
+    {
+        double const e = std::max(_error, min_error);
+        double const k1 = _order + 1.0;
+
+        double factor;
+        if (_accepted)
+        {
+            factor = _safety_factor * std::pow(e, -0.7 / k1) *
+                     std::pow(_error_prev, 0.4 / k1);
+            if (_previous_rejected)
+                factor = std::min(factor, 1.0);
+            factor = std::max(_max_decrease, std::min(factor, _max_increase));
+        }
+        else
+        {
+            factor = std::max(_max_decrease,
+                              std::min(1.0, _safety_factor *
+                                                std::pow(e, -1.0 / k1)));
+        }
+        dt = _ts_current.dt() * factor;
+    }
+
+    // check whether out of the boundary
+    dt = std::max(_minimum_dt, std::min(dt, _maximum_dt));
+
+    if (_ts_prev.current() + dt > _t_end)
+        dt = _t_end - _ts_prev.current();
+
+    return dt;
+}
+
+double PIControlledTimeStepping::computeScaledError(
+    GlobalVector const& x, GlobalVector const& error) const
+{
+    return MathLib::LinAlg::norm(error, _norm_type) /
+           (_abstol + _reltol * MathLib::LinAlg::norm(x, _norm_type));
+}
+
+void PIControlledTimeStepping::setError(double scaled_error, unsigned order)
+{
+    _error = scaled_error;
+    _order = order;
+    _has_error = true;
+
+    _accepted = scaled_error <= 1.0;
+    if (!_accepted && _ts_current.dt() <= _minimum_dt)
+    {
+        WARN(
+            "The local error estimate %g exceeds the tolerance, but the time "
+            "step size %g cannot be reduced below the minimum. The time step "
+            "is accepted.",
+            scaled_error, _ts_current.dt());
+        _accepted = true;
+    }
+}
+
+} // NumLib
@@ -0,0 +1,152 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "MathLib/LinAlg/LinAlgEnums.h"
+#include "NumLib/NumericsConfig.h"
+
+#include "ITimeStepAlgorithm.h"
+
+namespace BaseLib { class ConfigTree; }
+
+namespace NumLib
+{
+
+/**
+ * \brief Time stepping controlled by an estimate of the local truncation error
+ *
+ * After each time step the time loop passes the scaled local error estimate
+ * \f[
+ *  e_{n+1} = \frac{\|\mathrm{err}\|}{\mathrm{abstol}
+ *            + \mathrm{reltol}\,\|x\|}
+ * \f]
+ * of a time discretization of order \f$k\f$, e.g., of VariableStepBDF, to
+ * setError(). The step is accepted if \f$e_{n+1} \le 1\f$ and the next step
+ * size is computed by the PI controller
+ * \f[
+ *  \Delta t_{n+2} = \Delta t_{n+1}\, s\, e_{n+1}^{-0.7/(k+1)}
+ *                   e_n^{0.4/(k+1)}
+ * \f]
+ * with the safety factor \f$s\f$. Otherwise the step is repeated with
+ * \f$\Delta t_{n+1} = \Delta t_{n+1}\, \max(r_{\min}, s\,e_{n+1}^{-1/(k+1)})\f$.
+ * The change of the step size is limited by the factors \f$r_{\min}\f$ and
+ * \f$r_{\max}\f$ and the step size is not increased directly after a rejected
+ * step. Steps of the minimum step size are always accepted.
+ *
+ * If no error estimate has been set for a time step, it is accepted and the
+ * step size is kept.
+ *
+ * Reference
+ * - Gustafsson K (1991) Control theoretic techniques for stepsize selection in
+ *   explicit Runge-Kutta methods. ACM Trans. Math. Softw. 17(4), 533-554.
+ */
+class PIControlledTimeStepping final : public ITimeStepAlgorithm
+{
+public:
+    /**
+     * @param t_initial     start time
+     * @param t_end         end time
+     * @param initial_dt    size of the first time step
+     * @param minimum_dt    the minimum allowed time step size
+     * @param maximum_dt    the maximum allowed time step size
+     * @param abstol        absolute tolerance of the local error
+     * @param reltol        relative tolerance of the local error
+     * @param norm_type     norm used to measure the local error
+     * @param safety_factor the safety factor \f$s\f$
+     * @param max_increase  the maximum step size ratio \f$r_{\max}\f$
+     * @param max_decrease  the minimum step size ratio \f$r_{\min}\f$
+     */
+    PIControlledTimeStepping(double t_initial, double t_end, double initial_dt,
+                             double minimum_dt, double maximum_dt,
+                             double abstol, double reltol,
+                             MathLib::VecNormType norm_type,
+                             double safety_factor = 0.9,
+                             double max_increase = 5.0,
+                             double max_decrease = 0.2);
+
+    /// Create timestepper from the given configuration
+    static std::unique_ptr<ITimeStepAlgorithm> newInstance(
+        BaseLib::ConfigTree const& config);
+
+    /// return the beginning of time steps
+    double begin() const override { return _t_initial; }
+
+    /// return the end of time steps
+    double end() const override { return _t_end; }
+
+    /// return current time step
+    const TimeStep getTimeStep() const override { return _ts_current; }
+
+    /// move to the next time step
+    bool next() override;
+
+    /// return if the current time step is accepted
+    bool accepted() const override { return _accepted; }
+
+    /// return a history of time step sizes
+    const std::vector<double>& getTimeStepSizeHistory() const override
+    {
+        return _dt_vector;
+    }
+
+    /// return the error of the local error estimate \c error of the solution
+    /// \c x scaled by the tolerances
+    double computeScaledError(GlobalVector const& x,
+                              GlobalVector const& error) const;
+
+    /// set the scaled local error estimate of the current time step, which
+    /// has been computed by a time discretization of the given order
+    void setError(double scaled_error, unsigned order);
+
+    /// return the number of rejected steps
+    std::size_t getNumberOfRejectedSteps() const { return _n_rejected_steps; }
+
+private:
+    /// calculate the next time step size
+    double getNextTimeStepSize() const;
+
+    const double _t_initial;
+    const double _t_end;
+    const double _initial_dt;
+    const double _minimum_dt;
+    const double _maximum_dt;
+    const double _abstol;
+    const double _reltol;
+    const MathLib::VecNormType _norm_type;
+    const double _safety_factor;
+    const double _max_increase;
+    const double _max_decrease;
+
+    /// scaled error of the current time step
+    double _error = 0.0;
+    /// scaled error of the last accepted time step
+    double _error_prev = 1.0;
+    /// order of the error estimate of the current time step
+    unsigned _order = 1;
+    /// if an error estimate has been set for the current time step
+    bool _has_error = false;
+    bool _accepted = true;
+    /// if the last attempt of a time step has been rejected
+    bool _previous_rejected = false;
+
+    /// previous time step
+    TimeStep _ts_prev;
+    /// current time step
+    TimeStep _ts_current;
+    /// history of time step sizes
+    std::vector<double> _dt_vector;
+    /// the number of rejected steps
+    std::size_t _n_rejected_steps = 0;
+};
+
+} // NumLib
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
 namespace ProcessLib
@@ -42,6 +43,10 @@ public:
         std::vector<double>& /*local_Jac_data*/,
         LocalCouplingTerm const& /*coupling_term*/) {}
 
+    //! Creates a new Jacobian assembler with the same settings, e.g., for
+    //! the concurrent assembly in several threads.
+    virtual std::unique_ptr<AbstractJacobianAssembler> copy() const = 0;
+
     virtual ~AbstractJacobianAssembler() = default;
 };
 
@@ -34,6 +34,12 @@ public:
         const double dx_dx, std::vector<double>& local_M_data,
         std::vector<double>& local_K_data, std::vector<double>& local_b_data,
         std::vector<double>& local_Jac_data) override;
+
+    std::unique_ptr<AbstractJacobianAssembler> copy() const override
+    {
+        return std::unique_ptr<AbstractJacobianAssembler>(
+            new AnalyticalJacobianAssembler);
+    }
 };
 
 }  // ProcessLib
@@ -52,6 +52,19 @@ public:
         // there is nothing to do here.
     }
 
+    //! Applies natural BCs to the residual \c res and its Jacobian \c Jac,
+    //! i.e., adds \f$ K_{BC} \cdot x - b_{BC} \f$ to \c res and \f$ K_{BC} \f$
+    //! to \c Jac. Used in the time discretized assembly, see
+    //! Process::assembleResidualWithJacobian().
+    virtual void applyNaturalBCToResidual(const double /*t*/,
+                                          GlobalVector const& /*x*/,
+                                          GlobalVector& /*res*/,
+                                          GlobalMatrix& /*Jac*/)
+    {
+        // By default it is assumed that the BC is not a natural BC. Therefore
+        // there is nothing to do here.
+    }
+
     //! Writes the values of essential BCs to \c bc_values.
     virtual void getEssentialBCValues(
         const double /*t*/,
@@ -20,6 +20,14 @@ void BoundaryConditionCollection::applyNaturalBC(const double t,
         bc->applyNaturalBC(t, x, K, b);
 }
 
+void BoundaryConditionCollection::applyNaturalBCToResidual(
+    const double t, GlobalVector const& x, GlobalVector& res,
+    GlobalMatrix& Jac)
+{
+    for (auto const& bc : _boundary_conditions)
+        bc->applyNaturalBCToResidual(t, x, res, Jac);
+}
+
 void BoundaryConditionCollection::addBCsForProcessVariables(
     std::vector<std::reference_wrapper<ProcessVariable>> const&
         process_variables,
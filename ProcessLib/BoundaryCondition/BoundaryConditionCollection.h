@@ -26,6 +26,9 @@ public:
     void applyNaturalBC(const double t, GlobalVector const& x, GlobalMatrix& K,
                         GlobalVector& b);
 
+    void applyNaturalBCToResidual(const double t, GlobalVector const& x,
+                                  GlobalVector& res, GlobalMatrix& Jac);
+
     std::vector<NumLib::IndexValueVector<GlobalIndexType>> const*
     getKnownSolutions(double const t) const
     {
@@ -59,7 +59,7 @@ GenericNaturalBoundaryCondition<BoundaryConditionData,
 
     createLocalAssemblers<LocalAssemblerImplementation>(
         global_dim, _elements, *_dof_table_boundary, shapefunction_order, _local_assemblers,
-        is_axially_symmetric, _integration_order, _data);
+        false, is_axially_symmetric, _integration_order, _data);
 }
 
 template <typename BoundaryConditionData,
@@ -88,4 +88,18 @@ void GenericNaturalBoundaryCondition<
         _local_assemblers, *_dof_table_boundary, t, x, K, b);
 }
 
+template <typename BoundaryConditionData,
+          template <typename, typename, unsigned>
+          class LocalAssemblerImplementation>
+void GenericNaturalBoundaryCondition<BoundaryConditionData,
+                                     LocalAssemblerImplementation>::
+    applyNaturalBCToResidual(const double t, const GlobalVector& x,
+                             GlobalVector& res, GlobalMatrix& Jac)
+{
+    GlobalExecutor::executeMemberOnDereferenced(
+        &GenericNaturalBoundaryConditionLocalAssemblerInterface::
+            assembleResidual,
+        _local_assemblers, *_dof_table_boundary, t, x, res, Jac);
+}
+
 }  // ProcessLib
@@ -23,6 +23,13 @@ public:
         std::size_t const id,
         NumLib::LocalToGlobalIndexMap const& dof_table_boundary, double const t,
         const GlobalVector& x, GlobalMatrix& K, GlobalVector& b) = 0;
+
+    /// Adds the contribution \f$ K_e \cdot x_e - b_e \f$ to the residual
+    /// \c res and \f$ K_e \f$ to its Jacobian \c Jac.
+    virtual void assembleResidual(
+        std::size_t const id,
+        NumLib::LocalToGlobalIndexMap const& dof_table_boundary, double const t,
+        const GlobalVector& x, GlobalVector& res, GlobalMatrix& Jac) = 0;
 };
 
 template <typename ShapeFunction, typename IntegrationMethod,
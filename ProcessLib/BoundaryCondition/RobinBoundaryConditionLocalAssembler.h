@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "MathLib/LinAlg/Eigen/EigenMapTools.h"
 #include "NumLib/DOF/DOFTableUtil.h"
 #include "ProcessLib/Parameter/Parameter.h"
 #include "GenericNaturalBoundaryConditionLocalAssembler.h"
@@ -47,6 +48,37 @@ public:
                   NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
                   double const t, const GlobalVector& /*x*/, GlobalMatrix& K,
                   GlobalVector& b) override
+    {
+        computeLocalMatrixAndRhs(id, t);
+
+        auto const indices = NumLib::getIndices(id, dof_table_boundary);
+        K.add(NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices),
+              _local_K);
+        b.add(indices, _local_rhs);
+    }
+
+    void assembleResidual(
+        std::size_t const id,
+        NumLib::LocalToGlobalIndexMap const& dof_table_boundary, double const t,
+        const GlobalVector& x, GlobalVector& res,
+        GlobalMatrix& Jac) override
+    {
+        computeLocalMatrixAndRhs(id, t);
+
+        auto const indices = NumLib::getIndices(id, dof_table_boundary);
+        auto const local_x = x.get(indices);
+
+        // res_e = K_e * x_e - rhs_e
+        _local_rhs = _local_K * MathLib::toVector(local_x) - _local_rhs;
+
+        Jac.add(
+            NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices),
+            _local_K);
+        res.add(indices, _local_rhs);
+    }
+
+private:
+    void computeLocalMatrixAndRhs(std::size_t const id, double const t)
     {
         _local_K.setZero();
         _local_rhs.setZero();
@@ -74,14 +106,8 @@ public:
             _local_rhs.noalias() += sm.N * alpha * u_0 * sm.detJ *
                                     wp.getWeight() * sm.integralMeasure;
         }
-
-        auto const indices = NumLib::getIndices(id, dof_table_boundary);
-        K.add(NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices),
-              _local_K);
-        b.add(indices, _local_rhs);
     }
 
-private:
     RobinBoundaryConditionData const& _data;
 
     typename Base::NodalMatrixType _local_K;
@@ -52,7 +52,7 @@ CalculateSurfaceFlux::CalculateSurfaceFlux(
 
     ProcessLib::createLocalAssemblers<CalculateSurfaceFluxLocalAssembler>(
         boundary_mesh.getDimension() + 1,  // or bulk_mesh.getDimension()?
-        boundary_mesh.getElements(), *dof_table, 1, _local_assemblers,
+        boundary_mesh.getElements(), *dof_table, 1, _local_assemblers, false,
         boundary_mesh.isAxiallySymmetric(), integration_order,
         *bulk_element_ids, *bulk_face_ids);
 }
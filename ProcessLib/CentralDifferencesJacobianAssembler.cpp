@@ -127,6 +127,14 @@ void CentralDifferencesJacobianAssembler::assembleWithJacobian(
     }
 }
 
+std::unique_ptr<AbstractJacobianAssembler>
+CentralDifferencesJacobianAssembler::copy() const
+{
+    return std::unique_ptr<AbstractJacobianAssembler>(
+        new CentralDifferencesJacobianAssembler(
+            std::vector<double>(_absolute_epsilons)));
+}
+
 std::unique_ptr<CentralDifferencesJacobianAssembler>
 createCentralDifferencesJacobianAssembler(BaseLib::ConfigTree const& config)
 {
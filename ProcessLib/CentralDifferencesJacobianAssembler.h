@@ -56,6 +56,8 @@ public:
         std::vector<double>& local_K_data, std::vector<double>& local_b_data,
         std::vector<double>& local_Jac_data) override;
 
+    std::unique_ptr<AbstractJacobianAssembler> copy() const override;
+
 private:
     std::vector<double> const _absolute_epsilons;
 
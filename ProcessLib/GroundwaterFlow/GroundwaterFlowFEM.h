@@ -18,6 +18,7 @@
 #include "NumLib/Fem/ShapeMatrixPolicy.h"
 #include "ProcessLib/LocalAssemblerInterface.h"
 #include "ProcessLib/LocalAssemblerTraits.h"
+#include "ProcessLib/Parameter/IntegrationPointParameterCache.h"
 #include "ProcessLib/Parameter/Parameter.h"
 #include "ProcessLib/Utils/InitShapeMatrices.h"
 
@@ -67,6 +68,9 @@ public:
         : _element(element),
           _process_data(process_data),
           _integration_method(integration_order),
+          _hydraulic_conductivity(process_data.hydraulic_conductivity,
+                                  element.getID(),
+                                  _integration_method.getNumberOfPoints()),
           _shape_matrices(initShapeMatrices<ShapeFunction, ShapeMatricesType,
                                             IntegrationMethod, GlobalDim>(
               element, is_axially_symmetric, _integration_method)),
@@ -92,15 +96,11 @@ public:
         unsigned const n_integration_points =
             _integration_method.getNumberOfPoints();
 
-        SpatialPosition pos;
-        pos.setElementID(_element.getID());
-
         for (unsigned ip = 0; ip < n_integration_points; ip++)
         {
-            pos.setIntegrationPoint(ip);
             auto const& sm = _shape_matrices[ip];
             auto const& wp = _integration_method.getWeightedPoint(ip);
-            auto const k = _process_data.hydraulic_conductivity(t, pos)[0];
+            auto const k = _hydraulic_conductivity.getValue(t, ip);
 
             local_K.noalias() += sm.dNdx.transpose() * k * sm.dNdx * sm.detJ *
                                  sm.integralMeasure * wp.getWeight();
@@ -122,14 +122,10 @@ public:
         const auto local_x_vec =
         MathLib::toVector<NodalVectorType>(local_x, local_matrix_size);
 
-        SpatialPosition pos;
-        pos.setElementID(_element.getID());
-
         for (unsigned ip = 0; ip < n_integration_points; ip++)
         {
-            pos.setIntegrationPoint(ip);
             auto const& sm = _shape_matrices[ip];
-            auto const k = _process_data.hydraulic_conductivity(t, pos)[0];
+            auto const k = _hydraulic_conductivity.getValue(t, ip);
             // Darcy velocity only computed for output.
             GlobalDimVectorType const darcy_velocity = -k * sm.dNdx * local_x_vec;
 
@@ -213,6 +209,7 @@ private:
     GroundwaterFlowProcessData const& _process_data;
 
     IntegrationMethod const _integration_method;
+    IntegrationPointParameterCache<double> _hydraulic_conductivity;
     std::vector<ShapeMatrices, Eigen::aligned_allocator<ShapeMatrices>>
         _shape_matrices;
 
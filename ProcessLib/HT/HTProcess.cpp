@@ -41,7 +41,7 @@ void HTProcess::initializeConcreteProcess(
     ProcessLib::ProcessVariable const& pv = getProcessVariables()[0];
     ProcessLib::createLocalAssemblers<LocalAssemblerData>(
         mesh.getDimension(), mesh.getElements(), dof_table,
-        pv.getShapeFunctionOrder(), _local_assemblers,
+        pv.getShapeFunctionOrder(), _local_assemblers, isConcurrentAssembly(),
         mesh.isAxiallySymmetric(), integration_order, _process_data);
 
     _secondary_variables.addSecondaryVariable(
@@ -78,9 +78,8 @@ void HTProcess::assembleConcreteProcess(const double t,
     DBUG("Assemble HTProcess.");
 
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
-        *_local_to_global_index_map, t, x, M, K, b, coupling_term);
+    assembleElements(&VectorMatrixAssembler::assemble, _local_assemblers,
+                     *_local_to_global_index_map, t, x, M, K, b, coupling_term);
 }
 
 void HTProcess::assembleWithJacobianConcreteProcess(
@@ -92,10 +91,9 @@ void HTProcess::assembleWithJacobianConcreteProcess(
     DBUG("AssembleWithJacobian HTProcess.");
 
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
-        _local_assemblers, *_local_to_global_index_map, t, x, xdot, dxdot_dx,
-        dx_dx, M, K, b, Jac, coupling_term);
+    assembleElements(&VectorMatrixAssembler::assembleWithJacobian,
+                     _local_assemblers, *_local_to_global_index_map, t, x, xdot,
+                     dxdot_dx, dx_dx, M, K, b, Jac, coupling_term);
 }
 
 }  // namespace HT
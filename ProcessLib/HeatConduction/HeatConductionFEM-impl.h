@@ -112,22 +112,23 @@ void LocalAssemblerData<ShapeFunction, IntegrationMethod, GlobalDim>::
                             std::vector<double>& /*local_b_data*/,
                             LocalCouplingTerm const& coupled_term)
 {
-    for (auto const& coupled_process_pair : coupled_term.coupled_processes)
+    for (std::size_t slot = 0; slot < coupled_term.coupled_processes.size();
+         ++slot)
     {
-        if (coupled_process_pair.first ==
+        auto const& coupled_process = coupled_term.coupled_processes[slot];
+        if (coupled_process.process_type ==
             std::type_index(typeid(ProcessLib::LiquidFlow::LiquidFlowProcess)))
         {
             assert(
                 dynamic_cast<const ProcessLib::LiquidFlow::LiquidFlowProcess*>(
-                    &(coupled_process_pair.second)) != nullptr);
+                    &(coupled_process.process)) != nullptr);
 
             ProcessLib::LiquidFlow::LiquidFlowProcess const& pcs =
                 static_cast<ProcessLib::LiquidFlow::LiquidFlowProcess const&>(
-                    coupled_process_pair.second);
+                    coupled_process.process);
             const auto liquid_flow_prop = pcs.getLiquidFlowMaterialProperties();
 
-            const auto local_p =
-                coupled_term.local_coupled_xs.at(coupled_process_pair.first);
+            auto const& local_p = coupled_term.local_coupled_xs[slot];
 
             SpatialPosition pos;
             pos.setElementID(_element.getID());
@@ -18,6 +18,7 @@
 #include "NumLib/Fem/ShapeMatrixPolicy.h"
 #include "ProcessLib/LocalAssemblerInterface.h"
 #include "ProcessLib/LocalAssemblerTraits.h"
+#include "ProcessLib/Parameter/IntegrationPointParameterCache.h"
 #include "ProcessLib/Parameter/Parameter.h"
 #include "ProcessLib/Utils/InitShapeMatrices.h"
 
@@ -71,6 +72,13 @@ public:
         : _element(element),
           _process_data(process_data),
           _integration_method(integration_order),
+          _thermal_conductivity(process_data.thermal_conductivity,
+                                element.getID(),
+                                _integration_method.getNumberOfPoints()),
+          _heat_capacity(process_data.heat_capacity, element.getID(),
+                         _integration_method.getNumberOfPoints()),
+          _density(process_data.density, element.getID(),
+                   _integration_method.getNumberOfPoints()),
           _shape_matrices(initShapeMatrices<ShapeFunction, ShapeMatricesType,
                                             IntegrationMethod, GlobalDim>(
               element, is_axially_symmetric, _integration_method)),
@@ -102,17 +110,13 @@ public:
         unsigned const n_integration_points =
             _integration_method.getNumberOfPoints();
 
-        SpatialPosition pos;
-        pos.setElementID(_element.getID());
-
         for (unsigned ip = 0; ip < n_integration_points; ip++)
         {
-            pos.setIntegrationPoint(ip);
             auto const& sm = _shape_matrices[ip];
             auto const& wp = _integration_method.getWeightedPoint(ip);
-            auto const k = _process_data.thermal_conductivity(t, pos)[0];
-            auto const heat_capacity = _process_data.heat_capacity(t, pos)[0];
-            auto const density = _process_data.density(t, pos)[0];
+            auto const k = _thermal_conductivity.getValue(t, ip);
+            auto const heat_capacity = _heat_capacity.getValue(t, ip);
+            auto const density = _density.getValue(t, ip);
 
             local_K.noalias() += sm.dNdx.transpose() * k * sm.dNdx * sm.detJ *
                                  wp.getWeight() * sm.integralMeasure;
@@ -139,16 +143,13 @@ public:
         unsigned const n_integration_points =
             _integration_method.getNumberOfPoints();
 
-        SpatialPosition pos;
-        pos.setElementID(_element.getID());
         const auto local_x_vec =
             MathLib::toVector<NodalVectorType>(local_x, local_matrix_size);
 
         for (unsigned ip = 0; ip < n_integration_points; ip++)
         {
-            pos.setIntegrationPoint(ip);
             auto const& sm = _shape_matrices[ip];
-            auto const k = _process_data.thermal_conductivity(t, pos)[0];
+            auto const k = _thermal_conductivity.getValue(t, ip);
             // heat flux only computed for output.
             GlobalDimVectorType const heat_flux = -k * sm.dNdx * local_x_vec;
 
@@ -194,6 +195,9 @@ private:
     HeatConductionProcessData const& _process_data;
 
     IntegrationMethod const _integration_method;
+    IntegrationPointParameterCache<double> _thermal_conductivity;
+    IntegrationPointParameterCache<double> _heat_capacity;
+    IntegrationPointParameterCache<double> _density;
     std::vector<ShapeMatrices, Eigen::aligned_allocator<ShapeMatrices>>
         _shape_matrices;
 
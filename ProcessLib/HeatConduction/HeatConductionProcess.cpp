@@ -57,7 +57,7 @@ void HeatConductionProcess::initializeConcreteProcess(
     ProcessLib::ProcessVariable const& pv = getProcessVariables()[0];
     ProcessLib::createLocalAssemblers<LocalAssemblerData>(
         mesh.getDimension(), mesh.getElements(), dof_table,
-        pv.getShapeFunctionOrder(), _local_assemblers,
+        pv.getShapeFunctionOrder(), _local_assemblers, isConcurrentAssembly(),
         mesh.isAxiallySymmetric(), integration_order, _process_data);
 
     _secondary_variables.addSecondaryVariable(
@@ -95,9 +95,8 @@ void HeatConductionProcess::assembleConcreteProcess(const double t,
     DBUG("Assemble HeatConductionProcess.");
 
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
-        *_local_to_global_index_map, t, x, M, K, b, coupling_term);
+    assembleElements(&VectorMatrixAssembler::assemble, _local_assemblers,
+                     *_local_to_global_index_map, t, x, M, K, b, coupling_term);
 }
 
 void HeatConductionProcess::assembleWithJacobianConcreteProcess(
@@ -109,10 +108,9 @@ void HeatConductionProcess::assembleWithJacobianConcreteProcess(
     DBUG("AssembleWithJacobian HeatConductionProcess.");
 
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
-        _local_assemblers, *_local_to_global_index_map, t, x, xdot, dxdot_dx,
-        dx_dx, M, K, b, Jac, coupling_term);
+    assembleElements(&VectorMatrixAssembler::assembleWithJacobian,
+                     _local_assemblers, *_local_to_global_index_map, t, x, xdot,
+                     dxdot_dx, dx_dx, M, K, b, Jac, coupling_term);
 }
 
 void HeatConductionProcess::computeSecondaryVariableConcrete(
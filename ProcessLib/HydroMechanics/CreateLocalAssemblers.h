@@ -13,6 +13,7 @@
 #include <logog/include/logog.hpp>
 
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "ProcessLib/Utils/ConstructLocalAssemblers.h"
 
 #include "LocalDataInitializer.h"
 
@@ -31,6 +32,7 @@ void createLocalAssemblers(
     const unsigned shapefunction_order,
     std::vector<MeshLib::Element*> const& mesh_elements,
     std::vector<std::unique_ptr<LocalAssemblerInterface>>& local_assemblers,
+    bool const concurrent,
     ExtraCtorArgs&&... extra_ctor_args)
 {
     // Shape matrices initializer
@@ -40,14 +42,11 @@ void createLocalAssemblers(
                              DisplacementDim, ExtraCtorArgs...>;
 
     DBUG("Create local assemblers.");
-    // Populate the vector of local assemblers.
-    local_assemblers.resize(mesh_elements.size());
-
     LocalDataInitializer initializer(dof_table, shapefunction_order);
 
     DBUG("Calling local assembler builder for all mesh elements.");
-    GlobalExecutor::transformDereferenced(
-        initializer, mesh_elements, local_assemblers,
+    ProcessLib::detail::constructLocalAssemblers(
+        initializer, mesh_elements, local_assemblers, concurrent,
         std::forward<ExtraCtorArgs>(extra_ctor_args)...);
 }
 
@@ -61,6 +60,9 @@ void createLocalAssemblers(
  *         Those arguments will be passed to the constructor of
  *         \c LocalAssemblerImplementation.
  *
+ * If \c concurrent is set, the local assemblers are constructed by OpenMP
+ * threads, see detail::constructLocalAssemblers().
+ *
  * The first two template parameters cannot be deduced from the arguments.
  * Therefore they always have to be provided manually.
  */
@@ -73,6 +75,7 @@ void createLocalAssemblers(
     NumLib::LocalToGlobalIndexMap const& dof_table,
     const unsigned shapefunction_order,
     std::vector<std::unique_ptr<LocalAssemblerInterface>>& local_assemblers,
+    bool const concurrent,
     ExtraCtorArgs&&... extra_ctor_args)
 {
     DBUG("Create local assemblers.");
@@ -83,13 +86,13 @@ void createLocalAssemblers(
             detail::createLocalAssemblers<2, DisplacementDim,
                                           LocalAssemblerImplementation>(
                 dof_table, shapefunction_order, mesh_elements, local_assemblers,
-                std::forward<ExtraCtorArgs>(extra_ctor_args)...);
+                concurrent, std::forward<ExtraCtorArgs>(extra_ctor_args)...);
             break;
         case 3:
             detail::createLocalAssemblers<3, DisplacementDim,
                                           LocalAssemblerImplementation>(
                 dof_table, shapefunction_order, mesh_elements, local_assemblers,
-                std::forward<ExtraCtorArgs>(extra_ctor_args)...);
+                concurrent, std::forward<ExtraCtorArgs>(extra_ctor_args)...);
             break;
         default:
             OGS_FATAL(
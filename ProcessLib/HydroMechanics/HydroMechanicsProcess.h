@@ -55,6 +55,7 @@ public:
     //! @{
 
     bool isLinear() const override { return false; }
+    bool hasIntegrationPointHistory() const override { return true; }
     //! @}
 
 private:
@@ -100,8 +101,8 @@ private:
             mesh.getDimension(), mesh.getElements(), dof_table,
             // use displacment process variable for shapefunction order
             getProcessVariables()[1].get().getShapeFunctionOrder(),
-            _local_assemblers, mesh.isAxiallySymmetric(), integration_order,
-            _process_data);
+            _local_assemblers, isConcurrentAssembly(),
+            mesh.isAxiallySymmetric(), integration_order, _process_data);
     }
 
     void assembleConcreteProcess(const double t, GlobalVector const& x,
@@ -113,10 +114,9 @@ private:
         DBUG("Assemble HydroMechanicsProcess.");
 
         // Call global assembler for each local assembly item.
-        GlobalExecutor::executeMemberDereferenced(
-            _global_assembler, &VectorMatrixAssembler::assemble,
-            _local_assemblers, *_local_to_global_index_map, t, x, M, K, b,
-            coupling_term);
+        assembleElements(&VectorMatrixAssembler::assemble, _local_assemblers,
+                         *_local_to_global_index_map, t, x, M, K, b,
+                         coupling_term);
     }
 
     void assembleWithJacobianConcreteProcess(
@@ -128,10 +128,9 @@ private:
         DBUG("AssembleJacobian HydroMechanicsProcess.");
 
         // Call global assembler for each local assembly item.
-        GlobalExecutor::executeMemberDereferenced(
-            _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
-            _local_assemblers, *_local_to_global_index_map, t, x, xdot,
-            dxdot_dx, dx_dx, M, K, b, Jac, coupling_term);
+        assembleElements(&VectorMatrixAssembler::assembleWithJacobian,
+                         _local_assemblers, *_local_to_global_index_map, t, x,
+                         xdot, dxdot_dx, dx_dx, M, K, b, Jac, coupling_term);
     }
 
     void preTimestepConcreteProcess(GlobalVector const& x, double const t,
@@ -66,7 +66,7 @@ GenericNaturalBoundaryCondition<BoundaryConditionData,
 
     createLocalAssemblers<LocalAssemblerImplementation>(
         global_dim, _elements, *_dof_table_boundary, shapefunction_order, _local_assemblers,
-        is_axially_symmetric, _integration_order, _data, fracture_prop, variable_id);
+        false, is_axially_symmetric, _integration_order, _data, fracture_prop, variable_id);
 }
 
 template <typename BoundaryConditionData,
@@ -95,5 +95,19 @@ void GenericNaturalBoundaryCondition<
         _local_assemblers, *_dof_table_boundary, t, x, K, b);
 }
 
+template <typename BoundaryConditionData,
+          template <typename, typename, unsigned>
+          class LocalAssemblerImplementation>
+void GenericNaturalBoundaryCondition<BoundaryConditionData,
+                                     LocalAssemblerImplementation>::
+    applyNaturalBCToResidual(const double t, const GlobalVector& x,
+                             GlobalVector& res, GlobalMatrix& Jac)
+{
+    GlobalExecutor::executeMemberOnDereferenced(
+        &GenericNaturalBoundaryConditionLocalAssemblerInterface::
+            assembleResidual,
+        _local_assemblers, *_dof_table_boundary, t, x, res, Jac);
+}
+
 }  // LIE
 }  // ProcessLib
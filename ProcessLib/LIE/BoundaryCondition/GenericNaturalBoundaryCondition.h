@@ -52,6 +52,12 @@ public:
                         GlobalMatrix& K,
                         GlobalVector& b) override;
 
+    /// Calls local assemblers which calculate their contributions to the global
+    /// residual and its Jacobian.
+    void applyNaturalBCToResidual(const double t, GlobalVector const& x,
+                                  GlobalVector& res,
+                                  GlobalMatrix& Jac) override;
+
 private:
     /// Data used in the assembly of the specific boundary condition.
     BoundaryConditionData _data;
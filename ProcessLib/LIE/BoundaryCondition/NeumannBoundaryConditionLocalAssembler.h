@@ -55,6 +55,28 @@ public:
                   NumLib::LocalToGlobalIndexMap const& dof_table_boundary,
                   double const t, const GlobalVector& /*x*/,
                   GlobalMatrix& /*K*/, GlobalVector& b) override
+    {
+        computeLocalRhs(id, t);
+
+        auto const indices = NumLib::getIndices(id, dof_table_boundary);
+        b.add(indices, _local_rhs);
+    }
+
+    void assembleResidual(
+        std::size_t const id,
+        NumLib::LocalToGlobalIndexMap const& dof_table_boundary, double const t,
+        const GlobalVector& /*x*/, GlobalVector& res,
+        GlobalMatrix& /*Jac*/) override
+    {
+        computeLocalRhs(id, t);
+        _local_rhs = -_local_rhs;
+
+        auto const indices = NumLib::getIndices(id, dof_table_boundary);
+        res.add(indices, _local_rhs);
+    }
+
+private:
+    void computeLocalRhs(std::size_t const id, double const t)
     {
         _local_rhs.setZero();
 
@@ -78,12 +100,8 @@ public:
                                     sm.detJ * wp.getWeight() *
                                     sm.integralMeasure;
         }
-
-        auto const indices = NumLib::getIndices(id, dof_table_boundary);
-        b.add(indices, _local_rhs);
     }
 
-private:
     Parameter<double> const& _neumann_bc_parameter;
     typename Base::NodalVectorType _local_rhs;
     MeshLib::Element const& _element;
@@ -203,8 +203,8 @@ void HydroMechanicsProcess<GlobalDim>::initializeConcreteProcess(
         mesh.getElements(), dof_table,
         // use displacment process variable for shapefunction order
         getProcessVariables()[1].get().getShapeFunctionOrder(),
-        _local_assemblers, mesh.isAxiallySymmetric(), integration_order,
-        _process_data);
+        _local_assemblers, isConcurrentAssembly(),
+        mesh.isAxiallySymmetric(), integration_order, _process_data);
 
     auto mesh_prop_sigma_xx = const_cast<MeshLib::Mesh&>(mesh)
                                   .getProperties()
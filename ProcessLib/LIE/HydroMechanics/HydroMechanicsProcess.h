@@ -50,6 +50,7 @@ public:
     //! @{
 
     bool isLinear() const override { return false; }
+    bool hasIntegrationPointHistory() const override { return true; }
     //! @}
 
     void computeSecondaryVariableConcrete(double const t,
@@ -76,10 +77,9 @@ private:
         DBUG("Assemble HydroMechanicsProcess.");
 
         // Call global assembler for each local assembly item.
-        GlobalExecutor::executeMemberDereferenced(
-            _global_assembler, &VectorMatrixAssembler::assemble,
-            _local_assemblers, *_local_to_global_index_map, t, x, M, K, b,
-            coupling_term);
+        assembleElements(&VectorMatrixAssembler::assemble, _local_assemblers,
+                         *_local_to_global_index_map, t, x, M, K, b,
+                         coupling_term);
     }
 
     void assembleWithJacobianConcreteProcess(
@@ -91,10 +91,9 @@ private:
         DBUG("AssembleWithJacobian HydroMechanicsProcess.");
 
         // Call global assembler for each local assembly item.
-        GlobalExecutor::executeMemberDereferenced(
-            _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
-            _local_assemblers, *_local_to_global_index_map, t, x, xdot,
-            dxdot_dx, dx_dx, M, K, b, Jac, coupling_term);
+        assembleElements(&VectorMatrixAssembler::assembleWithJacobian,
+                         _local_assemblers, *_local_to_global_index_map, t, x,
+                         xdot, dxdot_dx, dx_dx, M, K, b, Jac, coupling_term);
     }
 
     void preTimestepConcreteProcess(GlobalVector const& x, double const t,
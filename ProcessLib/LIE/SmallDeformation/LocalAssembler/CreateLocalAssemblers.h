@@ -13,6 +13,7 @@
 #include <logog/include/logog.hpp>
 
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "ProcessLib/Utils/ConstructLocalAssemblers.h"
 
 #include "LocalDataInitializer.h"
 
@@ -37,6 +38,7 @@ void createLocalAssemblers(
     NumLib::LocalToGlobalIndexMap const& dof_table,
     std::vector<MeshLib::Element*> const& mesh_elements,
     std::vector<std::unique_ptr<LocalAssemblerInterface>>& local_assemblers,
+    bool const concurrent,
     ExtraCtorArgs&&... extra_ctor_args)
 {
     // Shape matrices initializer
@@ -49,16 +51,11 @@ void createLocalAssemblers(
                              DisplacementDim, ExtraCtorArgs...>;
 
     DBUG("Create local assemblers.");
-    // Populate the vector of local assemblers.
-    local_assemblers.resize(mesh_elements.size());
-
     LocalDataInitializer initializer(dof_table);
 
     DBUG("Calling local assembler builder for all mesh elements.");
-    GlobalExecutor::transformDereferenced(
-        initializer,
-        mesh_elements,
-        local_assemblers,
+    ProcessLib::detail::constructLocalAssemblers(
+        initializer, mesh_elements, local_assemblers, concurrent,
         std::forward<ExtraCtorArgs>(extra_ctor_args)...);
 }
 
@@ -72,6 +69,9 @@ void createLocalAssemblers(
  *         Those arguments will be passed to the constructor of
  *         \c LocalAssemblerImplementation.
  *
+ * If \c concurrent is set, the local assemblers are constructed by OpenMP
+ * threads, see detail::constructLocalAssemblers().
+ *
  * The first two template parameters cannot be deduced from the arguments.
  * Therefore they always have to be provided manually.
  */
@@ -88,6 +88,7 @@ void createLocalAssemblers(
     std::vector<MeshLib::Element*> const& mesh_elements,
     NumLib::LocalToGlobalIndexMap const& dof_table,
     std::vector<std::unique_ptr<LocalAssemblerInterface>>& local_assemblers,
+    bool const concurrent,
     ExtraCtorArgs&&... extra_ctor_args)
 {
     DBUG("Create local assemblers.");
@@ -99,7 +100,7 @@ void createLocalAssemblers(
                                           LocalAssemblerMatrixImplementation,
                                           LocalAssemblerMatrixNearFractureImplementation,
                                           LocalAssemblerFractureImplementation>(
-                dof_table, mesh_elements, local_assemblers,
+                dof_table, mesh_elements, local_assemblers, concurrent,
                 std::forward<ExtraCtorArgs>(extra_ctor_args)...);
             break;
         default:
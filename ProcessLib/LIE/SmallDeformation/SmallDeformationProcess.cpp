@@ -178,8 +178,8 @@ void SmallDeformationProcess<DisplacementDim>::initializeConcreteProcess(
              LocalAssemblerDataMatrixNearFracture,
              LocalAssemblerDataFracture>(
         mesh.getDimension(), mesh.getElements(), dof_table,
-        _local_assemblers, mesh.isAxiallySymmetric(), integration_order,
-        _process_data);
+        _local_assemblers, isConcurrentAssembly(),
+        mesh.isAxiallySymmetric(), integration_order, _process_data);
 
     // TODO move the two data members somewhere else.
     // for extrapolation of secondary variables
@@ -72,16 +72,15 @@ void LiquidFlowLocalAssembler<ShapeFunction, IntegrationMethod, GlobalDim>::
     assert(permeability.rows() == GlobalDim || permeability.rows() == 1);
 
     const double dt = coupled_term.dt;
-    for (auto const& coupled_process_pair : coupled_term.coupled_processes)
+    for (std::size_t slot = 0; slot < coupled_term.coupled_processes.size();
+         ++slot)
     {
-        if (coupled_process_pair.first ==
+        if (coupled_term.coupled_processes[slot].process_type ==
             std::type_index(
                 typeid(ProcessLib::HeatConduction::HeatConductionProcess)))
         {
-            const auto local_T0 =
-                coupled_term.local_coupled_xs0.at(coupled_process_pair.first);
-            const auto local_T1 =
-                coupled_term.local_coupled_xs.at(coupled_process_pair.first);
+            auto const& local_T0 = coupled_term.local_coupled_xs0[slot];
+            auto const& local_T1 = coupled_term.local_coupled_xs[slot];
 
             if (permeability.size() == 1)  // isotropic or 1D problem.
                 assembleWithCoupledWithHeatTransport<IsotropicCalculator>(
@@ -63,7 +63,7 @@ void LiquidFlowProcess::initializeConcreteProcess(
     ProcessLib::ProcessVariable const& pv = getProcessVariables()[0];
     ProcessLib::createLocalAssemblers<LiquidFlowLocalAssembler>(
         mesh.getDimension(), mesh.getElements(), dof_table,
-        pv.getShapeFunctionOrder(), _local_assemblers,
+        pv.getShapeFunctionOrder(), _local_assemblers, isConcurrentAssembly(),
         mesh.isAxiallySymmetric(), integration_order, _gravitational_axis_id,
         _gravitational_acceleration, _reference_temperature,
         *_material_properties);
@@ -98,9 +98,8 @@ void LiquidFlowProcess::assembleConcreteProcess(
 {
     DBUG("Assemble LiquidFlowProcess.");
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
-        *_local_to_global_index_map, t, x, M, K, b, coupling_term);
+    assembleElements(&VectorMatrixAssembler::assemble, _local_assemblers,
+                     *_local_to_global_index_map, t, x, M, K, b, coupling_term);
 }
 
 void LiquidFlowProcess::assembleWithJacobianConcreteProcess(
@@ -112,10 +111,9 @@ void LiquidFlowProcess::assembleWithJacobianConcreteProcess(
     DBUG("AssembleWithJacobian LiquidFlowProcess.");
 
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
-        _local_assemblers, *_local_to_global_index_map, t, x, xdot, dxdot_dx,
-        dx_dx, M, K, b, Jac, coupling_term);
+    assembleElements(&VectorMatrixAssembler::assembleWithJacobian,
+                     _local_assemblers, *_local_to_global_index_map, t, x, xdot,
+                     dxdot_dx, dx_dx, M, K, b, Jac, coupling_term);
 }
 
 void LiquidFlowProcess::computeSecondaryVariableConcrete(
@@ -9,10 +9,73 @@
 
 #include "LocalAssemblerInterface.h"
 #include <cassert>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include "BaseLib/FixedSizePool.h"
+#include "BaseLib/PerThread.h"
 #include "NumLib/DOF/DOFTableUtil.h"
 
+namespace
+{
+/// Pool of one thread. The mutex is only contended if an object is freed by
+/// another thread than the one which allocated it.
+struct ThreadPool
+{
+    explicit ThreadPool(std::size_t const object_size) : pool(object_size) {}
+
+    std::mutex mutex;
+    BaseLib::FixedSizePool pool;
+};
+
+/// Each chunk starts with a pointer to the pool it has been allocated from,
+/// padded such that the object itself stays aligned.
+std::size_t const header_size = alignof(std::max_align_t);
+static_assert(sizeof(ThreadPool*) <= header_size,
+              "The chunk header cannot hold the pool pointer.");
+
+/// Pools of all threads by object size. Defined at namespace scope such that
+/// the number of threads is determined outside of any parallel region.
+BaseLib::PerThread<std::map<std::size_t, std::unique_ptr<ThreadPool>>> pools;
+
+/// Returns the calling thread's pool for objects of the given size, which is
+/// created on first use.
+ThreadPool& getPool(std::size_t const size)
+{
+    auto& pool = pools.get()[size];
+    if (!pool)
+        pool.reset(new ThreadPool(header_size + size));
+    return *pool;
+}
+}  // namespace
+
 namespace ProcessLib
 {
+void* LocalAssemblerInterface::operator new(std::size_t const size)
+{
+    auto& thread_pool = getPool(size);
+
+    void* chunk;
+    {
+        std::lock_guard<std::mutex> const lock(thread_pool.mutex);
+        chunk = thread_pool.pool.allocate();
+    }
+    *static_cast<ThreadPool**>(chunk) = &thread_pool;
+    return static_cast<char*>(chunk) + header_size;
+}
+
+void LocalAssemblerInterface::operator delete(void* const p,
+                                              std::size_t const /*size*/)
+{
+    if (!p)
+        return;
+    void* const chunk = static_cast<char*>(p) - header_size;
+    auto& thread_pool = **static_cast<ThreadPool**>(chunk);
+
+    std::lock_guard<std::mutex> const lock(thread_pool.mutex);
+    thread_pool.pool.deallocate(chunk);
+}
 
 void LocalAssemblerInterface::assembleWithCoupledTerm(
     double const /*t*/, std::vector<double> const& /*local_x*/,
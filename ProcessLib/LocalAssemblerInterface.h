@@ -9,7 +9,7 @@
 
 #pragma once
 
-
+#include <cstddef>
 #include <unordered_map>
 #include <typeindex>
 
@@ -35,6 +35,14 @@ class LocalAssemblerInterface
 public:
     virtual ~LocalAssemblerInterface() = default;
 
+    /// Local assemblers are allocated from pools, one for each object size
+    /// and OpenMP thread. Hence, the local assemblers created by one thread
+    /// are stored contiguously if they have the same size, which is the case
+    /// for the local assemblers of one element type, and are not allocated one
+    /// by one. Concrete types of equal size share a pool.
+    static void* operator new(std::size_t const size);
+    static void operator delete(void* const p, std::size_t const size);
+
     virtual void assemble(
         double const t, std::vector<double> const& local_x,
         std::vector<double>& local_M_data, std::vector<double>& local_K_data,
@@ -119,7 +119,9 @@ void Output::doOutputAlways(Process const& process,
             + ".vtu";
     DBUG("output to %s", output_file_name.c_str());
     doProcessOutput(output_file_name, x, process.getMesh(),
-                    process.getDOFTable(), process.getProcessVariables(),
+                    process.getDOFTable(),
+                    process.getSingleComponentDOFTable(),
+                    process.getProcessVariables(),
                     process.getSecondaryVariables(), process_output);
     spd.pvd_file.addVTUFile(output_file_name, t);
 
@@ -181,7 +183,9 @@ void Output::doOutputNonlinearIteration(Process const& process,
             + ".vtu";
     DBUG("output iteration results to %s", output_file_name.c_str());
     doProcessOutput(output_file_name, x, process.getMesh(),
-                    process.getDOFTable(), process.getProcessVariables(),
+                    process.getDOFTable(),
+                    process.getSingleComponentDOFTable(),
+                    process.getProcessVariables(),
                     process.getSecondaryVariables(), process_output);
 
     INFO("[time] Output took %g s.", time_output.elapsed());
@@ -60,6 +60,12 @@ public:
                                     GlobalVector const& x,
                                     const unsigned iteration) const;
 
+    //! Tells if the results of the nonlinear iterations are written.
+    bool isOutputNonlinearIterationResults() const
+    {
+        return _output_nonlinear_iteration_results;
+    }
+
     struct PairRepeatEachSteps
     {
         explicit PairRepeatEachSteps(unsigned c, unsigned e)
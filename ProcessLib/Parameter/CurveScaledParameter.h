@@ -10,6 +10,7 @@
 #pragma once
 
 #include <map>
+#include "BaseLib/PerThread.h"
 #include "MathLib/InterpolationAlgorithms/PiecewiseLinearInterpolation.h"
 #include "Parameter.h"
 #include "ProcessLib/Utils/ProcessUtils.h"
@@ -34,7 +35,8 @@ struct CurveScaledParameter final : public Parameter<T> {
     {
         _parameter =
             &findParameter<T>(_referenced_parameter_name, parameters, 0);
-        _cache.resize(_parameter->getNumberOfComponents());
+        for (auto& cache : _cache)
+            cache.resize(_parameter->getNumberOfComponents());
     }
 
     unsigned getNumberOfComponents() const override
@@ -49,16 +51,18 @@ struct CurveScaledParameter final : public Parameter<T> {
         auto const scaling = _curve.getValue(t);
 
         auto const num_comp = _parameter->getNumberOfComponents();
+        auto& cache = _cache.get();
         for (std::size_t c = 0; c < num_comp; ++c) {
-            _cache[c] = scaling * tup[c];
+            cache[c] = scaling * tup[c];
         }
-        return _cache;
+        return cache;
     }
 
 private:
     MathLib::PiecewiseLinearInterpolation const& _curve;
     Parameter<double> const* _parameter;
-    mutable std::vector<double> _cache;
+    /// Returned values, one for each thread of concurrent assemblies.
+    mutable BaseLib::PerThread<std::vector<double>> _cache;
     std::string const _referenced_parameter_name;
 };
 
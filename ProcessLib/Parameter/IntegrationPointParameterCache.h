@@ -0,0 +1,95 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+#include "Parameter.h"
+
+namespace ProcessLib
+{
+/// Values of a Parameter at all integration points of a single element.
+///
+/// Time independent parameters are evaluated only once. Time dependent
+/// parameters are re-evaluated only if they are requested for a different
+/// point in time than before, i.e., once per time step instead of once per
+/// nonlinear iteration.
+///
+/// The values are stored contiguously, integration point after integration
+/// point, the components of integration point \c ip starting at index
+/// <tt>ip * getNumberOfComponents()</tt>.
+template <typename T>
+class IntegrationPointParameterCache final
+{
+public:
+    IntegrationPointParameterCache(Parameter<T> const& parameter,
+                                   std::size_t const element_id,
+                                   unsigned const n_integration_points)
+        : _parameter(parameter),
+          _element_id(element_id),
+          _n_integration_points(n_integration_points)
+    {
+    }
+
+    /// Returns the parameter values at all integration points at time \c t.
+    std::vector<T> const& getValues(double const t)
+    {
+        if (!_is_initialized || (_parameter.isTimeDependent() && t != _t))
+            update(t);
+        return _values;
+    }
+
+    /// Returns the value of the given \c component at integration point \c ip
+    /// at time \c t.
+    T getValue(double const t, unsigned const ip, unsigned const component = 0)
+    {
+        auto const& values = getValues(t);
+        assert(ip < _n_integration_points && component < _n_components);
+        return values[ip * _n_components + component];
+    }
+
+    unsigned getNumberOfComponents() const
+    {
+        return _parameter.getNumberOfComponents();
+    }
+
+private:
+    void update(double const t)
+    {
+        _n_components = _parameter.getNumberOfComponents();
+        _values.resize(_n_integration_points * _n_components);
+
+        SpatialPosition pos;
+        pos.setElementID(_element_id);
+        for (unsigned ip = 0; ip < _n_integration_points; ++ip)
+        {
+            pos.setIntegrationPoint(ip);
+            auto const& value = _parameter(t, pos);
+            std::copy_n(value.begin(), _n_components,
+                        _values.begin() + ip * _n_components);
+        }
+
+        _t = t;
+        _is_initialized = true;
+    }
+
+    Parameter<T> const& _parameter;
+    std::size_t const _element_id;
+    unsigned const _n_integration_points;
+    unsigned _n_components = 0;
+
+    std::vector<T> _values;
+    double _t = 0;
+    bool _is_initialized = false;
+};
+
+}  // namespace ProcessLib
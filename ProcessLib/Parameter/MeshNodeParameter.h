@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "BaseLib/PerThread.h"
 #include "Parameter.h"
 
 namespace MeshLib
@@ -26,7 +27,7 @@ struct MeshNodeParameter final : public Parameter<T> {
                       MeshLib::PropertyVector<T> const& property)
         : Parameter<T>(name_),
           _property(property),
-          _cache(_property.getNumberOfComponents())
+          _cache(std::vector<double>(_property.getNumberOfComponents()))
     {
     }
 
@@ -43,15 +44,17 @@ struct MeshNodeParameter final : public Parameter<T> {
         auto const n = pos.getNodeID();
         assert(n);
         auto const num_comp = _property.getNumberOfComponents();
+        auto& cache = _cache.get();
         for (std::size_t c=0; c<num_comp; ++c) {
-            _cache[c] = _property.getComponent(*n, c);
+            cache[c] = _property.getComponent(*n, c);
         }
-        return _cache;
+        return cache;
     }
 
 private:
     MeshLib::PropertyVector<T> const& _property;
-    mutable std::vector<double> _cache;
+    /// Returned values, one for each thread of concurrent assemblies.
+    mutable BaseLib::PerThread<std::vector<double>> _cache;
 };
 
 std::unique_ptr<ParameterBase> createMeshNodeParameter(
@@ -9,7 +9,16 @@
 
 #include "Process.h"
 
+#include <algorithm>
+
 #include "BaseLib/Functional.h"
+#include "BaseLib/MemWatch.h"
+#include "BaseLib/RunTime.h"
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MeshLib/Elements/Element.h"
+#ifdef USE_PETSC
+#include "MeshLib/NodePartitionedMesh.h"
+#endif
 #include "NumLib/DOF/ComputeSparsityPattern.h"
 #include "NumLib/Extrapolation/LocalLinearLeastSquaresExtrapolator.h"
 #include "NumLib/ODESolver/ConvergenceCriterionPerComponent.h"
@@ -18,6 +27,59 @@
 
 namespace ProcessLib
 {
+namespace
+{
+/// Collects the given vectors and the solutions of the coupled processes for a
+/// local access during the assembly loop.
+std::vector<GlobalVector const*> vectorsForLocalAccess(
+    std::vector<GlobalVector const*> xs,
+    StaggeredCouplingTerm const& coupling_term)
+{
+    for (auto const& slot : coupling_term.coupled_process_slots)
+    {
+        xs.push_back(slot.x);
+        xs.push_back(slot.process.getPreviousTimeStepSolution());
+    }
+    return xs;
+}
+
+using ScopedLocalAccess = MathLib::LinAlg::ScopedLocalAccess<GlobalVector>;
+
+/// Local access to the solution of an assembly, of which the update of the
+/// ghost entries is only begun. The update is finished by
+/// Process::assembleElements() after the elements without ghost nodes are
+/// assembled, at the latest at the end of the local access.
+///
+/// The local access to the other vectors of the assembly has to be begun
+/// before, since copies of a PETSc vector share the scatter context of the
+/// ghost update.
+class OverlappedLocalAccess final
+{
+public:
+    OverlappedLocalAccess(GlobalVector const& x,
+                          GlobalVector const*& pending_ghost_update)
+        : _x(x), _pending_ghost_update(pending_ghost_update)
+    {
+        MathLib::LinAlg::beginGhostUpdate(_x);
+        MathLib::LinAlg::beginLocalAccess(_x);
+        _pending_ghost_update = &_x;
+    }
+
+    OverlappedLocalAccess(OverlappedLocalAccess const&) = delete;
+    OverlappedLocalAccess& operator=(OverlappedLocalAccess const&) = delete;
+
+    ~OverlappedLocalAccess()
+    {
+        _pending_ghost_update = nullptr;
+        MathLib::LinAlg::endLocalAccess(_x);
+    }
+
+private:
+    GlobalVector const& _x;
+    GlobalVector const*& _pending_ghost_update;
+};
+}  // namespace
+
 Process::Process(
     MeshLib::Mesh& mesh,
     std::unique_ptr<ProcessLib::AbstractJacobianAssembler>&& jacobian_assembler,
@@ -46,12 +108,27 @@ void Process::initialize()
     DBUG("Compute sparsity pattern");
     computeSparsityPattern();
 
+    computeElementAssemblyOrder();
+
     DBUG("Initialize the extrapolator");
     initializeExtrapolator();
 
+    BaseLib::RunTime time_local_assemblers;
+    time_local_assemblers.start();
+    BaseLib::MemWatch mem_watch;
+    double const memory_before = mem_watch.getResMemUsage();
+
     initializeConcreteProcess(*_local_to_global_index_map, _mesh,
                               _integration_order);
 
+    double const memory_increase =
+        (mem_watch.getResMemUsage() - memory_before) / (1024. * 1024.);
+    INFO(
+        "[time] Construction of the local assemblers of %zu elements took %g "
+        "s; resident memory increased by %.1f MiB.",
+        _mesh.getNumberOfElements(), time_local_assemblers.elapsed(),
+        memory_increase);
+
     finishNamedFunctionsInitialization();
 
     DBUG("Initialize boundary conditions.");
@@ -122,6 +199,11 @@ void Process::assemble(const double t, GlobalVector const& x, GlobalMatrix& M,
                        GlobalMatrix& K, GlobalVector& b,
                        StaggeredCouplingTerm const& coupling_term)
 {
+    ScopedLocalAccess const local_access(
+        vectorsForLocalAccess({}, coupling_term));
+    OverlappedLocalAccess const x_local_access(
+        x, _solution_with_pending_ghost_update);
+
     assembleConcreteProcess(t, x, M, K, b, coupling_term);
 
     _boundary_conditions.applyNaturalBC(t, x, K, b);
@@ -134,6 +216,11 @@ void Process::assembleWithJacobian(const double t, GlobalVector const& x,
                                    GlobalVector& b, GlobalMatrix& Jac,
                                    StaggeredCouplingTerm const& coupling_term)
 {
+    ScopedLocalAccess const local_access(
+        vectorsForLocalAccess({&xdot}, coupling_term));
+    OverlappedLocalAccess const x_local_access(
+        x, _solution_with_pending_ghost_update);
+
     assembleWithJacobianConcreteProcess(t, x, xdot, dxdot_dx, dx_dx, M, K, b,
                                         Jac, coupling_term);
 
@@ -141,6 +228,47 @@ void Process::assembleWithJacobian(const double t, GlobalVector const& x,
     _boundary_conditions.applyNaturalBC(t, x, K, b);
 }
 
+void Process::assembleTimeDiscretized(
+    const double t, GlobalVector const& x, const double dxdot_dx,
+    GlobalVector const& weighted_old_x, GlobalMatrix& A, GlobalVector& rhs,
+    StaggeredCouplingTerm const& coupling_term)
+{
+    ScopedLocalAccess const local_access(
+        vectorsForLocalAccess({&weighted_old_x}, coupling_term));
+    OverlappedLocalAccess const x_local_access(
+        x, _solution_with_pending_ghost_update);
+
+    // In the time discretized mode the global assembler adds the element
+    // contributions to A and rhs in place of K and b; the M argument is not
+    // used.
+    _global_assembler.setTimeDiscretizedAssembly(dxdot_dx, &weighted_old_x);
+    assembleConcreteProcess(t, x, A, A, rhs, coupling_term);
+    _global_assembler.unsetTimeDiscretizedAssembly();
+
+    // Natural BCs do not contribute to M, thus they can be added directly.
+    _boundary_conditions.applyNaturalBC(t, x, A, rhs);
+}
+
+void Process::assembleResidualWithJacobian(
+    const double t, GlobalVector const& x, GlobalVector const& xdot,
+    const double dxdot_dx, const double dx_dx, GlobalVector& res,
+    GlobalMatrix& Jac, StaggeredCouplingTerm const& coupling_term)
+{
+    ScopedLocalAccess const local_access(
+        vectorsForLocalAccess({&xdot}, coupling_term));
+    OverlappedLocalAccess const x_local_access(
+        x, _solution_with_pending_ghost_update);
+
+    // In the time discretized mode the global assembler adds the element
+    // residuals to res in place of b; the M and K arguments are not used.
+    _global_assembler.setTimeDiscretizedAssembly(dxdot_dx, nullptr);
+    assembleWithJacobianConcreteProcess(t, x, xdot, dxdot_dx, dx_dx, Jac, Jac,
+                                        res, Jac, coupling_term);
+    _global_assembler.unsetTimeDiscretizedAssembly();
+
+    _boundary_conditions.applyNaturalBCToResidual(t, x, res, Jac);
+}
+
 void Process::constructDofTable()
 {
     // Create single component dof in every of the mesh's nodes.
@@ -198,9 +326,11 @@ void Process::initializeExtrapolator()
         manage_storage = true;
     }
 
+    // The integration point values are read from the local assemblers, which
+    // are thread-safe if they can be assembled concurrently.
     std::unique_ptr<NumLib::Extrapolator> extrapolator(
         new NumLib::LocalLinearLeastSquaresExtrapolator(
-            *dof_table_single_component));
+            *dof_table_single_component, _concurrent_assembly));
 
     // TODO Later on the DOF table can change during the simulation!
     _extrapolator_data = ExtrapolatorData(
@@ -234,15 +364,74 @@ void Process::computeSparsityPattern()
         NumLib::computeSparsityPattern(*_local_to_global_index_map, _mesh);
 }
 
+void Process::computeElementAssemblyOrder()
+{
+    auto const& elements = _mesh.getElements();
+    _element_assembly_order.clear();
+    _element_assembly_order.reserve(elements.size());
+
+#ifdef USE_PETSC
+    // PETSc always works with MeshLib::NodePartitionedMesh.
+    assert(dynamic_cast<MeshLib::NodePartitionedMesh const*>(&_mesh));
+    auto const& npmesh =
+        *static_cast<MeshLib::NodePartitionedMesh const*>(&_mesh);
+
+    std::vector<std::size_t> boundary_elements;
+    for (auto const* const e : elements)
+    {
+        auto const* const* const nodes = e->getNodes();
+        bool const has_ghost_node = std::any_of(
+            nodes, nodes + e->getNumberOfNodes(),
+            [&npmesh](MeshLib::Node const* const n) {
+                return npmesh.isGhostNode(n->getID());
+            });
+        if (has_ghost_node)
+            boundary_elements.push_back(e->getID());
+        else
+            _element_assembly_order.push_back(e->getID());
+    }
+    DBUG("%zu of %zu elements of the partition have ghost nodes.",
+         boundary_elements.size(), elements.size());
+    _number_of_elements_without_ghost_nodes = _element_assembly_order.size();
+    _element_assembly_order.insert(_element_assembly_order.end(),
+                                   boundary_elements.begin(),
+                                   boundary_elements.end());
+#else
+    for (auto const* const e : elements)
+        _element_assembly_order.push_back(e->getID());
+    _number_of_elements_without_ghost_nodes = _element_assembly_order.size();
+#endif
+
+    // Within both groups the elements are assembled type by type. So the same
+    // local assembler implementation is called for consecutive elements, and
+    // the local assemblers, which are pooled by type, are traversed in memory
+    // order.
+    auto const by_cell_type = [&elements](std::size_t const a,
+                                          std::size_t const b) {
+        return elements[a]->getCellType() < elements[b]->getCellType();
+    };
+    auto const first_boundary_element =
+        _element_assembly_order.begin() +
+        _number_of_elements_without_ghost_nodes;
+    std::stable_sort(_element_assembly_order.begin(), first_boundary_element,
+                     by_cell_type);
+    std::stable_sort(first_boundary_element, _element_assembly_order.end(),
+                     by_cell_type);
+}
+
 void Process::preTimestep(GlobalVector const& x, const double t,
                  const double delta_t)
 {
+    ScopedLocalAccess const local_access({&x});
+
     preTimestepConcreteProcess(x, t, delta_t);
     _boundary_conditions.preTimestep(t);
 }
 
 void Process::postTimestep(GlobalVector const& x)
 {
+    ScopedLocalAccess const local_access({&x});
+
     postTimestepConcreteProcess(x);
 }
 
@@ -250,6 +439,9 @@ void Process::computeSecondaryVariable(const double t, GlobalVector const& x,
                                        StaggeredCouplingTerm const&
                                        coupled_term)
 {
+    ScopedLocalAccess const local_access(
+        vectorsForLocalAccess({&x}, coupled_term));
+
     computeSecondaryVariableConcrete(t, x, coupled_term);
 }
 
@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include "BaseLib/PerThread.h"
+#include "MathLib/LinAlg/LinAlg.h"
 #include "NumLib/ODESolver/NonlinearSolver.h"
 #include "NumLib/ODESolver/ODESystem.h"
 #include "NumLib/ODESolver/TimeDiscretization.h"
@@ -85,6 +87,21 @@ public:
                               StaggeredCouplingTerm const& coupling_term)
                               override final;
 
+    bool hasTimeDiscretizedAssembly() const override final { return true; }
+
+    void assembleTimeDiscretized(const double t, GlobalVector const& x,
+                                 const double dxdot_dx,
+                                 GlobalVector const& weighted_old_x,
+                                 GlobalMatrix& A, GlobalVector& rhs,
+                                 StaggeredCouplingTerm const& coupling_term)
+        override final;
+
+    void assembleResidualWithJacobian(
+        const double t, GlobalVector const& x, GlobalVector const& xdot,
+        const double dxdot_dx, const double dx_dx, GlobalVector& res,
+        GlobalMatrix& Jac,
+        StaggeredCouplingTerm const& coupling_term) override final;
+
     std::vector<NumLib::IndexValueVector<GlobalIndexType>> const*
     getKnownSolutions(double const t) const override final
     {
@@ -109,6 +126,12 @@ public:
         return _secondary_variables;
     }
 
+    /// Returns true if the local assemblers keep a state of the previous
+    /// timestep at the integration points, e.g., stresses or material state
+    /// variables, which is advanced in preTimestep(). Such a state is not
+    /// restored if a rejected timestep is repeated.
+    virtual bool hasIntegrationPointHistory() const { return false; }
+
     // Get the solution of the previous time step.
     virtual GlobalVector* getPreviousTimeStepSolution() const
     {
@@ -123,15 +146,80 @@ public:
         return std::vector<double>{};
     }
 
+    NumLib::LocalToGlobalIndexMap const& getSingleComponentDOFTable() const
+    {
+        return _extrapolator_data.getDOFTable();
+    }
+
+    /// Enables the concurrent assembly of the elements by OpenMP threads, see
+    /// assembleElements(), the concurrent construction of the local assemblers
+    /// and the concurrent extrapolation of secondary variables. Must be called
+    /// before initialize().
+    void setConcurrentAssembly(bool const concurrent_assembly)
+    {
+        _concurrent_assembly = concurrent_assembly;
+    }
+
 protected:
+    /// \see setConcurrentAssembly()
+    bool isConcurrentAssembly() const { return _concurrent_assembly; }
+
     NumLib::Extrapolator& getExtrapolator() const
     {
         return _extrapolator_data.getExtrapolator();
     }
 
-    NumLib::LocalToGlobalIndexMap const& getSingleComponentDOFTable() const
+    /// Calls the given assembly \c method of #_global_assembler for the local
+    /// assemblers of all elements in #_element_assembly_order.
+    ///
+    /// The elements without ghost nodes are assembled first, while the update
+    /// of the ghost entries of the solution begun by assemble() and the other
+    /// assembly methods is in flight. Then the update is finished, and the
+    /// remaining elements, which read ghost entries, are assembled.
+    ///
+    /// With concurrent assembly the elements without ghost nodes are assembled
+    /// by OpenMP threads, the remaining elements by the calling thread. The
+    /// first error of the threads is rethrown by the calling thread. Within an
+    /// active parallel region, e.g., if processes are solved concurrently, all
+    /// elements are assembled by the calling thread.
+    template <typename Method, typename LocalAssemblers, typename... Args>
+    void assembleElements(Method const method,
+                          LocalAssemblers const& local_assemblers,
+                          Args&&... args)
     {
-        return _extrapolator_data.getDOFTable();
+        auto const assemble = [&](std::size_t const i) {
+            auto const id = _element_assembly_order[i];
+            (_global_assembler.*method)(id, *local_assemblers[id], args...);
+        };
+        OPENMP_LOOP_TYPE const n_without_ghost_nodes =
+            _number_of_elements_without_ghost_nodes;
+
+        if (!_concurrent_assembly || BaseLib::isInParallelRegion())
+        {
+            for (OPENMP_LOOP_TYPE i = 0; i < n_without_ghost_nodes; ++i)
+                assemble(i);
+        }
+        else
+        {
+            // Errors of the local assemblers are raised after the parallel
+            // loop.
+            BaseLib::FirstException first_exception;
+#pragma omp parallel for schedule(dynamic, 64)
+            for (OPENMP_LOOP_TYPE i = 0; i < n_without_ghost_nodes; ++i)
+                first_exception.run([&] { assemble(i); });
+            first_exception.rethrow();
+        }
+
+        if (_solution_with_pending_ghost_update)
+        {
+            MathLib::LinAlg::finishGhostUpdate(
+                *_solution_with_pending_ghost_update);
+            _solution_with_pending_ghost_update = nullptr;
+        }
+
+        for (std::size_t i = n_without_ghost_nodes;
+             i < _element_assembly_order.size(); ++i)
+            assemble(i);
     }
 
 private:
@@ -190,6 +278,9 @@ private:
     /// DOF-table.
     void computeSparsityPattern();
 
+    /// Computes #_element_assembly_order.
+    void computeElementAssemblyOrder();
+
 protected:
     MeshLib::Mesh& _mesh;
     std::unique_ptr<MeshLib::MeshSubset const> _mesh_subset_all_nodes;
@@ -205,6 +296,18 @@ protected:
 
     VectorMatrixAssembler _global_assembler;
 
+    /// Ids of the mesh elements in the order they are assembled. In a
+    /// partitioned mesh the elements without ghost nodes come first, see
+    /// assembleElements(). Within these two groups the elements are ordered by
+    /// their cell type.
+    std::vector<std::size_t> _element_assembly_order;
+    /// Number of elements at the beginning of #_element_assembly_order which
+    /// have no ghost nodes.
+    std::size_t _number_of_elements_without_ghost_nodes = 0;
+    /// The solution whose ghost update overlaps the assembly of the elements
+    /// without ghost nodes, see assembleElements().
+    GlobalVector const* _solution_with_pending_ghost_update = nullptr;
+
     /// Order of the integration method for element-wise integration.
     /// The Gauss-Legendre integration method and available orders is
     /// implemented in MathLib::GaussLegendre.
@@ -219,6 +322,9 @@ private:
     BoundaryConditionCollection _boundary_conditions;
 
     ExtrapolatorData _extrapolator_data;
+
+    /// \see setConcurrentAssembly()
+    bool _concurrent_assembly = false;
 };
 
 }  // namespace ProcessLib
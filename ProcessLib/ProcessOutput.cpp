@@ -9,11 +9,74 @@
 
 #include "ProcessOutput.h"
 
+#include "MathLib/LinAlg/LinAlg.h"
 #include "MeshLib/IO/VtkIO/VtuInterface.h"
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
 
 namespace ProcessLib
 {
+//! Returns the entry of \c x with the given index of the local form, which
+//! includes the ghost entries. A local access of \c x has to be active.
+static double getLocalValue(GlobalVector const& x, GlobalIndexType const index)
+{
+#ifdef USE_PETSC
+    return x.getLocalValue(index);
+#else
+    return x[index];
+#endif
+}
+
+using ScopedLocalAccess = MathLib::LinAlg::ScopedLocalAccess<GlobalVector>;
+
+void copyNodalValues(
+    GlobalVector const& nodal_values,
+    NumLib::LocalToGlobalIndexMap const& dof_table_single_component,
+    std::vector<double>& node_values)
+{
+#ifdef USE_PETSC
+    // The nodal values of the own and of the ghost nodes of this partition are
+    // read; they are ordered according to the d.o.f. table.
+    ScopedLocalAccess const local_access({&nodal_values});
+    for (auto const& mesh_subset :
+         dof_table_single_component.getMeshSubsets(0, 0))
+    {
+        auto const mesh_id = mesh_subset->getMeshID();
+        for (auto const* node : mesh_subset->getNodes())
+        {
+            MeshLib::Location const l(mesh_id, MeshLib::MeshItemType::Node,
+                                      node->getID());
+            auto const index = dof_table_single_component.getLocalIndex(
+                l, 0, nodal_values.getRangeBegin(),
+                nodal_values.getRangeEnd());
+
+            auto const value = getLocalValue(nodal_values, index);
+            assert(!std::isnan(value));
+            node_values[node->getID()] = value;
+        }
+    }
+#else
+    (void)dof_table_single_component;
+    for (std::size_t i = 0; i < node_values.size(); ++i)
+    {
+        assert(!std::isnan(nodal_values[i]));
+        node_values[i] = nodal_values[i];
+    }
+#endif
+}
+
+void copyElementResiduals(GlobalVector const& residuals,
+                          std::vector<double>& element_values)
+{
+    // The residuals of the elements of this partition are stored in element
+    // order.
+    ScopedLocalAccess const local_access({&residuals});
+    for (std::size_t i = 0; i < element_values.size(); ++i)
+    {
+        auto const value = getLocalValue(residuals, i);
+        assert(!std::isnan(value));
+        element_values[i] = value;
+    }
+}
 
 ProcessOutput::ProcessOutput(BaseLib::ConfigTree const& output_config)
 {
@@ -46,6 +109,7 @@ void doProcessOutput(
         GlobalVector const& x,
         MeshLib::Mesh& mesh,
         NumLib::LocalToGlobalIndexMap const& dof_table,
+        NumLib::LocalToGlobalIndexMap const& dof_table_single_component,
         std::vector<std::reference_wrapper<ProcessVariable>> const&
         process_variables,
         SecondaryVariableCollection secondary_variables,
@@ -53,17 +117,6 @@ void doProcessOutput(
 {
     DBUG("Process output.");
 
-    // Copy result
-#ifdef USE_PETSC
-    // TODO It is also possible directly to copy the data for single process
-    // variable to a mesh property. It needs a vector of global indices and
-    // some PETSc magic to do so.
-    std::vector<double> x_copy(x.getLocalSize() + x.getGhostSize());
-#else
-    std::vector<double> x_copy(x.size());
-#endif
-    x.copyValues(x_copy);
-
     auto const& output_variables = process_output.output_variables;
     std::set<std::string> already_output;
 
@@ -71,6 +124,8 @@ void doProcessOutput(
     int global_component_offset_next = 0;
 
     // primary variables
+    // The values are read directly from the local form of x.
+    ScopedLocalAccess const x_local_access({&x});
     for (int variable_id = 0;
          variable_id < static_cast<int>(process_variables.size());
          ++variable_id)
@@ -111,13 +166,12 @@ void doProcessOutput(
                             x.getRangeEnd());
 
                 output_data[node->getID() * n_components + component_id] =
-                        x_copy[index];
+                        getLocalValue(x, index);
                 }
             }
         }
     }
 
-#ifndef USE_PETSC
     // the following section is for the output of secondary variables
 
     auto count_mesh_items = [](
@@ -171,12 +225,8 @@ void doProcessOutput(
             auto const& nodal_values =
                     var.fcts.eval_field(x, dof_table, result_cache);
 
-            // Copy result
-            for (std::size_t i = 0; i < mesh.getNumberOfNodes(); ++i)
-            {
-                assert(!std::isnan(nodal_values[i]));
-                (*result)[i] = nodal_values[i];
-            }
+            copyNodalValues(nodal_values, dof_table_single_component,
+                            *result);
         }
 
         if (process_output.output_residuals && var.fcts.eval_residuals)
@@ -190,14 +240,8 @@ void doProcessOutput(
 
             std::unique_ptr<GlobalVector> result_cache;
             auto const& residuals =
-                    var.fcts.eval_residuals(x, dof_table, result_cache);
-
-            // Copy result
-            for (std::size_t i = 0; i < mesh.getNumberOfElements(); ++i)
-            {
-                assert(!std::isnan(residuals[i]));
-                (*result)[i] = residuals[i];
-            }
+                var.fcts.eval_residuals(x, dof_table, result_cache);
+            copyElementResiduals(residuals, *result);
         }
     };
 
@@ -213,9 +257,6 @@ void doProcessOutput(
     }
 
     // secondary variables output end
-#else
-    (void) secondary_variables;
-#endif // USE_PETSC
 
     // Write output file
     DBUG("Writing output to \'%s\'.", file_name.c_str());
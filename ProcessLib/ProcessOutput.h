@@ -29,12 +29,30 @@ struct ProcessOutput final
 };
 
 
+//! Copies the nodal values of a secondary variable, which are ordered according
+//! to \c dof_table_single_component, to \c node_values, which is indexed by the
+//! ids of the mesh nodes. In parallel runs these are the own and the ghost
+//! nodes of the partition.
+void copyNodalValues(
+    GlobalVector const& nodal_values,
+    NumLib::LocalToGlobalIndexMap const& dof_table_single_component,
+    std::vector<double>& node_values);
+
+//! Copies the extrapolation residuals of the elements of the mesh or of the
+//! partition to \c element_values, which is indexed by the element ids.
+void copyElementResiduals(GlobalVector const& residuals,
+                          std::vector<double>& element_values);
+
 //! Writes output to the given \c file_name using the VTU file format.
+//!
+//! \c dof_table_single_component is the d.o.f. table of the nodal values of
+//! the secondary variables.
 void doProcessOutput(
         std::string const& file_name,
         GlobalVector const& x,
         MeshLib::Mesh& mesh,
         NumLib::LocalToGlobalIndexMap const& dof_table,
+        NumLib::LocalToGlobalIndexMap const& dof_table_single_component,
         std::vector<std::reference_wrapper<ProcessVariable>> const&
         process_variables,
         SecondaryVariableCollection secondary_variables,
@@ -41,7 +41,7 @@ void RichardsFlowProcess::initializeConcreteProcess(
     ProcessLib::ProcessVariable const& pv = getProcessVariables()[0];
     ProcessLib::createLocalAssemblers<LocalAssemblerData>(
         mesh.getDimension(), mesh.getElements(), dof_table,
-        pv.getShapeFunctionOrder(), _local_assemblers,
+        pv.getShapeFunctionOrder(), _local_assemblers, isConcurrentAssembly(),
         mesh.isAxiallySymmetric(), integration_order, _process_data);
 
     _secondary_variables.addSecondaryVariable(
@@ -85,9 +85,8 @@ void RichardsFlowProcess::assembleConcreteProcess(const double t,
     DBUG("Assemble RichardsFlowProcess.");
 
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assemble, _local_assemblers,
-        *_local_to_global_index_map, t, x, M, K, b, coupling_term);
+    assembleElements(&VectorMatrixAssembler::assemble, _local_assemblers,
+                     *_local_to_global_index_map, t, x, M, K, b, coupling_term);
 }
 
 void RichardsFlowProcess::assembleWithJacobianConcreteProcess(
@@ -99,10 +98,9 @@ void RichardsFlowProcess::assembleWithJacobianConcreteProcess(
     DBUG("AssembleWithJacobian RichardsFlowProcess.");
 
     // Call global assembler for each local assembly item.
-    GlobalExecutor::executeMemberDereferenced(
-        _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
-        _local_assemblers, *_local_to_global_index_map, t, x, xdot, dxdot_dx,
-        dx_dx, M, K, b, Jac, coupling_term);
+    assembleElements(&VectorMatrixAssembler::assembleWithJacobian,
+                     _local_assemblers, *_local_to_global_index_map, t, x, xdot,
+                     dxdot_dx, dx_dx, M, K, b, Jac, coupling_term);
 }
 
 void RichardsFlowProcess::computeSecondaryVariableConcrete(
@@ -50,6 +50,7 @@ public:
     //! @{
 
     bool isLinear() const override { return false; }
+    bool hasIntegrationPointHistory() const override { return true; }
     //! @}
 
 private:
@@ -63,8 +64,8 @@ private:
         ProcessLib::SmallDeformation::createLocalAssemblers<DisplacementDim,
                                                             LocalAssemblerData>(
             mesh.getDimension(), mesh.getElements(), dof_table,
-            _local_assemblers, mesh.isAxiallySymmetric(), integration_order,
-            _process_data);
+            _local_assemblers, isConcurrentAssembly(),
+            mesh.isAxiallySymmetric(), integration_order, _process_data);
 
         // TODO move the two data members somewhere else.
         // for extrapolation of secondary variables
@@ -150,10 +151,9 @@ private:
         DBUG("Assemble SmallDeformationProcess.");
 
         // Call global assembler for each local assembly item.
-        GlobalExecutor::executeMemberDereferenced(
-            _global_assembler, &VectorMatrixAssembler::assemble,
-            _local_assemblers, *_local_to_global_index_map, t, x, M, K, b,
-            coupling_term);
+        assembleElements(&VectorMatrixAssembler::assemble, _local_assemblers,
+                         *_local_to_global_index_map, t, x, M, K, b,
+                         coupling_term);
     }
 
     void assembleWithJacobianConcreteProcess(
@@ -165,10 +165,9 @@ private:
         DBUG("AssembleWithJacobian SmallDeformationProcess.");
 
         // Call global assembler for each local assembly item.
-        GlobalExecutor::executeMemberDereferenced(
-            _global_assembler, &VectorMatrixAssembler::assembleWithJacobian,
-            _local_assemblers, *_local_to_global_index_map, t, x, xdot,
-            dxdot_dx, dx_dx, M, K, b, Jac, coupling_term);
+        assembleElements(&VectorMatrixAssembler::assembleWithJacobian,
+                         _local_assemblers, *_local_to_global_index_map, t, x,
+                         xdot, dxdot_dx, dx_dx, M, K, b, Jac, coupling_term);
     }
 
     void preTimestepConcreteProcess(GlobalVector const& x, double const t,
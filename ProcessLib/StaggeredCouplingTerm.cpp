@@ -15,6 +15,39 @@
 
 namespace ProcessLib
 {
+static std::vector<CoupledProcessSlot> createCoupledProcessSlots(
+    std::unordered_map<std::type_index, Process const&> const&
+        coupled_processes,
+    std::unordered_map<std::type_index, GlobalVector const&> const&
+        coupled_xs)
+{
+    std::vector<CoupledProcessSlot> slots;
+    slots.reserve(coupled_processes.size());
+    for (auto const& coupled_process_pair : coupled_processes)
+    {
+        auto const found = coupled_xs.find(coupled_process_pair.first);
+        slots.push_back({coupled_process_pair.first,
+                         coupled_process_pair.second,
+                         found == coupled_xs.end() ? nullptr : &found->second});
+    }
+    return slots;
+}
+
+StaggeredCouplingTerm::StaggeredCouplingTerm(
+    std::unordered_map<std::type_index, Process const&> const&
+        coupled_processes_,
+    std::unordered_map<std::type_index, GlobalVector const&> const&
+        coupled_xs_,
+    const double dt_, const bool empty_)
+    : coupled_processes(coupled_processes_),
+      coupled_xs(coupled_xs_),
+      coupled_process_slots(
+          createCoupledProcessSlots(coupled_processes_, coupled_xs_)),
+      dt(dt_),
+      empty(empty_)
+{
+}
+
 const StaggeredCouplingTerm createVoidStaggeredCouplingTerm()
 {
     std::unordered_map<std::type_index, Process const&> coupled_processes;
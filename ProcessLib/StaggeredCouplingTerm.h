@@ -14,6 +14,7 @@
 
 #include <unordered_map>
 #include <typeindex>
+#include <vector>
 
 #include "MathLib/LinAlg/GlobalMatrixVectorTypes.h"
 
@@ -21,6 +22,21 @@ namespace ProcessLib
 {
 class Process;
 
+/**
+ *  A coupled process together with the current solution of its equations.
+ *
+ *  The position of an instance in StaggeredCouplingTerm::coupled_process_slots
+ *  is the slot of the coupled process. The local solutions of the coupled
+ *  processes are addressed by that slot, see LocalCouplingTerm.
+ */
+struct CoupledProcessSlot
+{
+    std::type_index const process_type;
+    Process const& process;
+    /// Current solution of the coupled process, null if not available.
+    GlobalVector const* const x;
+};
+
 /**
  *  A struct to keep the references of the coupled processes and the references
  *  of the current solutions of the equations of the coupled processes.
@@ -36,13 +52,7 @@ struct StaggeredCouplingTerm
             coupled_processes_,
         std::unordered_map<std::type_index, GlobalVector const&> const&
             coupled_xs_,
-        const double dt_, const bool empty_ = false)
-        : coupled_processes(coupled_processes_),
-          coupled_xs(coupled_xs_),
-          dt(dt_),
-          empty(empty_)
-    {
-    }
+        const double dt_, const bool empty_ = false);
 
     /// References to the coupled processes are distinguished by the keys of
     /// process types.
@@ -53,6 +63,10 @@ struct StaggeredCouplingTerm
     /// The coupled solutions are distinguished by the keys of process types.
     std::unordered_map<std::type_index, GlobalVector const&> const& coupled_xs;
 
+    /// The coupled processes and their current solutions in a fixed order,
+    /// such that the local solutions can be gathered without lookups.
+    std::vector<CoupledProcessSlot> const coupled_process_slots;
+
     const double dt;   ///< Time step size.
     const bool empty;  ///< Flag to indicate whether the couping term is empty.
 };
@@ -63,38 +77,34 @@ struct StaggeredCouplingTerm
  *  of the coupled processes.
  *
  *  During the global assembly loop, an instance of this struct is created for
- *  each element and it is then passed to local assemblers.
+ *  each element and it is then passed to local assemblers. The local solutions
+ *  are stored in buffers owned by the global assembler, which are reused for
+ *  all elements.
  */
 struct LocalCouplingTerm
 {
     LocalCouplingTerm(
         const double dt_,
-        std::unordered_map<std::type_index, Process const&> const&
-            coupled_processes_,
-        std::unordered_map<std::type_index, const std::vector<double>>&&
-            local_coupled_xs0_,
-        std::unordered_map<std::type_index, const std::vector<double>>&&
-            local_coupled_xs_)
+        std::vector<CoupledProcessSlot> const& coupled_processes_,
+        std::vector<std::vector<double>> const& local_coupled_xs0_,
+        std::vector<std::vector<double>> const& local_coupled_xs_)
         : dt(dt_),
           coupled_processes(coupled_processes_),
-          local_coupled_xs0(std::move(local_coupled_xs0_)),
-          local_coupled_xs(std::move(local_coupled_xs_))
+          local_coupled_xs0(local_coupled_xs0_),
+          local_coupled_xs(local_coupled_xs_)
     {
     }
 
     const double dt;  ///< Time step size.
 
-    /// References to the coupled processes are distinguished by the keys of
-    /// process types.
-    std::unordered_map<std::type_index, Process const&> const&
-        coupled_processes;
+    /// The coupled processes, the position of an entry is its slot.
+    std::vector<CoupledProcessSlot> const& coupled_processes;
 
-    /// Local solutions of the previous time step.
-    std::unordered_map<std::type_index, const std::vector<double>> const
-        local_coupled_xs0;
-    /// Local solutions of the current time step.
-    std::unordered_map<std::type_index, const std::vector<double>> const
-        local_coupled_xs;
+    /// Local solutions of the previous time step, indexed by slot. Empty if
+    /// the coupled process does not provide the previous solution.
+    std::vector<std::vector<double>> const& local_coupled_xs0;
+    /// Local solutions of the current time step, indexed by slot.
+    std::vector<std::vector<double>> const& local_coupled_xs;
 };
 
 /**
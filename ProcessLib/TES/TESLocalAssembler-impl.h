@@ -141,7 +141,7 @@ void TESLocalAssembler<ShapeFunction_, IntegrationMethod_, GlobalDim>::assemble(
     unsigned const n_integration_points =
         _integration_method.getNumberOfPoints();
 
-    _d.preEachAssemble();
+    _d.preEachAssemble(local_x, _shape_matrices);
 
     for (unsigned ip = 0; ip < n_integration_points; ip++)
     {
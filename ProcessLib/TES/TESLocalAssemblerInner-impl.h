@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <cassert>
+
 #include <logog/include/logog.hpp>
 
 #include "NumLib/Function/Interpolation.h"
@@ -289,7 +291,9 @@ void TESLocalAssemblerInner<Traits>::assembleIntegrationPoint(
 }
 
 template <typename Traits>
-void TESLocalAssemblerInner<Traits>::preEachAssemble()
+void TESLocalAssemblerInner<Traits>::preEachAssemble(
+    std::vector<double> const& localX,
+    ShapeMatricesVector const& shape_matrices)
 {
     if (_d.ap.iteration_in_current_timestep == 1)
     {
@@ -306,6 +310,18 @@ void TESLocalAssemblerInner<Traits>::preEachAssemble()
             _d.solid_density = _d.solid_density_prev_ts;
         }
     }
+
+    if (!_d.reaction_adaptor->needsIntegrationPointStates())
+        return;
+
+    _ip_states.resize(shape_matrices.size());
+    for (std::size_t ip = 0; ip < shape_matrices.size(); ++ip)
+    {
+        auto& s = _ip_states[ip];
+        NumLib::shapeFunctionInterpolate(localX, shape_matrices[ip].N, s.p,
+                                         s.T, s.vapour_mass_fraction);
+    }
+    _d.reaction_adaptor->initReactions(_ip_states);
 }
 
 }  // namespace TES
@@ -17,6 +17,7 @@
 #include "ProcessLib/VariableTransformation.h"
 
 #include "TESLocalAssemblerData.h"
+#include "TESReactionAdaptor.h"
 
 namespace ProcessLib
 {
@@ -26,6 +27,10 @@ template <typename Traits>
 class TESLocalAssemblerInner
 {
 public:
+    using ShapeMatricesVector =
+        std::vector<typename Traits::ShapeMatrices,
+                    Eigen::aligned_allocator<typename Traits::ShapeMatrices>>;
+
     explicit TESLocalAssemblerInner(AssemblyParams const& ap,
                                     const unsigned num_int_pts,
                                     const unsigned dimension);
@@ -39,7 +44,9 @@ public:
         Eigen::Map<typename Traits::LocalMatrix>& local_K,
         Eigen::Map<typename Traits::LocalVector>& local_b);
 
-    void preEachAssemble();
+    void preEachAssemble(
+        std::vector<double> const& localX,
+        ShapeMatricesVector const& shape_matrices);
 
     // TODO better encapsulation
     AssemblyParams const& getAssemblyParameters() const { return _d.ap; }
@@ -65,6 +72,10 @@ private:
     void initReaction(const unsigned int_pt);
 
     TESLocalAssemblerData _d;
+
+    //! Primary variables at all integration points, passed to the reaction
+    //! adaptor if it integrates the reaction of all of them at once.
+    std::vector<IntegrationPointState> _ip_states;
 };
 
 }  // namespace TES
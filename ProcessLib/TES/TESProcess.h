@@ -48,6 +48,7 @@ public:
         GlobalVector const& x) override;
 
     bool isLinear() const override { return false; }
+    bool hasIntegrationPointHistory() const override { return true; }
 
 private:
     void initializeConcreteProcess(
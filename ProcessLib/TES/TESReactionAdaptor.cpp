@@ -8,6 +8,7 @@
  */
 
 #include <cassert>
+#include <mutex>
 
 #include <logog/include/logog.hpp>
 
@@ -25,6 +26,15 @@ namespace ProcessLib
 {
 namespace TES
 {
+namespace
+{
+// TODO: double check!
+// const double xv_NR  = SolidProp->non_reactive_solid_volume_fraction;
+// const double rho_NR = SolidProp->non_reactive_solid_density;
+const double xv_NR = 0.0;
+const double rho_NR = 0.0;
+}  // anonymous namespace
+
 std::unique_ptr<TESFEMReactionAdaptor> TESFEMReactionAdaptor::newInstance(
     TESLocalAssemblerData const& data)
 {
@@ -305,7 +315,18 @@ TESFEMReactionAdaptorCaOH2::TESFEMReactionAdaptorCaOH2(
     : _d(data),
       _react(dynamic_cast<Adsorption::ReactionCaOH2&>(*data.ap.react_sys.get()))
 {
-    _ode_solver = MathLib::ODE::createODESolver<1>(_react.getOdeSolverConfig());
+    _batch_solver = _react.getBatchOdeSolver();
+    if (_batch_solver)
+        return;
+
+    {
+        // The configuration is shared by all local assemblers, which are
+        // constructed concurrently, and reading it is not thread-safe.
+        static std::mutex ode_solver_config_mutex;
+        std::lock_guard<std::mutex> const lock(ode_solver_config_mutex);
+        _ode_solver =
+            MathLib::ODE::createODESolver<1>(_react.getOdeSolverConfig());
+    }
     // TODO invalidate config
 
     _ode_solver->setTolerance(1e-10, 1e-10);
@@ -321,6 +342,34 @@ TESFEMReactionAdaptorCaOH2::TESFEMReactionAdaptorCaOH2(
     _ode_solver->setFunction(f, nullptr);
 }
 
+bool TESFEMReactionAdaptorCaOH2::needsIntegrationPointStates() const
+{
+    return _batch_solver && _d.ap.iteration_in_current_timestep <= 1 &&
+           _d.ap.number_of_try_of_iteration <= 1;
+}
+
+void TESFEMReactionAdaptorCaOH2::initReactions(
+    std::vector<IntegrationPointState> const& states)
+{
+    assert(_batch_solver);
+
+    _solid_density.resize(states.size());
+    for (std::size_t ip = 0; ip < states.size(); ++ip)
+    {
+        _solid_density[ip] =
+            (_d.solid_density_prev_ts[ip] - xv_NR * rho_NR) / (1.0 - xv_NR);
+    }
+
+    auto const f = [this, &states](std::size_t const ip, double const y) {
+        auto const& s = states[ip];
+        _react.updateParam(s.T, s.p, s.vapour_mass_fraction,
+                           _d.solid_density_prev_ts[ip]);
+        return _react.getReactionRate(y);
+    };
+
+    _batch_solver->solve(f, _d.ap.delta_t, _solid_density, _reaction_rate);
+}
+
 ReactionRate TESFEMReactionAdaptorCaOH2::initReaction(const unsigned int int_pt)
 {
     // TODO if the first holds, the second also has to hold
@@ -330,11 +379,13 @@ ReactionRate TESFEMReactionAdaptorCaOH2::initReaction(const unsigned int int_pt)
         return {_d.reaction_rate[int_pt], _d.solid_density[int_pt]};
     }
 
-    // TODO: double check!
-    // const double xv_NR  = SolidProp->non_reactive_solid_volume_fraction;
-    // const double rho_NR = SolidProp->non_reactive_solid_density;
-    const double xv_NR = 0.0;
-    const double rho_NR = 0.0;
+    if (_batch_solver)
+    {
+        // the reaction has been integrated for all integration points in
+        // initReactions()
+        return limitSolidDensity(_reaction_rate[int_pt],
+                                 _solid_density[int_pt]);
+    }
 
     const double t0 = 0.0;
     const double y0 =
@@ -357,18 +408,23 @@ ReactionRate TESFEMReactionAdaptorCaOH2::initReaction(const unsigned int int_pt)
     auto const& y_new = _ode_solver->getSolution();
     auto const& y_dot_new = _ode_solver->getYDot(t_end, y_new);
 
+    return limitSolidDensity(y_dot_new[0], y_new[0]);
+}
+
+ReactionRate TESFEMReactionAdaptorCaOH2::limitSolidDensity(
+    double const y_dot, double const y) const
+{
     double rho_react;
 
     // cut off when limits are reached
-    if (y_new[0] < _react.rho_low)
+    if (y < _react.rho_low)
         rho_react = _react.rho_low;
-    else if (y_new[0] > _react.rho_up)
+    else if (y > _react.rho_up)
         rho_react = _react.rho_up;
     else
-        rho_react = y_new[0];
+        rho_react = y;
 
-    return {y_dot_new[0] * (1.0 - xv_NR),
-            (1.0 - xv_NR) * rho_react + xv_NR * rho_NR};
+    return {y_dot * (1.0 - xv_NR), (1.0 - xv_NR) * rho_react + xv_NR * rho_NR};
 }
 
 }  // namespace TES
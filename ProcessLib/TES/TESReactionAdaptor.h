@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "MaterialLib/Adsorption/ReactionCaOH2.h"
+#include "MathLib/ODE/BackwardEulerBatchSolver.h"
 #include "MathLib/ODE/ODESolver.h"
 
 namespace ProcessLib
@@ -27,6 +28,14 @@ struct ReactionRate
     const double solid_density;
 };
 
+/// Primary variables at an integration point.
+struct IntegrationPointState
+{
+    double p;
+    double T;
+    double vapour_mass_fraction;
+};
+
 class TESFEMReactionAdaptor
 {
 public:
@@ -38,6 +47,18 @@ public:
 
     virtual ReactionRate initReaction(const unsigned int_pt) = 0;
 
+    /// Tells if initReactions() has to be called before the integration
+    /// points are assembled.
+    virtual bool needsIntegrationPointStates() const { return false; }
+
+    /// Advances the reaction of all integration points of the element at once.
+    /// Afterwards initReaction() returns the results for the single
+    /// integration points.
+    virtual void initReactions(
+        std::vector<IntegrationPointState> const& /*states*/)
+    {
+    }
+
     virtual void preZerothTryAssemble() {}
     // TODO: remove
     virtual double getReactionDampingFactor() const { return -1.0; }
@@ -112,7 +133,15 @@ public:
 
     ReactionRate initReaction(const unsigned) override;
 
+    bool needsIntegrationPointStates() const override;
+
+    void initReactions(
+        std::vector<IntegrationPointState> const& states) override;
+
 private:
+    /// Cuts off the solid density \c y at the limits of the reaction.
+    ReactionRate limitSolidDensity(double const y_dot, double const y) const;
+
     using Data = TESLocalAssemblerData;
     using React = Adsorption::ReactionCaOH2;
     Data const& _d;
@@ -120,6 +149,12 @@ private:
 
     std::unique_ptr<MathLib::ODE::ODESolver<1>> _ode_solver;
 
+    /// Integrates the reaction of all integration points at once if set,
+    /// otherwise _ode_solver is used for each integration point separately.
+    MathLib::ODE::BackwardEulerBatchSolver const* _batch_solver = nullptr;
+    std::vector<double> _solid_density;  ///< workspace of _batch_solver
+    std::vector<double> _reaction_rate;  ///< workspace of _batch_solver
+
     static bool odeRhs(const double /*t*/,
                        MathLib::ODE::MappedConstVector<1> const y,
                        MathLib::ODE::MappedVector<1>
@@ -8,12 +8,22 @@
  */
 
 #include "UncoupledProcessesTimeLoop.h"
+
+#include <algorithm>
+#include <limits>
+#include <set>
+
+#include "BaseLib/PerThread.h"
 #include "BaseLib/uniqueInsert.h"
 #include "BaseLib/RunTime.h"
+#include "NumLib/DOF/GlobalMatrixProviders.h"
 #include "NumLib/ODESolver/TimeDiscretizationBuilder.h"
 #include "NumLib/ODESolver/TimeDiscretizedODESystem.h"
 #include "NumLib/ODESolver/ConvergenceCriterionPerComponent.h"
+#include "NumLib/ODESolver/FixedPointAccelerator.h"
+#include "NumLib/ODESolver/SolutionPredictor.h"
 #include "NumLib/TimeStepping/Algorithms/FixedTimeStepping.h"
+#include "NumLib/TimeStepping/Algorithms/PIControlledTimeStepping.h"
 
 #include "MathLib/LinAlg/LinAlg.h"
 
@@ -35,6 +45,10 @@ std::unique_ptr<NumLib::ITimeStepAlgorithm> createTimeStepper(
     {
         timestepper = NumLib::FixedTimeStepping::newInstance(config);
     }
+    else if (type == "PIControlledTimeStepping")
+    {
+        timestepper = NumLib::PIControlledTimeStepping::newInstance(config);
+    }
     else
     {
         OGS_FATAL("Unknown timestepper type: `%s'.", type.c_str());
@@ -150,6 +164,9 @@ struct SingleProcessData
     //! cast of \c tdisc_ode_sys to NumLib::InternalMatrixStorage
     NumLib::InternalMatrixStorage* mat_strg = nullptr;
 
+    //! Optional predictor of the initial guess of each timestep.
+    std::unique_ptr<NumLib::SolutionPredictor> predictor;
+
     Process& process;
     /// Coupled processes.
     std::unordered_map<std::type_index, Process const&> const coupled_processes;
@@ -181,6 +198,7 @@ SingleProcessData::SingleProcessData(SingleProcessData&& spd)
       time_disc(std::move(spd.time_disc)),
       tdisc_ode_sys(std::move(spd.tdisc_ode_sys)),
       mat_strg(spd.mat_strg),
+      predictor(std::move(spd.predictor)),
       process(spd.process),
       coupled_processes(spd.coupled_processes),
       process_output(std::move(spd.process_output))
@@ -336,9 +354,20 @@ std::vector<std::unique_ptr<SingleProcessData>> createPerProcessData(
         //! \ogs_file_param{prj__time_loop__processes__process__output}
         ProcessOutput process_output{pcs_config.getConfigSubtree("output")};
 
+        auto const predictor_type =
+            //! \ogs_file_param{prj__time_loop__processes__process__predictor}
+            pcs_config.getConfigParameterOptional<std::string>("predictor");
+
         per_process_data.emplace_back(makeSingleProcessData(
             nl_slv, pcs, std::move(time_disc), std::move(conv_crit),
             std::move(coupled_processes), std::move(process_output)));
+
+        if (predictor_type)
+        {
+            per_process_data.back()->predictor.reset(
+                new NumLib::SolutionPredictor(
+                    NumLib::convertStringToPredictorType(*predictor_type)));
+        }
     }
 
     if (per_process_data.size() != processes.size())
@@ -360,6 +389,7 @@ std::unique_ptr<UncoupledProcessesTimeLoop> createUncoupledProcessesTimeLoop(
         = config.getConfigSubtreeOptional("global_process_coupling");
 
     std::unique_ptr<NumLib::ConvergenceCriterion> coupling_conv_crit = nullptr;
+    std::unique_ptr<NumLib::FixedPointAccelerator> coupling_accelerator;
     unsigned max_coupling_iterations = 1;
     if (coupling_config)
     {
@@ -369,8 +399,20 @@ std::unique_ptr<UncoupledProcessesTimeLoop> createUncoupledProcessesTimeLoop(
         coupling_conv_crit = NumLib::createConvergenceCriterion(
             //! \ogs_file_param{prj__time_loop__global_process_coupling__convergence_criterion}
             coupling_config->getConfigSubtree("convergence_criterion"));
+
+        //! \ogs_file_param{prj__time_loop__global_process_coupling__acceleration}
+        if (auto const acceleration_config =
+                coupling_config->getConfigSubtreeOptional("acceleration"))
+        {
+            coupling_accelerator =
+                NumLib::createFixedPointAccelerator(*acceleration_config);
+        }
     }
 
+    auto const concurrent_processes =
+        //! \ogs_file_param{prj__time_loop__concurrent_processes}
+        config.getConfigParameter<bool>("concurrent_processes", false);
+
     auto timestepper =
         //! \ogs_file_param{prj__time_loop__time_stepping}
         createTimeStepper(config.getConfigSubtree("time_stepping"));
@@ -383,11 +425,30 @@ std::unique_ptr<UncoupledProcessesTimeLoop> createUncoupledProcessesTimeLoop(
         //! \ogs_file_param{prj__time_loop__processes}
         config.getConfigSubtree("processes"), processes, nonlinear_solvers);
 
+    if (dynamic_cast<NumLib::PIControlledTimeStepping*>(timestepper.get()))
+    {
+        for (auto const& spd : per_process_data)
+        {
+            // A rejected timestep is repeated after restoring the solution
+            // only.
+            if (spd->process.hasIntegrationPointHistory())
+                OGS_FATAL(
+                    "The PIControlledTimeStepping cannot be used for "
+                    "processes keeping a state at the integration points.");
+            if (!spd->time_disc->providesErrorEstimate())
+                OGS_FATAL(
+                    "The PIControlledTimeStepping needs a time "
+                    "discretization providing an error estimate, e.g., the "
+                    "VariableStepBDF.");
+        }
+    }
+
     return std::unique_ptr<UncoupledProcessesTimeLoop>{
         new UncoupledProcessesTimeLoop{
             std::move(timestepper), std::move(output),
             std::move(per_process_data), max_coupling_iterations,
-            std::move(coupling_conv_crit)}};
+            std::move(coupling_conv_crit), std::move(coupling_accelerator),
+            concurrent_processes}};
 }
 
 std::vector<GlobalVector*> setInitialConditions(
@@ -416,6 +477,9 @@ std::vector<GlobalVector*> setInitialConditions(
 
         time_disc.setInitialState(t0, x0);  // push IC
 
+        if (spd->predictor && !spd->predictor->needsXdot())
+            spd->predictor->pushSolution(t0, x0);
+
         if (time_disc.needsPreload())
         {
             auto& nonlinear_solver = spd->nonlinear_solver;
@@ -435,11 +499,15 @@ std::vector<GlobalVector*> setInitialConditions(
     return process_solutions;
 }
 
+//! Solves one process in the timestep. The \c x is replaced by the prediction
+//! of the process' predictor, if any, only if \c predict is set, i.e., in the
+//! first coupling iteration of the timestep.
 bool solveOneTimeStepOneProcess(GlobalVector& x, std::size_t const timestep,
                                 double const t, double const delta_t,
                                 SingleProcessData& process_data,
                                 StaggeredCouplingTerm const& coupling_term,
-                                Output const& output_control)
+                                Output const& output_control,
+                                bool const predict)
 {
     auto& process = process_data.process;
     auto& time_disc = *process_data.time_disc;
@@ -457,6 +525,10 @@ bool solveOneTimeStepOneProcess(GlobalVector& x, std::size_t const timestep,
 
     time_disc.nextTimestep(t, delta_t);
 
+    auto* const predictor = process_data.predictor.get();
+    if (predictor && predict)
+        predictor->predict(t, x);
+
     applyKnownSolutions(ode_sys, nl_tag, x);
 
     auto const post_iteration_callback = [&](unsigned iteration,
@@ -465,13 +537,82 @@ bool solveOneTimeStepOneProcess(GlobalVector& x, std::size_t const timestep,
             process, process_data.process_output, timestep, t, x, iteration);
     };
 
-    bool nonlinear_solver_succeeded =
-        nonlinear_solver.solve(x, coupling_term, post_iteration_callback);
+    return nonlinear_solver.solve(x, coupling_term, post_iteration_callback);
+}
+
+//! Advances the time discretization and the predictor of the given process to
+//! the accepted solution \c x at time \c t.
+static void acceptTimestepOneProcess(double const t, GlobalVector const& x,
+                                     SingleProcessData& process_data)
+{
+    auto& time_disc = *process_data.time_disc;
+
+    if (auto* const predictor = process_data.predictor.get())
+    {
+        if (predictor->needsXdot())
+        {
+            // The time derivative has to be computed before the time
+            // discretization's state is advanced.
+            auto& xdot = NumLib::GlobalVectorProvider::provider.getVector(x);
+            time_disc.getXdot(x, xdot);
+            predictor->pushSolution(t, x, &xdot);
+            NumLib::GlobalVectorProvider::provider.releaseVector(xdot);
+        }
+        else
+        {
+            predictor->pushSolution(t, x);
+        }
+    }
 
     auto& mat_strg = *process_data.mat_strg;
     time_disc.pushState(t, x, mat_strg);
+}
 
-    return nonlinear_solver_succeeded;
+//! Checks if the given processes can be solved concurrently, i.e., that they
+//! are independent of each other and do not share nonlinear or linear solvers.
+static bool canSolveProcessesConcurrently(
+    std::vector<std::unique_ptr<SingleProcessData>> const& per_process_data,
+    Output const& output)
+{
+#ifdef USE_PETSC
+    (void)per_process_data;
+    (void)output;
+    WARN(
+        "Concurrent solution of processes is not supported with PETSc. The "
+        "processes will be solved one after another.");
+    return false;
+#else
+    if (output.isOutputNonlinearIterationResults())
+    {
+        WARN(
+            "The results of the nonlinear iterations are written. The "
+            "processes will be solved one after another.");
+        return false;
+    }
+
+    std::set<NumLib::NonlinearSolverBase const*> nonlinear_solvers;
+    std::set<GlobalLinearSolver const*> linear_solvers;
+    for (auto const& spd : per_process_data)
+    {
+        if (!spd->coupled_processes.empty())
+        {
+            WARN(
+                "The processes are coupled. They will be solved one after "
+                "another.");
+            return false;
+        }
+        auto const& nonlinear_solver = spd->nonlinear_solver;
+        if (!nonlinear_solvers.insert(&nonlinear_solver).second ||
+            !linear_solvers.insert(&nonlinear_solver.getLinearSolver()).second)
+        {
+            WARN(
+                "Some processes share a nonlinear or linear solver. The "
+                "processes will be solved one after another.");
+            return false;
+        }
+    }
+    return true;
+#endif
 }
 
 UncoupledProcessesTimeLoop::UncoupledProcessesTimeLoop(
@@ -479,12 +620,19 @@ UncoupledProcessesTimeLoop::UncoupledProcessesTimeLoop(
     std::unique_ptr<Output>&& output,
     std::vector<std::unique_ptr<SingleProcessData>>&& per_process_data,
     const unsigned global_coupling_max_iterations,
-    std::unique_ptr<NumLib::ConvergenceCriterion>&& global_coupling_conv_crit)
+    std::unique_ptr<NumLib::ConvergenceCriterion>&& global_coupling_conv_crit,
+    std::unique_ptr<NumLib::FixedPointAccelerator>&&
+        global_coupling_accelerator,
+    bool const concurrent_processes)
     : _timestepper{std::move(timestepper)},
       _output(std::move(output)),
       _per_process_data(std::move(per_process_data)),
       _global_coupling_max_iterations(global_coupling_max_iterations),
-      _global_coupling_conv_crit(std::move(global_coupling_conv_crit))
+      _global_coupling_conv_crit(std::move(global_coupling_conv_crit)),
+      _global_coupling_accelerator(std::move(global_coupling_accelerator)),
+      _concurrent_processes(concurrent_processes &&
+                            canSolveProcessesConcurrently(_per_process_data,
+                                                          *_output))
 {
 }
 
@@ -595,6 +743,17 @@ bool UncoupledProcessesTimeLoop::loop()
 
     const bool is_staggered_coupling = setCoupledSolutions();
 
+    // Free temporaries of the initialization.
+    NumLib::shrinkGlobalMatrixProviders();
+
+    if (is_staggered_coupling &&
+        dynamic_cast<NumLib::PIControlledTimeStepping*>(_timestepper.get()))
+    {
+        OGS_FATAL(
+            "The PIControlledTimeStepping is not supported by the staggered "
+            "scheme.");
+    }
+
     double t = t0;
     std::size_t timestep = 1;  // the first timestep really is number one
     bool nonlinear_solver_succeeded = true;
@@ -648,30 +807,62 @@ bool UncoupledProcessesTimeLoop::loop()
 bool UncoupledProcessesTimeLoop::solveUncoupledEquationSystems(
     const double t, const double dt, const std::size_t timestep_id)
 {
-    // TODO use process name
-    unsigned pcs_idx = 0;
-    for (auto& spd : _per_process_data)
+    const auto void_staggered_coupling_term =
+        ProcessLib::createVoidStaggeredCouplingTerm();
+
+    auto* const error_controller =
+        dynamic_cast<NumLib::PIControlledTimeStepping*>(_timestepper.get());
+    if (error_controller)
     {
-        auto& pcs = spd->process;
+        // Keep the solutions of the last timestep in case the timestep is
+        // rejected.
+        if (_solutions_of_last_timestep.empty())
+        {
+            for (auto const* x : _process_solutions)
+                _solutions_of_last_timestep.push_back(
+                    &NumLib::GlobalVectorProvider::provider.getVector(*x));
+        }
+        for (std::size_t i = 0; i < _process_solutions.size(); ++i)
+            MathLib::LinAlg::copy(*_process_solutions[i],
+                                  *_solutions_of_last_timestep[i]);
+    }
+
+    auto const preTimestep = [&](unsigned const pcs_idx) {
+        _per_process_data[pcs_idx]->process.preTimestep(
+            *_process_solutions[pcs_idx], t, dt);
+    };
+
+    // Solve the processes; char instead of bool allows concurrent writes.
+    std::vector<char> nonlinear_solver_succeeded(_per_process_data.size(),
+                                                 false);
+    auto const solve = [&](unsigned const pcs_idx) {
+        // TODO use process name
         BaseLib::RunTime time_timestep_process;
         time_timestep_process.start();
 
+        nonlinear_solver_succeeded[pcs_idx] = solveOneTimeStepOneProcess(
+            *_process_solutions[pcs_idx], timestep_id, t, dt,
+            *_per_process_data[pcs_idx], void_staggered_coupling_term,
+            *_output, true);
+
+        INFO("[time] Solving process #%u took %g s in time step #%u ", pcs_idx,
+             time_timestep_process.elapsed(), timestep_id);
+    };
+
+    // Post-processing and output of a solved process. Returns false if its
+    // nonlinear solver failed.
+    auto const postTimestep = [&](unsigned const pcs_idx) -> bool {
+        auto& spd = _per_process_data[pcs_idx];
+        auto& pcs = spd->process;
         auto& x = *_process_solutions[pcs_idx];
-        pcs.preTimestep(x, t, dt);
 
-        const auto void_staggered_coupling_term =
-            ProcessLib::createVoidStaggeredCouplingTerm();
+        if (nonlinear_solver_succeeded[pcs_idx])
+            acceptTimestepOneProcess(t, x, *spd);
 
-        const auto nonlinear_solver_succeeded =
-            solveOneTimeStepOneProcess(x, timestep_id, t, dt, *spd,
-                                       void_staggered_coupling_term, *_output);
         pcs.postTimestep(x);
         pcs.computeSecondaryVariable(t, x, void_staggered_coupling_term);
 
-        INFO("[time] Solving process #%u took %g s in time step #%u ", pcs_idx,
-             time_timestep_process.elapsed(), timestep_id);
-
-        if (!nonlinear_solver_succeeded)
+        if (!nonlinear_solver_succeeded[pcs_idx])
         {
             ERR("The nonlinear solver failed in time step #%u at t = %g "
                 "s for process #%u.",
@@ -683,13 +874,107 @@ bool UncoupledProcessesTimeLoop::solveUncoupledEquationSystems(
 
             return false;
         }
-        else
+
+        _output->doOutput(pcs, spd->process_output, timestep_id, t, x);
+        return true;
+    };
+
+    if (!_concurrent_processes && !error_controller)
+    {
+        for (unsigned pcs_idx = 0; pcs_idx < _per_process_data.size();
+             ++pcs_idx)
         {
-            _output->doOutput(pcs, spd->process_output, timestep_id, t, x);
+            preTimestep(pcs_idx);
+            solve(pcs_idx);
+            if (!postTimestep(pcs_idx))
+                return false;
         }
+        return true;
+    }
 
-        ++pcs_idx;
-    }  // end of for (auto& spd : _per_process_data)
+    // The processes are solved before any of them is post-processed, either
+    // concurrently or, if the timestep might be rejected, one after another
+    // up to the first failure.
+    std::size_t n_solved = _per_process_data.size();
+    if (_concurrent_processes)
+    {
+        for (unsigned pcs_idx = 0; pcs_idx < _per_process_data.size();
+             ++pcs_idx)
+            preTimestep(pcs_idx);
+
+        // Errors of the processes are raised after the parallel loop.
+        BaseLib::FirstException first_exception;
+        OPENMP_LOOP_TYPE const n_processes = _per_process_data.size();
+#pragma omp parallel for schedule(dynamic)
+        for (OPENMP_LOOP_TYPE pcs_idx = 0; pcs_idx < n_processes; ++pcs_idx)
+            first_exception.run([&solve, pcs_idx] { solve(pcs_idx); });
+        first_exception.rethrow();
+    }
+    else
+    {
+        for (unsigned pcs_idx = 0; pcs_idx < _per_process_data.size();
+             ++pcs_idx)
+        {
+            preTimestep(pcs_idx);
+            solve(pcs_idx);
+            if (!nonlinear_solver_succeeded[pcs_idx])
+            {
+                n_solved = pcs_idx + 1;
+                break;
+            }
+        }
+    }
+
+    bool const all_solved =
+        n_solved == _per_process_data.size() &&
+        std::all_of(nonlinear_solver_succeeded.begin(),
+                    nonlinear_solver_succeeded.end(),
+                    [](char const succeeded) { return succeeded; });
+
+    if (error_controller && all_solved)
+    {
+        // The largest scaled local error of all processes providing an
+        // estimate decides on the acceptance of the timestep.
+        double max_error = -1.0;
+        unsigned order = std::numeric_limits<unsigned>::max();
+        for (unsigned pcs_idx = 0; pcs_idx < _per_process_data.size();
+             ++pcs_idx)
+        {
+            auto const& time_disc = *_per_process_data[pcs_idx]->time_disc;
+            auto const& x = *_process_solutions[pcs_idx];
+            auto& error = NumLib::GlobalVectorProvider::provider.getVector(x);
+            if (time_disc.getErrorEstimate(x, error))
+            {
+                max_error = std::max(
+                    max_error, error_controller->computeScaledError(x, error));
+                order = std::min(order, time_disc.getOrder());
+            }
+            NumLib::GlobalVectorProvider::provider.releaseVector(error);
+        }
+
+        if (max_error >= 0.0)
+        {
+            error_controller->setError(max_error, order);
+            INFO("Scaled local error estimate: %g.", max_error);
+        }
+
+        if (!error_controller->accepted())
+        {
+            INFO("Time step #%u at t = %g s is rejected and will be repeated.",
+                 timestep_id, t);
+            for (std::size_t i = 0; i < _process_solutions.size(); ++i)
+                MathLib::LinAlg::copy(*_solutions_of_last_timestep[i],
+                                      *_process_solutions[i]);
+            return true;
+        }
+    }
+
+    // Post-processing and output in the order of the processes.
+    for (unsigned pcs_idx = 0; pcs_idx < n_solved; ++pcs_idx)
+    {
+        if (!postTimestep(pcs_idx))
+            return false;
+    }
 
     return true;
 }
@@ -697,14 +982,18 @@ bool UncoupledProcessesTimeLoop::solveUncoupledEquationSystems(
 bool UncoupledProcessesTimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
     const double t, const double dt, const std::size_t timestep_id)
 {
+    if (_global_coupling_accelerator)
+        _global_coupling_accelerator->reset();
+
     // Coupling iteration
-    bool coupling_iteration_converged = true;
+    bool coupling_iteration_converged = false;
     for (unsigned global_coupling_iteration = 0;
          global_coupling_iteration < _global_coupling_max_iterations;
          global_coupling_iteration++)
     {
         // TODO use process name
         bool nonlinear_solver_succeeded = true;
+        coupling_iteration_converged = true;
         unsigned pcs_idx = 0;
         for (auto& spd : _per_process_data)
         {
@@ -713,6 +1002,8 @@ bool UncoupledProcessesTimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
             time_timestep_process.start();
 
             auto& x = *_process_solutions[pcs_idx];
+            auto& x_old = *_solutions_of_last_cpl_iteration[pcs_idx];
+            _global_coupling_conv_crit->reset();
             if (global_coupling_iteration == 0)
             {
                 // Copy the solution of the previous time step to a vector that
@@ -721,6 +1012,10 @@ bool UncoupledProcessesTimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
                 // required for the coupling computation.
                 pcs.preTimestep(x, t, dt);
 
+                // The solution of the previous time step is the first iterate
+                // of the coupling iteration.
+                MathLib::LinAlg::copy(x, x_old);
+
                 // Set the flag of the first iteration be true.
                 _global_coupling_conv_crit->preFirstIteration();
             }
@@ -733,8 +1028,13 @@ bool UncoupledProcessesTimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
                 spd->coupled_processes,
                 _solutions_of_coupled_processes[pcs_idx], dt);
 
-            const auto nonlinear_solver_succeeded = solveOneTimeStepOneProcess(
-                x, timestep_id, t, dt, *spd, coupling_term, *_output);
+            // Later coupling iterations start from the (accelerated) iterate
+            // of the preceding one.
+            nonlinear_solver_succeeded = solveOneTimeStepOneProcess(
+                x, timestep_id, t, dt, *spd, coupling_term, *_output,
+                global_coupling_iteration == 0);
+            if (nonlinear_solver_succeeded)
+                acceptTimestepOneProcess(t, x, *spd);
 
             INFO(
                 "[time] Solving process #%u took %g s in time step #%u "
@@ -756,28 +1056,37 @@ bool UncoupledProcessesTimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
                 break;
             }
 
-            // Check the convergence of the coupling iteration
-            auto& x_old = *_solutions_of_last_cpl_iteration[pcs_idx];
-            MathLib::LinAlg::axpy(x_old, -1.0, x);
+            // Check the convergence of the coupling iteration. x_old becomes
+            // the residual of the coupling iteration.
+            MathLib::LinAlg::aypx(x_old, -1.0, x);
             _global_coupling_conv_crit->checkResidual(x_old);
             coupling_iteration_converged =
                 coupling_iteration_converged &&
                 _global_coupling_conv_crit->isSatisfied();
 
-            if (coupling_iteration_converged)
-                break;
-            MathLib::LinAlg::copy(x, x_old);
-
             ++pcs_idx;
         }  // end of for (auto& spd : _per_process_data)
 
+        if (!nonlinear_solver_succeeded)
+        {
+            return false;
+        }
+
         if (coupling_iteration_converged)
             break;
 
-        if (!nonlinear_solver_succeeded)
+        if (_global_coupling_accelerator)
         {
-            return false;
+            std::vector<GlobalVector const*> const residuals(
+                _solutions_of_last_cpl_iteration.begin(),
+                _solutions_of_last_cpl_iteration.end());
+            _global_coupling_accelerator->accelerate(_process_solutions,
+                                                     residuals);
         }
+
+        for (std::size_t i = 0; i < _process_solutions.size(); ++i)
+            MathLib::LinAlg::copy(*_process_solutions[i],
+                                  *_solutions_of_last_cpl_iteration[i]);
     }
 
     if (!coupling_iteration_converged)
@@ -814,6 +1123,9 @@ UncoupledProcessesTimeLoop::~UncoupledProcessesTimeLoop()
 
     for (auto* x : _solutions_of_last_cpl_iteration)
         NumLib::GlobalVectorProvider::provider.releaseVector(*x);
+
+    for (auto* x : _solutions_of_last_timestep)
+        NumLib::GlobalVectorProvider::provider.releaseVector(*x);
 }
 
 }  // namespace ProcessLib
@@ -25,6 +25,7 @@
 namespace NumLib
 {
 class ConvergenceCriterion;
+class FixedPointAccelerator;
 }
 
 namespace ProcessLib
@@ -43,7 +44,10 @@ public:
         std::vector<std::unique_ptr<SingleProcessData>>&& per_process_data,
         const unsigned global_coupling_max_iterations,
         std::unique_ptr<NumLib::ConvergenceCriterion>&&
-            global_coupling_conv_crit);
+            global_coupling_conv_crit,
+        std::unique_ptr<NumLib::FixedPointAccelerator>&&
+            global_coupling_accelerator,
+        bool const concurrent_processes);
 
     bool loop();
 
@@ -71,6 +75,12 @@ private:
     const unsigned _global_coupling_max_iterations;
     /// Convergence criteria of the global coupling iterations.
     std::unique_ptr<NumLib::ConvergenceCriterion> _global_coupling_conv_crit;
+    /// Optional acceleration of the global coupling iterations.
+    std::unique_ptr<NumLib::FixedPointAccelerator> _global_coupling_accelerator;
+
+    /// Solve the uncoupled processes concurrently. Their post-processing and
+    /// output is still done one after another in the order of the processes.
+    bool const _concurrent_processes;
 
     /**
      *  Vector of solutions of coupled processes of processes.
@@ -84,6 +94,10 @@ private:
     /// criteria of the coupling iteration.
     std::vector<GlobalVector*> _solutions_of_last_cpl_iteration;
 
+    /// Solutions of the last accepted time step, which are restored if a time
+    /// step is rejected by the error-controlled time stepping.
+    std::vector<GlobalVector*> _solutions_of_last_timestep;
+
     /**
      * \brief Member to solver non coupled systems of equations, which can be
      *        a single system of equations, or several systems of equations
@@ -0,0 +1,70 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "BaseLib/PerThread.h"
+#include "MeshLib/Elements/Element.h"
+#include "NumLib/NumericsConfig.h"
+
+namespace ProcessLib
+{
+namespace detail
+{
+/// Creates the local assemblers of all \c mesh_elements by calling the
+/// \c initializer for each of them.
+///
+/// If \c concurrent is set, the elements are processed by OpenMP threads, each
+/// of which constructs one contiguous range of elements in ascending order.
+/// Since local assemblers are allocated from per-thread pools, their order in
+/// memory follows the element order within each range. Each local assembler is
+/// computed from its own element only, hence the result does not depend on the
+/// number of threads. The first error of the threads is rethrown by the calling
+/// thread.
+///
+/// \note For concurrent construction the constructors of the local assemblers
+/// and the parameters they evaluate must not modify shared data. Processes opt
+/// in with their \c concurrent_assembly setting.
+template <typename LocalDataInitializer, typename LocalAssemblerInterface,
+          typename... ExtraCtorArgs>
+void constructLocalAssemblers(
+    LocalDataInitializer const& initializer,
+    std::vector<MeshLib::Element*> const& mesh_elements,
+    std::vector<std::unique_ptr<LocalAssemblerInterface>>& local_assemblers,
+    bool const concurrent,
+    ExtraCtorArgs&&... extra_ctor_args)
+{
+    local_assemblers.resize(mesh_elements.size());
+
+    if (!concurrent)
+    {
+        GlobalExecutor::transformDereferenced(
+            initializer, mesh_elements, local_assemblers,
+            std::forward<ExtraCtorArgs>(extra_ctor_args)...);
+        return;
+    }
+
+    BaseLib::FirstException first_exception;
+    OPENMP_LOOP_TYPE const n_elements = mesh_elements.size();
+#pragma omp parallel for schedule(static)
+    for (OPENMP_LOOP_TYPE i = 0; i < n_elements; ++i)
+    {
+        first_exception.run([&] {
+            initializer(i, *mesh_elements[i], local_assemblers[i],
+                        std::forward<ExtraCtorArgs>(extra_ctor_args)...);
+        });
+    }
+    first_exception.rethrow();
+}
+
+}  // namespace detail
+}  // namespace ProcessLib
@@ -14,6 +14,7 @@
 
 #include "NumLib/DOF/LocalToGlobalIndexMap.h"
 
+#include "ConstructLocalAssemblers.h"
 #include "LocalDataInitializer.h"
 
 
@@ -30,6 +31,7 @@ void createLocalAssemblers(
     const unsigned shapefunction_order,
     std::vector<MeshLib::Element*> const& mesh_elements,
     std::vector<std::unique_ptr<LocalAssemblerInterface>>& local_assemblers,
+    bool const concurrent,
     ExtraCtorArgs&&... extra_ctor_args)
 {
     // Shape matrices initializer
@@ -39,14 +41,11 @@ void createLocalAssemblers(
                              ExtraCtorArgs...>;
 
     DBUG("Create local assemblers.");
-    // Populate the vector of local assemblers.
-    local_assemblers.resize(mesh_elements.size());
-
     LocalDataInitializer initializer(dof_table, shapefunction_order);
 
     DBUG("Calling local assembler builder for all mesh elements.");
-    GlobalExecutor::transformDereferenced(
-        initializer, mesh_elements, local_assemblers,
+    ProcessLib::detail::constructLocalAssemblers(
+        initializer, mesh_elements, local_assemblers, concurrent,
         std::forward<ExtraCtorArgs>(extra_ctor_args)...);
 }
 
@@ -60,6 +59,9 @@ void createLocalAssemblers(
  *         Those arguments will be passed to the constructor of
  *         \c LocalAssemblerImplementation.
  *
+ * If \c concurrent is set, the local assemblers are constructed by OpenMP
+ * threads, see detail::constructLocalAssemblers().
+ *
  * The first two template parameters cannot be deduced from the arguments.
  * Therefore they always have to be provided manually.
  */
@@ -72,6 +74,7 @@ void createLocalAssemblers(
     NumLib::LocalToGlobalIndexMap const& dof_table,
     const unsigned shapefunction_order,
     std::vector<std::unique_ptr<LocalAssemblerInterface>>& local_assemblers,
+    bool const concurrent,
     ExtraCtorArgs&&... extra_ctor_args)
 {
     DBUG("Create local assemblers.");
@@ -81,17 +84,17 @@ void createLocalAssemblers(
         case 1:
             detail::createLocalAssemblers<1, LocalAssemblerImplementation>(
                 dof_table, shapefunction_order, mesh_elements, local_assemblers,
-                std::forward<ExtraCtorArgs>(extra_ctor_args)...);
+                concurrent, std::forward<ExtraCtorArgs>(extra_ctor_args)...);
             break;
         case 2:
             detail::createLocalAssemblers<2, LocalAssemblerImplementation>(
                 dof_table, shapefunction_order, mesh_elements, local_assemblers,
-                std::forward<ExtraCtorArgs>(extra_ctor_args)...);
+                concurrent, std::forward<ExtraCtorArgs>(extra_ctor_args)...);
             break;
         case 3:
             detail::createLocalAssemblers<3, LocalAssemblerImplementation>(
                 dof_table, shapefunction_order, mesh_elements, local_assemblers,
-                std::forward<ExtraCtorArgs>(extra_ctor_args)...);
+                concurrent, std::forward<ExtraCtorArgs>(extra_ctor_args)...);
             break;
         default:
             OGS_FATAL(
@@ -19,40 +19,11 @@
 
 namespace ProcessLib
 {
-static std::unordered_map<std::type_index, const std::vector<double>>
-getPreviousLocalSolutionsOfCoupledProcesses(
-    const StaggeredCouplingTerm& coupling_term,
-    const std::vector<GlobalIndexType>& indices)
-{
-    std::unordered_map<std::type_index, const std::vector<double>>
-        local_coupled_xs0;
-
-    for (auto const& coupled_process_pair : coupling_term.coupled_processes)
-    {
-        auto const& coupled_pcs = coupled_process_pair.second;
-        auto const prevous_time_x = coupled_pcs.getPreviousTimeStepSolution();
-        if (prevous_time_x)
-        {
-            auto const local_coupled_x0 = prevous_time_x->get(indices);
-            BaseLib::insertIfTypeIndexKeyUniqueElseError(
-                local_coupled_xs0, coupled_process_pair.first, local_coupled_x0,
-                "local_coupled_x0");
-        }
-        else
-        {
-            const std::vector<double> local_coupled_x0;
-            BaseLib::insertIfTypeIndexKeyUniqueElseError(
-                local_coupled_xs0, coupled_process_pair.first, local_coupled_x0,
-                "local_coupled_x0");
-        }
-    }
-    return local_coupled_xs0;
-}
-
 VectorMatrixAssembler::VectorMatrixAssembler(
     std::unique_ptr<AbstractJacobianAssembler>&& jacobian_assembler)
-    : _jacobian_assembler(std::move(jacobian_assembler))
 {
+    for (auto& d : _thread_data)
+        d.jacobian_assembler = jacobian_assembler->copy();
 }
 
 void VectorMatrixAssembler::assemble(
@@ -61,51 +32,60 @@ void VectorMatrixAssembler::assemble(
     const GlobalVector& x, GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b,
     const StaggeredCouplingTerm& coupling_term)
 {
+    auto& d = _thread_data.get();
     auto const indices = NumLib::getIndices(mesh_item_id, dof_table);
-    auto const local_x = x.get(indices);
+    x.get(indices, d.local_x_data);
+    auto const& local_x = d.local_x_data;
 
-    _local_M_data.clear();
-    _local_K_data.clear();
-    _local_b_data.clear();
+    d.local_M_data.clear();
+    d.local_K_data.clear();
+    d.local_b_data.clear();
 
     if (coupling_term.empty)
     {
-        local_assembler.assemble(t, local_x, _local_M_data, _local_K_data,
-                                 _local_b_data);
+        local_assembler.assemble(t, local_x, d.local_M_data, d.local_K_data,
+                                 d.local_b_data);
     }
     else
     {
-        auto local_coupled_xs0 =
-            getPreviousLocalSolutionsOfCoupledProcesses(coupling_term, indices);
-        auto local_coupled_xs = getCurrentLocalSolutionsOfCoupledProcesses(
-            coupling_term.coupled_xs, indices);
+        gatherLocalCoupledSolutions(coupling_term, indices, d);
         ProcessLib::LocalCouplingTerm local_coupling_term(
-            coupling_term.dt, coupling_term.coupled_processes,
-            std::move(local_coupled_xs0), std::move(local_coupled_xs));
+            coupling_term.dt, coupling_term.coupled_process_slots,
+            d.local_coupled_xs0, d.local_coupled_xs);
 
-        local_assembler.assembleWithCoupledTerm(t, local_x, _local_M_data,
-                                          _local_K_data, _local_b_data,
+        local_assembler.assembleWithCoupledTerm(t, local_x, d.local_M_data,
+                                          d.local_K_data, d.local_b_data,
                                           local_coupling_term);
     }
 
+    if (_time_discretized_assembly)
+        applyTimeDiscretization(indices, d);
+
     auto const num_r_c = indices.size();
     auto const r_c_indices =
         NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices);
 
-    if (!_local_M_data.empty())
-    {
-        auto const local_M = MathLib::toMatrix(_local_M_data, num_r_c, num_r_c);
-        M.add(r_c_indices, local_M);
-    }
-    if (!_local_K_data.empty())
-    {
-        auto const local_K = MathLib::toMatrix(_local_K_data, num_r_c, num_r_c);
-        K.add(r_c_indices, local_K);
-    }
-    if (!_local_b_data.empty())
+    // The global matrices and vectors are not thread-safe, hence the element
+    // contributions of concurrent assemblies are added one at a time.
+#pragma omp critical(ogs_global_assembly)
     {
-        assert(_local_b_data.size() == num_r_c);
-        b.add(indices, _local_b_data);
+        if (!d.local_M_data.empty())
+        {
+            auto const local_M =
+                MathLib::toMatrix(d.local_M_data, num_r_c, num_r_c);
+            M.add(r_c_indices, local_M);
+        }
+        if (!d.local_K_data.empty())
+        {
+            auto const local_K =
+                MathLib::toMatrix(d.local_K_data, num_r_c, num_r_c);
+            K.add(r_c_indices, local_K);
+        }
+        if (!d.local_b_data.empty())
+        {
+            assert(d.local_b_data.size() == num_r_c);
+            b.add(indices, d.local_b_data);
+        }
     }
 }
 
@@ -116,68 +96,160 @@ void VectorMatrixAssembler::assembleWithJacobian(
     const double dx_dx, GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b,
     GlobalMatrix& Jac, const StaggeredCouplingTerm& coupling_term)
 {
+    auto& d = _thread_data.get();
     auto const indices = NumLib::getIndices(mesh_item_id, dof_table);
-    auto const local_x = x.get(indices);
-    auto const local_xdot = xdot.get(indices);
+    x.get(indices, d.local_x_data);
+    xdot.get(indices, d.local_xdot_data);
+    auto const& local_x = d.local_x_data;
+    auto const& local_xdot = d.local_xdot_data;
 
-    _local_M_data.clear();
-    _local_K_data.clear();
-    _local_b_data.clear();
-    _local_Jac_data.clear();
+    d.local_M_data.clear();
+    d.local_K_data.clear();
+    d.local_b_data.clear();
+    d.local_Jac_data.clear();
 
     if (coupling_term.empty)
     {
-        _jacobian_assembler->assembleWithJacobian(
+        d.jacobian_assembler->assembleWithJacobian(
             local_assembler, t, local_x, local_xdot, dxdot_dx, dx_dx,
-            _local_M_data, _local_K_data, _local_b_data, _local_Jac_data);
+            d.local_M_data, d.local_K_data, d.local_b_data, d.local_Jac_data);
     }
     else
     {
-        auto local_coupled_xs0 =
-            getPreviousLocalSolutionsOfCoupledProcesses(coupling_term, indices);
-        auto local_coupled_xs = getCurrentLocalSolutionsOfCoupledProcesses(
-            coupling_term.coupled_xs, indices);
+        gatherLocalCoupledSolutions(coupling_term, indices, d);
         ProcessLib::LocalCouplingTerm local_coupling_term(
-            coupling_term.dt, coupling_term.coupled_processes,
-            std::move(local_coupled_xs0), std::move(local_coupled_xs));
+            coupling_term.dt, coupling_term.coupled_process_slots,
+            d.local_coupled_xs0, d.local_coupled_xs);
 
-        _jacobian_assembler->assembleWithJacobianAndCouping(
+        d.jacobian_assembler->assembleWithJacobianAndCouping(
             local_assembler, t, local_x, local_xdot, dxdot_dx, dx_dx,
-            _local_M_data, _local_K_data, _local_b_data, _local_Jac_data,
+            d.local_M_data, d.local_K_data, d.local_b_data, d.local_Jac_data,
             local_coupling_term);
     }
 
+    if (_time_discretized_assembly)
+        computeLocalResidual(local_x, local_xdot, d);
+
     auto const num_r_c = indices.size();
     auto const r_c_indices =
         NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices);
 
-    if (!_local_M_data.empty())
+    if (d.local_Jac_data.empty())
     {
-        auto const local_M = MathLib::toMatrix(_local_M_data, num_r_c, num_r_c);
-        M.add(r_c_indices, local_M);
+        OGS_FATAL(
+            "No Jacobian has been assembled! This might be due to programming "
+            "errors in the local assembler of the current process.");
+    }
+
+    // The global matrices and vectors are not thread-safe, hence the element
+    // contributions of concurrent assemblies are added one at a time.
+#pragma omp critical(ogs_global_assembly)
+    {
+        if (!d.local_M_data.empty())
+        {
+            auto const local_M =
+                MathLib::toMatrix(d.local_M_data, num_r_c, num_r_c);
+            M.add(r_c_indices, local_M);
+        }
+        if (!d.local_K_data.empty())
+        {
+            auto const local_K =
+                MathLib::toMatrix(d.local_K_data, num_r_c, num_r_c);
+            K.add(r_c_indices, local_K);
+        }
+        if (!d.local_b_data.empty())
+        {
+            assert(d.local_b_data.size() == num_r_c);
+            b.add(indices, d.local_b_data);
+        }
+        auto const local_Jac =
+            MathLib::toMatrix(d.local_Jac_data, num_r_c, num_r_c);
+        Jac.add(r_c_indices, local_Jac);
     }
-    if (!_local_K_data.empty())
+}
+
+void VectorMatrixAssembler::gatherLocalCoupledSolutions(
+    StaggeredCouplingTerm const& coupling_term,
+    std::vector<GlobalIndexType> const& indices, ThreadData& d)
+{
+    auto const& slots = coupling_term.coupled_process_slots;
+    // The buffers only grow, their memory is reused for all elements.
+    if (d.local_coupled_xs.size() < slots.size())
     {
-        auto const local_K = MathLib::toMatrix(_local_K_data, num_r_c, num_r_c);
-        K.add(r_c_indices, local_K);
+        d.local_coupled_xs0.resize(slots.size());
+        d.local_coupled_xs.resize(slots.size());
     }
-    if (!_local_b_data.empty())
+
+    for (std::size_t slot = 0; slot < slots.size(); ++slot)
     {
-        assert(_local_b_data.size() == num_r_c);
-        b.add(indices, _local_b_data);
+        auto const& coupled = slots[slot];
+
+        auto const* const x0 = coupled.process.getPreviousTimeStepSolution();
+        if (x0)
+            x0->get(indices, d.local_coupled_xs0[slot]);
+        else
+            d.local_coupled_xs0[slot].clear();
+
+        if (!coupled.x)
+            OGS_FATAL("The solution of the coupled process %s is not known.",
+                      coupled.process_type.name());
+        coupled.x->get(indices, d.local_coupled_xs[slot]);
     }
-    if (!_local_Jac_data.empty())
+}
+
+void VectorMatrixAssembler::applyTimeDiscretization(
+    std::vector<GlobalIndexType> const& indices, ThreadData& d)
+{
+    if (d.local_M_data.empty())
+        return;
+
+    assert(_weighted_old_x);
+
+    auto const num_r_c = indices.size();
+    if (d.local_K_data.empty())
+        d.local_K_data.resize(num_r_c * num_r_c, 0.0);
+    if (d.local_b_data.empty())
+        d.local_b_data.resize(num_r_c, 0.0);
+
+    auto const local_M = MathLib::toMatrix(d.local_M_data, num_r_c, num_r_c);
+    auto local_A = MathLib::toMatrix(d.local_K_data, num_r_c, num_r_c);
+    auto local_rhs = MathLib::toVector(d.local_b_data);
+    _weighted_old_x->get(indices, d.local_weighted_old_x_data);
+    auto const& local_weighted_old_x = d.local_weighted_old_x_data;
+
+    // A_e = dxdot_dx * M_e + K_e, rhs_e = M_e * weighted_old_x_e + b_e
+    local_A.noalias() += _dxdot_dx * local_M;
+    local_rhs.noalias() += local_M * MathLib::toVector(local_weighted_old_x);
+
+    d.local_M_data.clear();
+}
+
+void VectorMatrixAssembler::computeLocalResidual(
+    std::vector<double> const& local_x, std::vector<double> const& local_xdot,
+    ThreadData& d)
+{
+    auto const num_r_c = local_x.size();
+    if (d.local_b_data.empty())
+        d.local_b_data.resize(num_r_c, 0.0);
+
+    // res_e = M_e * xdot_e + K_e * x_e - b_e
+    auto local_res = MathLib::toVector(d.local_b_data);
+    local_res = -local_res;
+    if (!d.local_M_data.empty())
     {
-        auto const local_Jac =
-            MathLib::toMatrix(_local_Jac_data, num_r_c, num_r_c);
-        Jac.add(r_c_indices, local_Jac);
+        local_res.noalias() +=
+            MathLib::toMatrix(d.local_M_data, num_r_c, num_r_c) *
+            MathLib::toVector(local_xdot);
     }
-    else
+    if (!d.local_K_data.empty())
     {
-        OGS_FATAL(
-            "No Jacobian has been assembled! This might be due to programming "
-            "errors in the local assembler of the current process.");
+        local_res.noalias() +=
+            MathLib::toMatrix(d.local_K_data, num_r_c, num_r_c) *
+            MathLib::toVector(local_x);
     }
+
+    d.local_M_data.clear();
+    d.local_K_data.clear();
 }
 
 }  // ProcessLib
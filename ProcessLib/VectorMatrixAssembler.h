@@ -10,6 +10,7 @@
 #pragma once
 
 #include <vector>
+#include "BaseLib/PerThread.h"
 #include "NumLib/NumericsConfig.h"
 #include "AbstractJacobianAssembler.h"
 #include "StaggeredCouplingTerm.h"
@@ -27,6 +28,10 @@ class LocalAssemblerInterface;
 //!
 //! The methods of this class get the global matrices and vectors as input and
 //! pass only local data on to the local assemblers.
+//!
+//! The assembly methods can be called concurrently from the threads of an
+//! OpenMP parallel region; each thread uses its own temporary data and
+//! Jacobian assembler.
 class VectorMatrixAssembler final
 {
 public:
@@ -54,16 +59,79 @@ public:
                               GlobalMatrix& Jac,
                               const StaggeredCouplingTerm& coupling_term);
 
+    //! Switches to the time discretized assembly mode, in which the time
+    //! discretization is applied to the element contributions before they
+    //! are added to the global objects:
+    //! - assemble() adds \f$ \mathtt{dxdot\_dx} \cdot M_e + K_e \f$ to \c K
+    //!   and \f$ M_e \cdot \mathtt{weighted\_old\_x}_e + b_e \f$ to \c b.
+    //! - assembleWithJacobian() adds the residual
+    //!   \f$ M_e \cdot \hat x_e + K_e \cdot x_e - b_e \f$ to \c b.
+    //!
+    //! In both cases \c M is not touched, and in the latter case \c K
+    //! neither.
+    //! \c weighted_old_x may be null if assemble() is not called.
+    void setTimeDiscretizedAssembly(double const dxdot_dx,
+                                    GlobalVector const* const weighted_old_x)
+    {
+        _time_discretized_assembly = true;
+        _dxdot_dx = dxdot_dx;
+        _weighted_old_x = weighted_old_x;
+    }
+
+    //! Switches back to the assembly of \c M, \c K and \c b.
+    void unsetTimeDiscretizedAssembly()
+    {
+        _time_discretized_assembly = false;
+        _weighted_old_x = nullptr;
+    }
+
 private:
-    // temporary data only stored here in order to avoid frequent memory
-    // reallocations.
-    std::vector<double> _local_M_data;
-    std::vector<double> _local_K_data;
-    std::vector<double> _local_b_data;
-    std::vector<double> _local_Jac_data;
-
-    //! Used to assemble the Jacobian.
-    std::unique_ptr<AbstractJacobianAssembler> _jacobian_assembler;
+    //! Temporary data of one thread, only stored here in order to avoid
+    //! frequent memory reallocations.
+    struct ThreadData
+    {
+        std::vector<double> local_M_data;
+        std::vector<double> local_K_data;
+        std::vector<double> local_b_data;
+        std::vector<double> local_Jac_data;
+
+        //! Local entries of the global vectors passed to the assembly.
+        std::vector<double> local_x_data;
+        std::vector<double> local_xdot_data;
+        std::vector<double> local_weighted_old_x_data;
+
+        //! Local solutions of the coupled processes at the previous and
+        //! current time step, indexed by the slots of the coupled processes.
+        std::vector<std::vector<double>> local_coupled_xs0;
+        std::vector<std::vector<double>> local_coupled_xs;
+
+        //! Used to assemble the Jacobian.
+        std::unique_ptr<AbstractJacobianAssembler> jacobian_assembler;
+    };
+
+    //! Writes the local solutions of the coupled processes to
+    //! ThreadData::local_coupled_xs0 and ThreadData::local_coupled_xs.
+    void gatherLocalCoupledSolutions(
+        StaggeredCouplingTerm const& coupling_term,
+        std::vector<GlobalIndexType> const& indices, ThreadData& d);
+
+    //! Moves \f$ \mathtt{dxdot\_dx} \cdot M_e \f$ to the local K data and
+    //! \f$ M_e \cdot \mathtt{weighted\_old\_x}_e \f$ to the local b data.
+    void applyTimeDiscretization(std::vector<GlobalIndexType> const& indices,
+                                 ThreadData& d);
+
+    //! Replaces the local b data by the local residual
+    //! \f$ M_e \cdot \hat x_e + K_e \cdot x_e - b_e \f$ and clears the
+    //! local M and K data.
+    void computeLocalResidual(std::vector<double> const& local_x,
+                              std::vector<double> const& local_xdot,
+                              ThreadData& d);
+    BaseLib::PerThread<ThreadData> _thread_data;
+
+    //! \see setTimeDiscretizedAssembly()
+    bool _time_discretized_assembly = false;
+    double _dxdot_dx = 0.0;
+    GlobalVector const* _weighted_old_x = nullptr;
 };
 
 }  // namespace ProcessLib
@@ -0,0 +1,345 @@
+/*!
+  \file PartitionedMeshRoundTripTester.cpp
+  \brief Writes a mesh with the node-wise partitioner into the single file
+         binary format, reads it back with NodePartitionedMeshReader, both
+         collectively and memory-mapped, and compares the partitions with the
+         original mesh.
+
+  \copyright
+  Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+             Distributed under a Modified BSD License.
+               See accompanying file LICENSE.txt or
+               http://www.opengeosys.org/project/license
+*/
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+
+#ifdef USE_PETSC
+#include <petscksp.h>
+#endif
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/LogogCustomCout.h"
+#include "BaseLib/TemplateLogogFormatterSuppressedGCC.h"
+
+#include "Applications/Utils/ModelPreparation/PartitionMesh/NodeWiseMeshPartitioner.h"
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/IO/MPI_IO/NodePartitionedMeshReader.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/NodePartitionedMesh.h"
+
+namespace
+{
+unsigned const n_x_cells = 4;
+
+std::unique_ptr<MeshLib::Mesh> createMesh()
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(n_x_cells, 3, 2, 1.0));
+
+    auto* const pressure =
+        mesh->getProperties().createNewPropertyVector<double>(
+            "pressure", MeshLib::MeshItemType::Node, 1);
+    auto* const node_ids = mesh->getProperties().createNewPropertyVector<int>(
+        "node_ids", MeshLib::MeshItemType::Node, 1);
+    for (auto const* node : mesh->getNodes())
+    {
+        pressure->push_back((*node)[0] + 10 * (*node)[1] + 100 * (*node)[2]);
+        node_ids->push_back(static_cast<int>(node->getID()));
+    }
+    return mesh;
+}
+
+/// Splits the mesh into slabs of nodes along the x axis.
+std::vector<std::size_t> getPartitionIDs(MeshLib::Mesh const& mesh,
+                                         int const number_of_partitions)
+{
+    std::vector<std::size_t> partition_ids;
+    for (auto const* node : mesh.getNodes())
+    {
+        auto const slab = static_cast<std::size_t>((*node)[0]);
+        partition_ids.push_back(slab * number_of_partitions / (n_x_cells + 1));
+    }
+    return partition_ids;
+}
+
+/// Writes the partitions as partmesh does, where the partition of each node is
+/// given instead of computed by METIS.
+void writePartitionedMesh(std::string const& file_name_base,
+                          int const number_of_partitions)
+{
+    auto mesh = createMesh();
+    {
+        std::ofstream os(file_name_base + ".mesh.npart." +
+                         std::to_string(number_of_partitions));
+        for (auto const id : getPartitionIDs(*mesh, number_of_partitions))
+            os << id << "\n";
+    }
+
+    ApplicationUtils::NodeWiseMeshPartitioner partitioner(number_of_partitions,
+                                                          std::move(mesh));
+    partitioner.readMetisData(file_name_base);
+    partitioner.partitionByMETIS(false);
+    partitioner.writeBinary(file_name_base);
+}
+
+/// Original node ids of the nodes of an element.
+std::vector<std::size_t> getNodeIDs(
+    MeshLib::Element const& element,
+    std::vector<std::size_t> const& original_node_ids)
+{
+    std::vector<std::size_t> ids;
+    for (unsigned i = 0; i < element.getNumberOfNodes(); ++i)
+        ids.push_back(original_node_ids[element.getNodeIndex(i)]);
+    return ids;
+}
+
+/// Compares the partition of this process with the original mesh. The
+/// function contains collective calls, hence it has to be called by all
+/// processes.
+bool compare(MeshLib::Mesh const& mesh,
+             std::vector<std::size_t> const& partition_ids, int const rank,
+             MeshLib::NodePartitionedMesh const& partition)
+{
+    bool ok = true;
+    std::size_t const n_nodes = mesh.getNumberOfNodes();
+    if (partition.getNumberOfGlobalNodes() != n_nodes)
+    {
+        ERR("[%d] The partition has %d global nodes instead of %d.", rank,
+            partition.getNumberOfGlobalNodes(), n_nodes);
+        ok = false;
+    }
+
+    // Nodes are identified by their coordinates, which are written and read
+    // as binary values.
+    std::map<std::array<double, 3>, std::size_t> node_by_coordinates;
+    for (auto const* node : mesh.getNodes())
+        node_by_coordinates[{{(*node)[0], (*node)[1], (*node)[2]}}] =
+            node->getID();
+
+    auto const* pressure =
+        partition.getProperties().getPropertyVector<double>("pressure");
+    auto const* node_ids =
+        partition.getProperties().getPropertyVector<int>("node_ids");
+    auto const* original_pressure =
+        mesh.getProperties().getPropertyVector<double>("pressure");
+    bool found = pressure && node_ids &&
+                 pressure->size() == partition.getNumberOfNodes() &&
+                 node_ids->size() == partition.getNumberOfNodes();
+    if (!found)
+    {
+        ERR("[%d] The node properties are missing or have a wrong size.",
+            rank);
+    }
+
+    std::vector<std::size_t> original_node_ids;
+    for (auto const* node : partition.getNodes())
+    {
+        auto const it =
+            node_by_coordinates.find({{(*node)[0], (*node)[1], (*node)[2]}});
+        if (it == node_by_coordinates.end())
+        {
+            ERR("[%d] Node %d is not a node of the original mesh.", rank,
+                node->getID());
+            found = false;
+            break;
+        }
+        original_node_ids.push_back(it->second);
+    }
+
+    // Without the properties and the node mapping nothing can be compared.
+    // Agree on that before the collective calls below.
+    bool all_found;
+    MPI_Allreduce(&found, &all_found, 1, MPI_C_BOOL, MPI_LAND, MPI_COMM_WORLD);
+    if (!all_found)
+        return false;
+
+    // Global ids of the non-ghost nodes, incremented by one, such that zero
+    // marks nodes not owned by this process.
+    std::vector<long> owned_global_ids(n_nodes, 0);
+    std::vector<long> number_of_owners(n_nodes, 0);
+    for (auto const* node : partition.getNodes())
+    {
+        std::size_t const id = original_node_ids[node->getID()];
+
+        bool const is_ghost = partition.isGhostNode(node->getID());
+        if (is_ghost == (partition_ids[id] == static_cast<std::size_t>(rank)))
+        {
+            ERR("[%d] Node %d is wrongly marked as %s node.", rank, id,
+                is_ghost ? "ghost" : "non-ghost");
+            ok = false;
+        }
+        if (!is_ghost)
+        {
+            owned_global_ids[id] = static_cast<long>(
+                partition.getGlobalNodeID(node->getID()) + 1);
+            number_of_owners[id] = 1;
+        }
+        if ((*pressure)[node->getID()] != (*original_pressure)[id] ||
+            (*node_ids)[node->getID()] != static_cast<int>(id))
+        {
+            ERR("[%d] The property values of node %d differ.", rank, id);
+            ok = false;
+        }
+    }
+
+    // Every node is owned by exactly one process, and the ghost nodes carry
+    // the global id given by their owner.
+    MPI_Allreduce(MPI_IN_PLACE, owned_global_ids.data(),
+                  static_cast<int>(n_nodes), MPI_LONG, MPI_SUM,
+                  MPI_COMM_WORLD);
+    MPI_Allreduce(MPI_IN_PLACE, number_of_owners.data(),
+                  static_cast<int>(n_nodes), MPI_LONG, MPI_SUM,
+                  MPI_COMM_WORLD);
+    if (std::count(number_of_owners.begin(), number_of_owners.end(), 1) !=
+        static_cast<long>(n_nodes))
+    {
+        ERR("[%d] Not every node is owned by exactly one partition.", rank);
+        ok = false;
+    }
+    std::set<long> global_ids(owned_global_ids.begin(),
+                              owned_global_ids.end());
+    if (global_ids.size() != n_nodes || *global_ids.begin() != 1 ||
+        *global_ids.rbegin() != static_cast<long>(n_nodes))
+    {
+        ERR("[%d] The global node ids are not a permutation.", rank);
+        ok = false;
+    }
+    for (auto const* node : partition.getNodes())
+    {
+        std::size_t const id = original_node_ids[node->getID()];
+        if (owned_global_ids[id] !=
+            static_cast<long>(partition.getGlobalNodeID(node->getID()) + 1))
+        {
+            ERR("[%d] Node %d has another global id than in its owning "
+                "partition.",
+                rank, id);
+            ok = false;
+        }
+    }
+
+    // Regular elements have all nodes in this partition, ghost elements only
+    // some of them. The regular elements are stored first.
+    std::set<std::vector<std::size_t>> expected_regular_elements;
+    std::set<std::vector<std::size_t>> expected_ghost_elements;
+    std::vector<std::size_t> mesh_node_ids(n_nodes);
+    std::iota(mesh_node_ids.begin(), mesh_node_ids.end(), 0);
+    for (auto const* element : mesh.getElements())
+    {
+        auto const ids = getNodeIDs(*element, mesh_node_ids);
+        auto const n_in_partition = std::count_if(
+            ids.begin(), ids.end(), [&](std::size_t const id) {
+                return partition_ids[id] == static_cast<std::size_t>(rank);
+            });
+        if (n_in_partition == static_cast<long>(ids.size()))
+            expected_regular_elements.insert(ids);
+        else if (n_in_partition > 0)
+            expected_ghost_elements.insert(ids);
+    }
+
+    std::set<std::vector<std::size_t>> regular_elements;
+    std::set<std::vector<std::size_t>> ghost_elements;
+    auto const& elements = partition.getElements();
+    for (std::size_t i = 0; i < elements.size(); ++i)
+    {
+        auto const ids = getNodeIDs(*elements[i], original_node_ids);
+        if (i < expected_regular_elements.size())
+            regular_elements.insert(ids);
+        else
+            ghost_elements.insert(ids);
+    }
+    if (elements.size() != expected_regular_elements.size() +
+                               expected_ghost_elements.size() ||
+        regular_elements != expected_regular_elements ||
+        ghost_elements != expected_ghost_elements)
+    {
+        ERR("[%d] The elements differ from the original mesh.", rank);
+        ok = false;
+    }
+
+    return ok;
+}
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    LOGOG_INITIALIZE();
+
+    MPI_Init(&argc, &argv);
+
+#ifdef USE_PETSC
+    char help[] = "ogs6 with PETSc \n";
+    PetscInitialize(&argc, &argv, nullptr, help);
+#endif
+
+    BaseLib::LogogCustomCout* out = new BaseLib::LogogCustomCout(1);
+    using LogogFormatter = BaseLib::TemplateLogogFormatterSuppressedGCC
+        <TOPIC_LEVEL_FLAG | TOPIC_FILE_NAME_FLAG | TOPIC_LINE_NUMBER_FLAG>;
+    LogogFormatter* fmt = new LogogFormatter();
+
+    out->SetFormatter(*fmt);
+
+    const std::string file_name_base = argv[1];
+
+    int rank;
+    int size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    if (rank == 0)
+        writePartitionedMesh(file_name_base, size);
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    auto const mesh = createMesh();
+    auto const partition_ids = getPartitionIDs(*mesh, size);
+
+    bool ok = true;
+    for (bool const use_memory_mapping : {false, true})
+    {
+        MeshLib::IO::NodePartitionedMeshReader reader(MPI_COMM_WORLD,
+                                                      use_memory_mapping);
+        std::unique_ptr<MeshLib::NodePartitionedMesh> const partition(
+            reader.read(file_name_base));
+        // The reader fails on all processes or on none.
+        if (!partition)
+        {
+            ERR("Could not read the partitioned mesh %s.",
+                file_name_base.c_str());
+            ok = false;
+            continue;
+        }
+        ok = compare(*mesh, partition_ids, rank, *partition) && ok;
+    }
+
+    bool all_ok;
+    MPI_Allreduce(&ok, &all_ok, 1, MPI_C_BOOL, MPI_LAND, MPI_COMM_WORLD);
+    if (rank == 0)
+        INFO("The partitioned mesh %s round trip.",
+             all_ok ? "survived the" : "failed in the");
+
+    delete out;
+    delete fmt;
+
+#ifdef USE_PETSC
+    PetscFinalize();
+#endif
+
+    MPI_Finalize();
+
+    LOGOG_SHUTDOWN();
+
+    return all_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,66 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include "BaseLib/FixedSizePool.h"
+
+TEST(BaseLib, FixedSizePool)
+{
+    std::size_t const object_size = 3 * sizeof(double) + 1;
+    BaseLib::FixedSizePool pool(object_size);
+    ASSERT_EQ(0u, pool.getNumberOfBlocks());
+
+    std::vector<char*> objects;
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+        auto* const p = static_cast<char*>(pool.allocate());
+        ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(p) %
+                          alignof(std::max_align_t));
+        // Write the whole object to catch overlapping chunks.
+        std::fill(p, p + object_size, static_cast<char>(i));
+        objects.push_back(p);
+    }
+    ASSERT_EQ(1000u, pool.getNumberOfObjects());
+    // Geometrically growing blocks of 64, 128, 256, 512, 1024 objects.
+    ASSERT_EQ(5u, pool.getNumberOfBlocks());
+
+    // Objects allocated in succession are adjacent.
+    ASSERT_EQ(objects[1] - objects[0], objects[2] - objects[1]);
+    ASSERT_LE(static_cast<std::size_t>(objects[1] - objects[0]),
+              object_size + alignof(std::max_align_t));
+
+    for (std::size_t i = 0; i < objects.size(); ++i)
+        for (std::size_t k = 0; k < object_size; ++k)
+            ASSERT_EQ(static_cast<char>(i), objects[i][k]);
+
+    // Freed chunks are reused.
+    std::set<char*> freed;
+    for (std::size_t i = 0; i < objects.size(); i += 2)
+    {
+        pool.deallocate(objects[i]);
+        freed.insert(objects[i]);
+    }
+    ASSERT_EQ(500u, pool.getNumberOfObjects());
+    for (std::size_t i = 0; i < 500; ++i)
+        ASSERT_EQ(1u, freed.count(static_cast<char*>(pool.allocate())));
+    ASSERT_EQ(5u, pool.getNumberOfBlocks());
+
+    // All blocks are released together with the last object.
+    for (std::size_t i = 0; i < objects.size(); ++i)
+        pool.deallocate(objects[i]);
+    ASSERT_EQ(0u, pool.getNumberOfObjects());
+    ASSERT_EQ(0u, pool.getNumberOfBlocks());
+}
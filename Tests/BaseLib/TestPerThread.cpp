@@ -0,0 +1,62 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "BaseLib/PerThread.h"
+
+TEST(BaseLib, PerThread)
+{
+    using Index = OPENMP_LOOP_TYPE;
+    BaseLib::PerThread<std::vector<Index>> sums(std::vector<Index>(1, 0));
+    EXPECT_EQ(Index(0), sums.get()[0]);
+
+    Index const n = 1000;
+#pragma omp parallel for
+    for (Index i = 0; i < n; ++i)
+        sums.get()[0] += i;
+
+    Index total = 0;
+    for (auto const& sum : sums)
+        total += sum[0];
+    EXPECT_EQ(n * (n - 1) / 2, total);
+
+    EXPECT_FALSE(BaseLib::isInParallelRegion());
+}
+
+TEST(BaseLib, FirstException)
+{
+    using Index = OPENMP_LOOP_TYPE;
+    Index const n = 1000;
+    std::vector<char> visited(n, 0);
+    BaseLib::FirstException first_exception;
+#pragma omp parallel for
+    for (Index i = 0; i < n; ++i)
+    {
+        first_exception.run([&] {
+            visited[i] = 1;
+            if (i % 100 == 7)
+                throw std::runtime_error("failed iteration");
+        });
+    }
+
+    EXPECT_THROW(first_exception.rethrow(), std::runtime_error);
+    // The iterations after the first failure of a thread are skipped.
+    EXPECT_LT(std::count(visited.begin(), visited.end(), 1), n);
+
+    BaseLib::FirstException no_exception;
+#pragma omp parallel for
+    for (Index i = 0; i < n; ++i)
+        no_exception.run([] {});
+    EXPECT_NO_THROW(no_exception.rethrow());
+}
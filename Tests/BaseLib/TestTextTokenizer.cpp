@@ -0,0 +1,129 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "BaseLib/TextTokenizer.h"
+
+TEST(BaseLib, TextTokenizerIntegers)
+{
+    std::string const text = " 42\t-7\n+3 18446744073709551615 -9 4294967296";
+    BaseLib::TextTokenizer tokenizer(text);
+
+    int i = 0;
+    ASSERT_TRUE(tokenizer.read(i));
+    EXPECT_EQ(42, i);
+    ASSERT_TRUE(tokenizer.read(i));
+    EXPECT_EQ(-7, i);
+    std::size_t s = 0;
+    ASSERT_TRUE(tokenizer.read(s));
+    EXPECT_EQ(3u, s);
+    unsigned long long u = 0;
+    ASSERT_TRUE(tokenizer.read(u));
+    EXPECT_EQ(std::numeric_limits<unsigned long long>::max(), u);
+
+    // negative values are rejected for unsigned types
+    EXPECT_FALSE(tokenizer.read(s));
+    ASSERT_TRUE(tokenizer.read(i));
+    EXPECT_EQ(-9, i);
+
+    // overflow
+    unsigned v = 0;
+    EXPECT_FALSE(tokenizer.read(v));
+    long l = 0;
+    ASSERT_TRUE(tokenizer.read(l));
+    EXPECT_EQ(4294967296, l);
+
+    EXPECT_TRUE(tokenizer.atEnd());
+    EXPECT_FALSE(tokenizer.read(i));
+}
+
+TEST(BaseLib, TextTokenizerDoubles)
+{
+    std::string const text =
+        "1 -2.5 .125 3.e2 1.5E-3 0.1 6.02214076e23 "
+        "0.30000000000000004441 -0 1e-400 abc";
+    BaseLib::TextTokenizer tokenizer(text);
+
+    double const expected[] = {1,      -2.5,    .125,    3.e2,
+                               1.5E-3, 0.1,     6.02214076e23,
+                               0.30000000000000004441, -0.,
+                               0.};
+    for (double const e : expected)
+    {
+        double d = -1;
+        ASSERT_TRUE(tokenizer.read(d));
+        EXPECT_EQ(e, d);
+    }
+    double d = 0;
+    EXPECT_FALSE(tokenizer.read(d));
+    std::string word;
+    ASSERT_TRUE(tokenizer.readWord(word));
+    EXPECT_EQ("abc", word);
+}
+
+// Compares the conversion with strtod for numbers with all numbers of digits.
+TEST(BaseLib, TextTokenizerDoublesRoundtrip)
+{
+    std::mt19937 random_number_generator(0);
+    std::uniform_real_distribution<double> exponent(-30, 30);
+    std::uniform_real_distribution<double> significand(-10, 10);
+    char buffer[64];
+    for (int i = 0; i < 10000; ++i)
+    {
+        double const value =
+            significand(random_number_generator) *
+            std::pow(10., static_cast<int>(exponent(random_number_generator)));
+        std::snprintf(buffer, sizeof(buffer), "%.*g", 1 + i % 17, value);
+        std::string const text(buffer);
+        BaseLib::TextTokenizer tokenizer(text);
+        double d;
+        ASSERT_TRUE(tokenizer.read(d));
+        EXPECT_EQ(std::strtod(buffer, nullptr), d) << text;
+        EXPECT_TRUE(tokenizer.atEnd());
+    }
+}
+
+TEST(BaseLib, TextTokenizerSeparatorsAndLines)
+{
+    std::string const text = "1.5, 2,3\r\n\n  \nnext line\nlast";
+    BaseLib::TextTokenizer tokenizer(text);
+
+    double x[3];
+    for (auto& v : x)
+    {
+        ASSERT_TRUE(tokenizer.read(v));
+        tokenizer.skipSeparator(',');
+    }
+    EXPECT_EQ(1.5, x[0]);
+    EXPECT_EQ(2., x[1]);
+    EXPECT_EQ(3., x[2]);
+
+    auto const lines = tokenizer.splitLines(2);
+    ASSERT_EQ(3u, lines.size());
+    EXPECT_EQ("next line\n", std::string(lines[0], lines[1]));
+    EXPECT_EQ("last", std::string(lines[1], lines[2]));
+    EXPECT_TRUE(tokenizer.atEnd());
+    // There are only three non-empty lines, the end entry is missing then.
+    EXPECT_EQ(3u, BaseLib::TextTokenizer(text).splitLines(5).size());
+
+    std::string line;
+    BaseLib::TextTokenizer line_tokenizer(text);
+    ASSERT_TRUE(line_tokenizer.readLine(line));
+    EXPECT_EQ("1.5, 2,3\r", line);
+    ASSERT_TRUE(line_tokenizer.readLine(line));
+    EXPECT_EQ("", line);
+}
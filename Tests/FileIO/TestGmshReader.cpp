@@ -0,0 +1,109 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "Applications/FileIO/Gmsh/GmshReader.h"
+#include "BaseLib/BuildInfo.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+
+class GmshReaderTest : public ::testing::Test
+{
+public:
+    ~GmshReaderTest() { std::remove(_file_name.c_str()); }
+
+    void writeFile(long const id_scale) const
+    {
+        std::ofstream out(_file_name);
+        out << "$MeshFormat\n2.2 0 8\n$EndMeshFormat\n";
+        out << "$PhysicalNames\n1\n2 1 \"domain\"\n$EndPhysicalNames\n";
+        out << "$Nodes\n6\n";
+        for (long i = 0; i < 6; ++i)
+            out << (i + 1) * id_scale << " " << 0.5 * (i % 3) << " "
+                << (i / 3) << " 1.25e-1\n";
+        out << "$EndNodes\n$Elements\n4\n";
+        out << "1 15 2 0 1 " << id_scale << "\n";
+        out << "2 2 2 3 1 " << id_scale << " " << 2 * id_scale << " "
+            << 5 * id_scale << "\n";
+        out << "3 3 3 7 1 0 " << 2 * id_scale << " " << 3 * id_scale << " "
+            << 6 * id_scale << " " << 5 * id_scale << "\n";
+        out << "4 8 2 0 1 " << id_scale << " " << 2 * id_scale << " "
+            << 3 * id_scale << "\n";
+        out << "$EndElements\n";
+    }
+
+    void checkMesh() const
+    {
+        std::unique_ptr<MeshLib::Mesh> mesh(
+            FileIO::GMSH::readGMSHMesh(_file_name));
+        ASSERT_TRUE(mesh != nullptr);
+        ASSERT_EQ(6u, mesh->getNumberOfNodes());
+        // The point and the unsupported quadratic line are skipped.
+        ASSERT_EQ(2u, mesh->getNumberOfElements());
+
+        auto const& n = *mesh->getNode(4);
+        EXPECT_EQ(0.5, n[0]);
+        EXPECT_EQ(1.0, n[1]);
+        EXPECT_EQ(0.125, n[2]);
+
+        // Triangles are read in reverse node order.
+        auto const& tri = *mesh->getElement(0);
+        EXPECT_EQ(MeshLib::CellType::TRI3, tri.getCellType());
+        EXPECT_EQ(4u, tri.getNodeIndex(0));
+        EXPECT_EQ(1u, tri.getNodeIndex(1));
+        EXPECT_EQ(0u, tri.getNodeIndex(2));
+
+        auto const& quad = *mesh->getElement(1);
+        EXPECT_EQ(MeshLib::CellType::QUAD4, quad.getCellType());
+        EXPECT_EQ(1u, quad.getNodeIndex(0));
+        EXPECT_EQ(5u, quad.getNodeIndex(2));
+
+        auto const* material_ids =
+            mesh->getProperties().getPropertyVector<int>("MaterialIDs");
+        ASSERT_TRUE(material_ids != nullptr);
+        // The material ids are condensed to 0 and 1.
+        EXPECT_EQ(0, (*material_ids)[0]);
+        EXPECT_EQ(1, (*material_ids)[1]);
+    }
+
+protected:
+    std::string const _file_name =
+        BaseLib::BuildInfo::tests_tmp_path + "GmshReaderTest.msh";
+};
+
+TEST_F(GmshReaderTest, ContiguousNodeIds)
+{
+    writeFile(1);
+    checkMesh();
+}
+
+TEST_F(GmshReaderTest, ScatteredNodeIds)
+{
+    writeFile(1000);
+    checkMesh();
+}
+
+TEST_F(GmshReaderTest, UnknownNodeId)
+{
+    {
+        std::ofstream out(_file_name);
+        out << "$MeshFormat\n2.2 0 8\n$EndMeshFormat\n";
+        out << "$Nodes\n3\n1 0 0 0\n2 1 0 0\n3 0 1 0\n$EndNodes\n";
+        out << "$Elements\n1\n1 2 2 0 1 1 2 4\n$EndElements\n";
+    }
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        FileIO::GMSH::readGMSHMesh(_file_name));
+    ASSERT_TRUE(mesh == nullptr);
+}
@@ -0,0 +1,122 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <random>
+
+#include "gtest/gtest.h"
+
+#include "GeoLib/AnalyticalGeometry.h"
+#include "GeoLib/LineSegment.h"
+#include "GeoLib/Point.h"
+
+namespace
+{
+void addSegment(std::vector<GeoLib::LineSegment>& segments, double x0,
+                double y0, double z0, double x1, double y1, double z1)
+{
+    segments.emplace_back(new GeoLib::Point(x0, y0, z0),
+                          new GeoLib::Point(x1, y1, z1), true);
+}
+
+// Compares the result with testing all pairs of segments.
+void compareWithAllPairs(
+    std::vector<GeoLib::LineSegment> const& segments,
+    std::function<bool(std::size_t, std::size_t)> const& is_pair_tested)
+{
+    auto const intersections(
+        GeoLib::computeSegmentIntersections(segments, is_pair_tested));
+
+    std::size_t n(0);
+    for (std::size_t i(0); i < segments.size(); ++i)
+    {
+        for (std::size_t j(i + 1); j < segments.size(); ++j)
+        {
+            GeoLib::Point s;
+            if (!is_pair_tested(i, j) ||
+                !GeoLib::lineSegmentIntersect(segments[i], segments[j], s))
+                continue;
+            ASSERT_LT(n, intersections.size());
+            EXPECT_EQ(i, intersections[n].first_segment);
+            EXPECT_EQ(j, intersections[n].second_segment);
+            EXPECT_EQ(0.0, MathLib::sqrDist(s, intersections[n].point));
+            n++;
+        }
+    }
+    ASSERT_EQ(n, intersections.size());
+    // The tests are not trivial.
+    ASSERT_LT(0u, n);
+}
+
+bool allPairs(std::size_t, std::size_t)
+{
+    return true;
+}
+}  // namespace
+
+TEST(GeoLibComputeSegmentIntersections, RandomSegments)
+{
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<double> position(0.0, 100.0);
+    std::uniform_real_distribution<double> offset(-2.0, 2.0);
+    std::vector<GeoLib::LineSegment> segments;
+    for (std::size_t k(0); k < 2000; ++k)
+    {
+        double const x(position(gen));
+        double const y(position(gen));
+        addSegment(segments, x, y, 0.0, x + offset(gen), y + offset(gen), 0.0);
+    }
+    // long segments crossing many grid cells
+    for (std::size_t k(0); k < 20; ++k)
+        addSegment(segments, position(gen), 0.0, 0.0, position(gen), 100.0,
+                   0.0);
+
+    compareWithAllPairs(segments, allPairs);
+    compareWithAllPairs(segments, [](std::size_t i, std::size_t j) {
+        return (i + j) % 2 == 0;
+    });
+}
+
+// Segments touching in end points and collinear overlapping segments.
+TEST(GeoLibComputeSegmentIntersections, TouchingAndOverlappingSegments)
+{
+    std::vector<GeoLib::LineSegment> segments;
+    for (std::size_t k(0); k < 100; ++k)
+    {
+        addSegment(segments, k, 0.0, 0.0, k + 1.0, 0.0, 0.0);
+        addSegment(segments, k + 0.5, 0.0, 0.0, k + 1.5, 0.0, 0.0);
+        addSegment(segments, k, 0.0, 0.0, k + 0.5, 1.0, 0.0);
+    }
+    compareWithAllPairs(segments, allPairs);
+}
+
+// Segments on a common vertical line, where the grid is degenerated in one
+// direction.
+TEST(GeoLibComputeSegmentIntersections, VerticalSegments)
+{
+    std::vector<GeoLib::LineSegment> segments;
+    for (std::size_t k(0); k < 100; ++k)
+        addSegment(segments, 1.0, 1.0, k, 1.0, 1.0, k + 1.0);
+    compareWithAllPairs(segments, allPairs);
+}
+
+// Segments in three dimensions, most of them are not coplanar.
+TEST(GeoLibComputeSegmentIntersections, Segments3d)
+{
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<double> position(0.0, 10.0);
+    std::uniform_int_distribution<int> level(0, 3);
+    std::vector<GeoLib::LineSegment> segments;
+    for (std::size_t k(0); k < 2000; ++k)
+    {
+        double const z(level(gen));
+        addSegment(segments, position(gen), position(gen), z, position(gen),
+                   position(gen), (k % 4 == 0) ? level(gen) : z);
+    }
+    compareWithAllPairs(segments, allPairs);
+}
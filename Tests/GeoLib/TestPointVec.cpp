@@ -204,3 +204,70 @@ TEST_F(PointVecTest, TestPointVecCtorRandomPointsLargeEps)
 
     delete point_vec;
 }
+
+// Testing input points containing copies of previous points.
+TEST_F(PointVecTest, TestPointVecCtorRandomPointsWithCopies)
+{
+    auto ps_ptr = std::unique_ptr<VectorOfPoints>(new VectorOfPoints);
+    generateRandomPoints(*ps_ptr, 1000);
+    auto* names = new std::map<std::string, std::size_t>;
+    for (std::size_t k(0); k < 1000; k += 3)
+    {
+        (*names)["copy_" + std::to_string(k)] = ps_ptr->size();
+        ps_ptr->push_back(new GeoLib::Point(*(*ps_ptr)[k], ps_ptr->size()));
+    }
+
+    GeoLib::PointVec point_vec(name, std::move(ps_ptr), names);
+    ASSERT_EQ(std::size_t(1000), point_vec.size());
+    ASSERT_EQ(std::size_t(1334), point_vec.getIDMap().size());
+    for (std::size_t k(0); k < 1000; ++k)
+    {
+        ASSERT_EQ(k, point_vec.getIDMap()[k]);
+        ASSERT_EQ(k, (*point_vec.getVector())[k]->getID());
+    }
+    for (std::size_t k(0); k < 334; ++k)
+        ASSERT_EQ(3 * k, point_vec.getIDMap()[1000 + k]);
+
+    std::size_t id;
+    ASSERT_TRUE(point_vec.getElementIDByName("copy_3", id));
+    ASSERT_EQ(std::size_t(3), id);
+}
+
+// Testing that points close to removed points are kept, as in the sequential
+// insertion.
+TEST_F(PointVecTest, TestPointVecCtorChainOfClosePoints)
+{
+    auto ps_ptr = std::unique_ptr<VectorOfPoints>(new VectorOfPoints);
+    ps_ptr->push_back(new GeoLib::Point(0,0,0,0));
+    ps_ptr->push_back(new GeoLib::Point(0.6,0,0,1));
+    ps_ptr->push_back(new GeoLib::Point(1.2,0,0,2));
+    ps_ptr->push_back(new GeoLib::Point(10,0,0,3));
+
+    // the tolerance is 0.7
+    GeoLib::PointVec point_vec(name, std::move(ps_ptr), nullptr,
+                               GeoLib::PointVec::PointType::POINT, 0.07);
+    ASSERT_EQ(std::size_t(3), point_vec.size());
+    ASSERT_EQ(std::size_t(0), point_vec.getIDMap()[0]);
+    ASSERT_EQ(std::size_t(0), point_vec.getIDMap()[1]);
+    ASSERT_EQ(std::size_t(1), point_vec.getIDMap()[2]);
+    ASSERT_EQ(std::size_t(2), point_vec.getIDMap()[3]);
+}
+
+// Testing the incremental insertion of points outside of the bounding box.
+TEST_F(PointVecTest, TestPointVecPushBackGrowing)
+{
+    auto ps_ptr = std::unique_ptr<VectorOfPoints>(new VectorOfPoints);
+    ps_ptr->push_back(new GeoLib::Point(0,0,0,0));
+    ps_ptr->push_back(new GeoLib::Point(1,1,1,1));
+    GeoLib::PointVec point_vec(name, std::move(ps_ptr));
+
+    for (std::size_t k(2); k < 2000; ++k)
+    {
+        ASSERT_EQ(k, point_vec.push_back(new GeoLib::Point(k, k, k, k)));
+        // a copy of a previously inserted point
+        ASSERT_EQ(k / 2,
+                  point_vec.push_back(new GeoLib::Point(k / 2, k / 2, k / 2)));
+    }
+    ASSERT_EQ(std::size_t(2000), point_vec.size());
+    ASSERT_NEAR(1999.0, point_vec.getAABB().getMaxPoint()[0], 1e-12);
+}
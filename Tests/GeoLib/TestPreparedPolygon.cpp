@@ -0,0 +1,144 @@
+/**
+ * @brief Tests the point in polygon queries of class PreparedPolygon against
+ * the ones of class Polygon.
+ *
+ * @copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/LICENSE.txt
+ */
+
+#include <array>
+#include <cmath>
+#include <memory>
+#include <random>
+
+#include <boost/math/constants/constants.hpp>
+
+#include "gtest/gtest.h"
+
+#include "GeoLib/Point.h"
+#include "GeoLib/Polygon.h"
+#include "GeoLib/PreparedPolygon.h"
+
+class GeoLibPreparedPolygon : public testing::Test
+{
+public:
+    typedef std::vector<GeoLib::Point*> VectorOfPoints;
+
+    ~GeoLibPreparedPolygon()
+    {
+        for (auto p : ps_ptr)
+            delete p;
+    }
+
+protected:
+    // Creates a polygon from the given vertices.
+    std::unique_ptr<GeoLib::Polygon> createPolygon(
+        std::vector<std::array<double, 2>> const& vertices)
+    {
+        GeoLib::Polyline ply(ps_ptr);
+        for (auto const& v : vertices)
+        {
+            ps_ptr.push_back(
+                new GeoLib::Point(v[0], v[1], 0.0, ps_ptr.size()));
+            ply.addPoint(ps_ptr.size() - 1);
+        }
+        ply.addPoint(ply.getPointID(0));
+        return std::unique_ptr<GeoLib::Polygon>(new GeoLib::Polygon(ply));
+    }
+
+    // Creates a star shaped polygon with the given number of vertices with
+    // random distances to the origin.
+    std::unique_ptr<GeoLib::Polygon> createStarPolygon(std::size_t const n)
+    {
+        double const pi = boost::math::constants::pi<double>();
+        std::mt19937 gen(0);
+        std::uniform_real_distribution<double> radius(0.5, 1.0);
+        std::vector<std::array<double, 2>> vertices;
+        for (std::size_t k(0); k < n; ++k)
+        {
+            double const r = radius(gen);
+            vertices.push_back({{r * std::cos(2 * pi * k / n),
+                                 r * std::sin(2 * pi * k / n)}});
+        }
+        return createPolygon(vertices);
+    }
+
+    // Compares the point in polygon queries of PreparedPolygon and Polygon for
+    // random points in [-1.1,1.1]^2, the polygon vertices and points on the
+    // polygon segments.
+    void compareWithPolygon(GeoLib::Polygon const& polygon)
+    {
+        std::vector<GeoLib::Point> pnts;
+        std::mt19937 gen(0);
+        std::uniform_real_distribution<double> coordinate(-1.1, 1.1);
+        for (std::size_t k(0); k < 10000; ++k)
+            pnts.emplace_back(coordinate(gen), coordinate(gen), 0.0);
+        for (std::size_t k(0); k + 1 < polygon.getNumberOfPoints(); ++k)
+        {
+            GeoLib::Point const& a(*polygon.getPoint(k));
+            GeoLib::Point const& b(*polygon.getPoint(k + 1));
+            pnts.push_back(a);
+            pnts.emplace_back(0.3 * a[0] + 0.7 * b[0], 0.3 * a[1] + 0.7 * b[1],
+                              0.0);
+            // points with the same y coordinate as a vertex
+            pnts.emplace_back(0.0, a[1], 0.0);
+            pnts.emplace_back(a[0] + 1e-3, a[1], 0.0);
+        }
+        std::vector<GeoLib::Point const*> pnt_ptrs;
+        for (auto const& p : pnts)
+            pnt_ptrs.push_back(&p);
+
+        GeoLib::PreparedPolygon const prepared_polygon(polygon);
+        std::vector<bool> const inside(
+            prepared_polygon.arePntsInPolygon(pnt_ptrs));
+        ASSERT_EQ(pnts.size(), inside.size());
+        std::size_t n_inside(0);
+        for (std::size_t k(0); k < pnts.size(); ++k)
+        {
+            bool const expected(polygon.isPntInPolygon(pnts[k]));
+            ASSERT_EQ(expected, inside[k]) << pnts[k];
+            ASSERT_EQ(expected, prepared_polygon.isPntInPolygon(pnts[k]));
+            if (expected)
+                n_inside++;
+        }
+        // The queries are not trivial.
+        ASSERT_LT(0u, n_inside);
+        ASSERT_GT(pnts.size(), n_inside);
+    }
+
+protected:
+    VectorOfPoints ps_ptr;
+};
+
+TEST_F(GeoLibPreparedPolygon, SmallStarPolygon)
+{
+    compareWithPolygon(*createStarPolygon(5));
+}
+
+TEST_F(GeoLibPreparedPolygon, LargeStarPolygon)
+{
+    compareWithPolygon(*createStarPolygon(5000));
+}
+
+// The segments of a (nearly) horizontal polygon side span all slabs.
+TEST_F(GeoLibPreparedPolygon, PolygonWithLongSegments)
+{
+    std::vector<std::array<double, 2>> vertices{{{-1.0, -1.0}}, {{1.0, -1.0}}};
+    for (std::size_t k(0); k < 1000; ++k)
+        vertices.push_back({{1.0 - 2e-3 * k, (k % 2 == 0) ? 1.0 : 0.9}});
+    compareWithPolygon(*createPolygon(vertices));
+}
+
+// A self-intersecting polygon, that is split into simple polygons.
+TEST_F(GeoLibPreparedPolygon, SplitPolygon)
+{
+    auto const polygon = createPolygon(
+        {{{-1.0, -1.0}}, {{1.0, 1.0}}, {{1.0, -1.0}}, {{-1.0, 1.0}}});
+    polygon->computeListOfSimplePolygons();
+    ASSERT_EQ(2u, polygon->getListOfSimplePolygons().size());
+
+    compareWithPolygon(*polygon);
+}
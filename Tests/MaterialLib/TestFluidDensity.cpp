@@ -160,3 +160,38 @@ TEST(Material, checkWaterDensityIAPWSIF97Region1)
     const double rho_p1 = rho->getValue(vars);
     ASSERT_NEAR((rho_p1 - rho_T1) / perturbation, drho_dp, 1.e-6);
 }
+
+TEST(Material, checkTabulatedWaterDensityIAPWSIF97Region1)
+{
+    const char xml[] =
+        "<density>"
+        "   <type>WaterDensityIAPWSIF97Region1</type>"
+        "</density>";
+    const char xml_tabulated[] =
+        "<density>"
+        "   <type>WaterDensityIAPWSIF97Region1</type>"
+        "   <tabulation>"
+        "       <temperature_range>273.15 573.15</temperature_range>"
+        "       <pressure_range>1.e+6 5.e+7</pressure_range>"
+        "       <number_of_intervals>60 40</number_of_intervals>"
+        "       <relative_tolerance>1.e-6</relative_tolerance>"
+        "   </tabulation>"
+        "</density>";
+    const auto rho = createTestFluidDensityModel(xml);
+    const auto rho_tabulated = createTestFluidDensityModel(xml_tabulated);
+
+    ArrayType vars = {{473.15, 4.e+7}};
+    const double rho_expected = 890.943136237744;
+    ASSERT_NEAR(rho_expected, rho_tabulated->getValue(vars), 1.e-4);
+
+    ASSERT_NEAR(rho->getdValue(vars, PropertyVariableType::T),
+                rho_tabulated->getdValue(vars, PropertyVariableType::T),
+                1.e-4);
+    ASSERT_NEAR(rho->getdValue(vars, PropertyVariableType::p),
+                rho_tabulated->getdValue(vars, PropertyVariableType::p),
+                1.e-11);
+
+    // Outside of the table the exact model is evaluated.
+    vars = {{593.15, 4.e+7}};
+    ASSERT_EQ(rho->getValue(vars), rho_tabulated->getValue(vars));
+}
@@ -173,3 +173,59 @@ TEST(Material, checkWaterViscosityIAPWS)
         ASSERT_NEAR((mu1 - mu) / perturbation, dmu_drho, 1.e-7);
     }
 }
+
+TEST(Material, checkTabulatedWaterViscosityIAPWS)
+{
+    const char xml_w[] =
+        "<viscosity>"
+        "  <type>WaterViscosityIAPWS</type>"
+        "</viscosity>";
+    const char xml_tabulated[] =
+        "<viscosity>"
+        "  <type>WaterViscosityIAPWS</type>"
+        "  <tabulation>"
+        "    <temperature_range>280 500</temperature_range>"
+        "    <density_range>800 1050</density_range>"
+        "    <number_of_intervals>200 20</number_of_intervals>"
+        "    <relative_tolerance>1.e-6</relative_tolerance>"
+        "  </tabulation>"
+        "</viscosity>";
+
+    const auto mu_w = createTestViscosityModel(xml_w);
+    const auto mu_tabulated = createTestViscosityModel(xml_tabulated);
+
+    const double perturbation = 1.e-4;
+    ArrayType vars;
+    // Points inside of the table and, the last one, outside of it.
+    const double T[] = {280, 293.15, 313.7, 377.77, 499.9, 600};
+    const double rho[] = {1050, 998, 925.3, 880.1, 800, 700};
+    for (int i = 0; i < 6; i++)
+    {
+        vars[static_cast<unsigned>(PropertyVariableType::T)] = T[i];
+        vars[static_cast<unsigned>(PropertyVariableType::rho)] = rho[i];
+        const double mu = mu_tabulated->getValue(vars);
+        ASSERT_NEAR(mu_w->getValue(vars), mu, 1.e-6 * mu);
+
+        const double dmu_dT =
+            mu_tabulated->getdValue(vars, PropertyVariableType::T);
+        const double dmu_drho =
+            mu_tabulated->getdValue(vars, PropertyVariableType::rho);
+        ASSERT_NEAR(mu_w->getdValue(vars, PropertyVariableType::T), dmu_dT,
+                    1.e-4 * std::abs(dmu_dT));
+        ASSERT_NEAR(mu_w->getdValue(vars, PropertyVariableType::rho),
+                    dmu_drho, 1.e-4 * std::abs(dmu_drho));
+
+        // The derivatives are consistent with the interpolated values.
+        vars[static_cast<unsigned>(PropertyVariableType::T)] =
+            T[i] - perturbation;
+        const double mu1 = mu_tabulated->getValue(vars);
+        ASSERT_NEAR((mu - mu1) / perturbation, dmu_dT,
+                    1.e-4 * std::abs(dmu_dT));
+        vars[static_cast<unsigned>(PropertyVariableType::T)] = T[i];
+        vars[static_cast<unsigned>(PropertyVariableType::rho)] =
+            rho[i] - perturbation;
+        const double mu2 = mu_tabulated->getValue(vars);
+        ASSERT_NEAR((mu - mu2) / perturbation, dmu_drho,
+                    1.e-4 * std::abs(dmu_drho));
+    }
+}
@@ -0,0 +1,52 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "Tests/TestTools.h"
+
+#include "MaterialLib/Adsorption/ReactionCaOH2.h"
+
+// The reaction rates evaluated concurrently, as in the concurrent assembly of
+// the TES process, equal the ones evaluated sequentially.
+TEST(MaterialLibAdsorption, ReactionCaOH2ConcurrentEvaluation)
+{
+    const char xml[] =
+        "<reaction>"
+        "   <ode_solver_config>"
+        "       <type>BackwardEuler</type>"
+        "   </ode_solver_config>"
+        "</reaction>";
+    auto const ptree = readXml(xml);
+    BaseLib::ConfigTree conf(ptree, "", BaseLib::ConfigTree::onerror,
+                             BaseLib::ConfigTree::onwarning);
+    Adsorption::ReactionCaOH2 reaction(conf.getConfigSubtree("reaction"));
+
+    OPENMP_LOOP_TYPE const n = 10000;
+    auto const evaluate = [&reaction, n](OPENMP_LOOP_TYPE const i) {
+        double const s = static_cast<double>(i) / n;
+        reaction.updateParam(550.0 + 200.0 * s, 1e5 * (1.0 + s),
+                             0.1 + 0.8 * s, 1700.0 + 450.0 * s);
+        return reaction.getReactionRate(2150.0 - 450.0 * s);
+    };
+
+    std::vector<double> expected(n);
+    for (OPENMP_LOOP_TYPE i = 0; i < n; ++i)
+        expected[i] = evaluate(i);
+
+    std::vector<double> rates(n);
+#pragma omp parallel for
+    for (OPENMP_LOOP_TYPE i = 0; i < n; ++i)
+        rates[i] = evaluate(i);
+
+    for (OPENMP_LOOP_TYPE i = 0; i < n; ++i)
+        EXPECT_EQ(expected[i], rates[i]);
+}
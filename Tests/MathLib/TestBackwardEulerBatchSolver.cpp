@@ -0,0 +1,66 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "MathLib/ODE/BackwardEulerBatchSolver.h"
+
+TEST(MathLibBackwardEulerBatchSolver, ExponentialDecay)
+{
+    MathLib::ODE::BackwardEulerBatchSolver const solver(1e-10, 1e-8);
+
+    // y_i' = -k_i y_i with a different decay rate for each equation
+    std::vector<double> const k{0.1, 1.0, 15.0, 100.0};
+    auto const f = [&k](std::size_t const i, double const y) {
+        return -k[i] * y;
+    };
+
+    std::vector<double> y{1.0, 2.0, 3.0, 4.0};
+    std::vector<double> const y0 = y;
+    std::vector<double> ydot;
+
+    double const t_end = 0.3;
+    solver.solve(f, t_end, y, ydot);
+
+    ASSERT_EQ(y.size(), ydot.size());
+    for (std::size_t i = 0; i < y.size(); ++i)
+    {
+        double const y_exact = y0[i] * std::exp(-k[i] * t_end);
+        EXPECT_NEAR(y_exact, y[i], 1e-6 * y0[i]);
+        EXPECT_DOUBLE_EQ(-k[i] * y[i], ydot[i]);
+    }
+}
+
+TEST(MathLibBackwardEulerBatchSolver, NonlinearGrowth)
+{
+    MathLib::ODE::BackwardEulerBatchSolver const solver(1e-10, 1e-8);
+
+    // logistic growth y' = y (1 - y) with the solution
+    // y(t) = 1 / (1 + (1/y0 - 1) exp(-t))
+    auto const f = [](std::size_t const, double const y) {
+        return y * (1.0 - y);
+    };
+
+    std::vector<double> y{0.1, 0.5, 0.9};
+    std::vector<double> const y0 = y;
+    std::vector<double> ydot;
+
+    double const t_end = 2.0;
+    solver.solve(f, t_end, y, ydot);
+
+    for (std::size_t i = 0; i < y.size(); ++i)
+    {
+        double const y_exact =
+            1.0 / (1.0 + (1.0 / y0[i] - 1.0) * std::exp(-t_end));
+        EXPECT_NEAR(y_exact, y[i], 1e-6);
+    }
+}
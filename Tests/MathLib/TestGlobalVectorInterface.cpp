@@ -13,6 +13,8 @@
  *
  */
 
+#include <memory>
+
 #include <gtest/gtest.h>
 #include "Tests/TestTools.h"
 
@@ -75,6 +77,13 @@ void checkGlobalVectorInterface()
     ASSERT_EQ(3.0, y.get(0));
     ASSERT_EQ(0.0, y.get(1));
     ASSERT_EQ(1.0, y.get(3));
+
+    // get into a preallocated buffer
+    std::vector<double> local_y(5, -1.0);
+    y.get(vec_pos, local_y);
+    ASSERT_EQ(2u, local_y.size());
+    ASSERT_EQ(3.0, local_y[0]);
+    ASSERT_EQ(1.0, local_y[1]);
 }
 
 #ifdef USE_PETSC
@@ -265,6 +274,75 @@ void checkGlobalVectorInterfacePETSc()
     {
          ASSERT_EQ(expected[i], loc_v1[i]);
     }
+
+    // Direct access to the local form. Ghost entries are addressed by their
+    // negated global indices, the global index 0 by the negated vector size.
+    {
+        MathLib::LinAlg::ScopedLocalAccess<T_VECTOR> const local_access(
+            {&x_with_ghosts});
+        for (std::size_t i=0; i<expected.size(); i++)
+        {
+            ASSERT_EQ(expected[i], x_with_ghosts.getLocalValue(i));
+        }
+
+        std::vector<GlobalIndexType> indices(non_ghost_ids);
+        for (auto const id : ghost_ids)
+            indices.push_back(id == 0 ? -12 : -id);
+        std::vector<double> local_x;
+        x_with_ghosts.get(indices, local_x);
+        ASSERT_EQ(expected, local_x);
+    }
+
+    // Local access to a vector and its copies at once, also nested.
+    T_VECTOR x_doubled(x_with_ghosts);
+    scale(x_doubled, 2.0);
+    T_VECTOR x_negated(x_with_ghosts, false);
+    copy(x_with_ghosts, x_negated);
+    scale(x_negated, -1.0);
+    for (int nested = 0; nested < 2; ++nested)
+    {
+        MathLib::LinAlg::ScopedLocalAccess<T_VECTOR> const local_access(
+            {&x_with_ghosts, &x_doubled, &x_negated});
+        std::unique_ptr<MathLib::LinAlg::ScopedLocalAccess<T_VECTOR>>
+            nested_access;
+        if (nested)
+            nested_access.reset(
+                new MathLib::LinAlg::ScopedLocalAccess<T_VECTOR>(
+                    {&x_negated, &x_doubled}));
+        // All entries are readable, regardless of the order of reading.
+        for (std::size_t i = expected.size(); i-- > 0;)
+        {
+            ASSERT_EQ(-expected[i], x_negated.getLocalValue(i));
+            ASSERT_EQ(2 * expected[i], x_doubled.getLocalValue(i));
+            ASSERT_EQ(expected[i], x_with_ghosts.getLocalValue(i));
+        }
+    }
+
+    // Split-phase update of the ghost entries of a copy, whose ghost entries
+    // are outdated after scaling: the owned entries are read while the update
+    // is in flight, the ghost entries after it is finished. The local access
+    // to another copy is begun before, since the copies share the scatter
+    // context of the update.
+    {
+        T_VECTOR x_tripled(x_with_ghosts);
+        scale(x_tripled, 3.0);
+        MathLib::LinAlg::ScopedLocalAccess<T_VECTOR> const local_access(
+            {&x_doubled});
+        MathLib::LinAlg::beginGhostUpdate(x_tripled);
+        MathLib::LinAlg::ScopedLocalAccess<T_VECTOR> const tripled_access(
+            {&x_tripled});
+        std::size_t const n_owned = x_tripled.getLocalSize();
+        for (std::size_t i = 0; i < n_owned; ++i)
+        {
+            ASSERT_EQ(3 * expected[i], x_tripled.getLocalValue(i));
+        }
+        MathLib::LinAlg::finishGhostUpdate(x_tripled);
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            ASSERT_EQ(3 * expected[i], x_tripled.getLocalValue(i));
+            ASSERT_EQ(2 * expected[i], x_doubled.getLocalValue(i));
+        }
+    }
 }
 #endif
 
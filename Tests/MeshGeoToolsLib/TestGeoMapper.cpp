@@ -86,3 +86,45 @@ TEST_F(MeshGeoToolsLibGeoMapper, PointsOnSurfaceMesh)
         gtest_reporter);
 }
 
+// Points are mapped onto a surface mesh of the plane z = 1 + 2x - 3y. The
+// elevation is interpolated linearly within the surface elements, such that the
+// mapped points are exactly on the plane. Points outside of the mesh are not
+// modified.
+TEST_F(MeshGeoToolsLibGeoMapper, PointsOnPlanarSurfaceMesh)
+{
+    auto plane = [](double x, double y) { return 1.0 + 2.0 * x - 3.0 * y; };
+    std::unique_ptr<MeshLib::Mesh> const surface_mesh(
+        MeshLib::MeshGenerator::createSurfaceMesh(
+            "Plane", MathLib::Point3d{{{0.0, 0.0, 0.0}}},
+            MathLib::Point3d{{{1.0, 1.0, 0.0}}}, {{7, 5}}, plane));
+
+    GeoLib::GEOObjects geo_obj;
+    std::string geo_name("TestGeoMapperPlane");
+    auto points = std::unique_ptr<std::vector<GeoLib::Point*>>(
+        new std::vector<GeoLib::Point*>);
+    for (std::size_t i(0); i <= 20; ++i)
+        for (std::size_t j(0); j <= 20; ++j)
+            points->push_back(
+                new GeoLib::Point(0.05 * i, 0.05 * j, (i + j) % 3 - 1.0));
+    points->push_back(new GeoLib::Point(1.5, 0.5, 7.0));
+    points->push_back(new GeoLib::Point(0.5, -0.5, 7.0));
+    geo_obj.addPointVec(std::move(points), geo_name);
+    MeshGeoToolsLib::GeoMapper geo_mapper(geo_obj, geo_name);
+
+    geo_mapper.mapOnMesh(surface_mesh.get());
+
+    auto const& mapped_points(*geo_obj.getPointVec(geo_name));
+    ASSERT_EQ(21u * 21u + 2u, mapped_points.size());
+    for (auto const* pnt : mapped_points)
+    {
+        GeoLib::Point const& p(*pnt);
+        if (0.0 <= p[0] && p[0] <= 1.0 && 0.0 <= p[1] && p[1] <= 1.0)
+        {
+            EXPECT_NEAR(plane(p[0], p[1]), p[2], 1e-12) << p;
+        }
+        else
+        {
+            EXPECT_EQ(7.0, p[2]) << p;
+        }
+    }
+}
@@ -0,0 +1,126 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <numeric>
+
+#include "gtest/gtest.h"
+
+#include "BaseLib/BuildInfo.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/IO/Binary/BinaryMeshIO.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshGenerators/QuadraticeMeshGenerator.h"
+#include "MeshLib/Node.h"
+
+class BinaryMeshIO : public ::testing::Test
+{
+public:
+    BinaryMeshIO()
+    {
+        std::unique_ptr<MeshLib::Mesh> linear_mesh(
+            MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 8));
+        _mesh = MeshLib::createQuadraticOrderMesh(*linear_mesh);
+
+        auto& properties = _mesh->getProperties();
+        auto* const point_doubles = properties.createNewPropertyVector<double>(
+            "PointDoubleProperty", MeshLib::MeshItemType::Node, 3);
+        point_doubles->resize(3 * _mesh->getNumberOfNodes());
+        std::iota(point_doubles->begin(), point_doubles->end(), 0.25);
+
+        auto* const material_ids = properties.createNewPropertyVector<int>(
+            "MaterialIDs", MeshLib::MeshItemType::Cell, 1);
+        material_ids->resize(_mesh->getNumberOfElements());
+        std::iota(material_ids->begin(), material_ids->end(), -2);
+
+        auto* const field_chars =
+            properties.createNewPropertyVector<unsigned char>(
+                "FieldCharProperty", MeshLib::MeshItemType::IntegrationPoint,
+                1);
+        field_chars->resize(13);
+        std::iota(field_chars->begin(), field_chars->end(), 'a');
+    }
+
+    ~BinaryMeshIO() { std::remove(_file_name.c_str()); }
+
+    template <typename T>
+    void checkPropertyVector(MeshLib::Mesh const& mesh,
+                             std::string const& name) const
+    {
+        auto const& properties = _mesh->getProperties();
+        auto const& new_properties = mesh.getProperties();
+        ASSERT_TRUE(new_properties.existsPropertyVector<T>(name));
+        auto const* const p = properties.getPropertyVector<T>(name);
+        auto const* const new_p = new_properties.getPropertyVector<T>(name);
+        ASSERT_EQ(p->getMeshItemType(), new_p->getMeshItemType());
+        ASSERT_EQ(p->getNumberOfComponents(), new_p->getNumberOfComponents());
+        ASSERT_TRUE(static_cast<std::vector<T> const&>(*p) ==
+                    static_cast<std::vector<T> const&>(*new_p));
+    }
+
+protected:
+    std::unique_ptr<MeshLib::Mesh> _mesh;
+    std::string const _file_name =
+        BaseLib::BuildInfo::tests_tmp_path + "BinaryMeshIO.bmsh";
+};
+
+TEST_F(BinaryMeshIO, Roundtrip)
+{
+    ASSERT_TRUE(
+        MeshLib::IO::BinaryMeshIO::writeMeshToFile(*_mesh, _file_name));
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::IO::BinaryMeshIO::readMeshFromFile(_file_name));
+    ASSERT_TRUE(mesh != nullptr);
+
+    ASSERT_EQ(_mesh->getName(), mesh->getName());
+    ASSERT_EQ(_mesh->getNumberOfBaseNodes(), mesh->getNumberOfBaseNodes());
+    ASSERT_EQ(_mesh->getNumberOfNodes(), mesh->getNumberOfNodes());
+    for (std::size_t i = 0; i < _mesh->getNumberOfNodes(); ++i)
+        for (std::size_t c = 0; c < 3; ++c)
+            ASSERT_EQ((*_mesh->getNode(i))[c], (*mesh->getNode(i))[c]);
+
+    ASSERT_EQ(_mesh->getNumberOfElements(), mesh->getNumberOfElements());
+    for (std::size_t i = 0; i < _mesh->getNumberOfElements(); ++i)
+    {
+        auto const& e = *_mesh->getElement(i);
+        auto const& new_e = *mesh->getElement(i);
+        ASSERT_EQ(e.getCellType(), new_e.getCellType());
+        for (unsigned k = 0; k < e.getNumberOfNodes(); ++k)
+            ASSERT_EQ(e.getNodeIndex(k), new_e.getNodeIndex(k));
+    }
+
+    checkPropertyVector<double>(*mesh, "PointDoubleProperty");
+    checkPropertyVector<int>(*mesh, "MaterialIDs");
+    checkPropertyVector<unsigned char>(*mesh, "FieldCharProperty");
+}
+
+TEST_F(BinaryMeshIO, TruncatedFile)
+{
+    ASSERT_TRUE(
+        MeshLib::IO::BinaryMeshIO::writeMeshToFile(*_mesh, _file_name));
+
+    std::string content;
+    {
+        std::ifstream in(_file_name, std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(in),
+                       std::istreambuf_iterator<char>());
+    }
+    {
+        std::ofstream out(_file_name, std::ios::binary);
+        out.write(content.data(), content.size() - 16);
+    }
+
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::IO::BinaryMeshIO::readMeshFromFile(_file_name));
+    ASSERT_TRUE(mesh == nullptr);
+}
@@ -0,0 +1,51 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/LICENSE.txt
+ */
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshEditing/Mesh2MeshPropertyInterpolation.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/PropertyVector.h"
+
+// The destination mesh is finer than the source mesh, such that all but one
+// destination element do not contain any source node. The values of these
+// elements are interpolated from the source node values at the element centers.
+// The source property 1 in the left half and 3 in the right half of the unit
+// square yields the source node values 1 + 2x, which are interpolated exactly.
+TEST(MeshLibMesh2MeshPropertyInterpolation, DestinationMeshFinerThanSource)
+{
+    std::unique_ptr<MeshLib::Mesh> const src_mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 2));
+    std::string const property_name("MaterialValue");
+    auto* const src_properties =
+        src_mesh->getProperties().createNewPropertyVector<double>(
+            property_name, MeshLib::MeshItemType::Cell, 1);
+    for (auto const* element : src_mesh->getElements())
+        src_properties->push_back(
+            element->getCenterOfGravity()[0] < 0.5 ? 1.0 : 3.0);
+
+    std::unique_ptr<MeshLib::Mesh> dest_mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(
+            0.8, 7, MathLib::Point3d{{{0.1, 0.1, 0.0}}}));
+
+    MeshLib::Mesh2MeshPropertyInterpolation const interpolation(*src_mesh,
+                                                                property_name);
+    ASSERT_TRUE(interpolation.setPropertiesForMesh(*dest_mesh));
+
+    auto const* const dest_properties =
+        dest_mesh->getProperties().getPropertyVector<double>(property_name);
+    ASSERT_EQ(dest_mesh->getNumberOfElements(), dest_properties->size());
+    for (auto const* element : dest_mesh->getElements())
+        EXPECT_NEAR(1.0 + 2.0 * element->getCenterOfGravity()[0],
+                    (*dest_properties)[element->getID()], 1e-12);
+}
@@ -0,0 +1,133 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cmath>
+#include <memory>
+#include <random>
+
+#include "gtest/gtest.h"
+
+#include "MathLib/Point3d.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshSearch/MeshElementGrid.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+// Creates random points in the box [min, max]^3.
+std::vector<MathLib::Point3d> createRandomPoints(double const min,
+                                                 double const max)
+{
+    std::mt19937 gen(0);
+    std::uniform_real_distribution<double> coordinate(min, max);
+    std::vector<MathLib::Point3d> pnts;
+    for (std::size_t k(0); k < 2000; ++k)
+        pnts.push_back(MathLib::Point3d{
+            {{coordinate(gen), coordinate(gen), coordinate(gen)}}});
+    return pnts;
+}
+
+std::vector<MathLib::Point3d const*> getPointers(
+    std::vector<MathLib::Point3d> const& pnts)
+{
+    std::vector<MathLib::Point3d const*> pnt_ptrs;
+    for (auto const& p : pnts)
+        pnt_ptrs.push_back(&p);
+    return pnt_ptrs;
+}
+}  // namespace
+
+// The elements found in the projection to the x-y plane are compared with
+// testing all elements. The interpolated node elevations approximate the
+// surface function.
+TEST(MeshLibMeshElementGrid, SurfaceMeshXY)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::createSurfaceMesh(
+            "Test", MathLib::Point3d{{{0.0, 0.0, 0.0}}},
+            MathLib::Point3d{{{1.0, 1.0, 0.0}}}, {{110, 60}},
+            [](double x, double y) { return std::cos(x + y); }));
+    MeshLib::MeshElementGrid const grid(*mesh);
+    auto const pnts(createRandomPoints(-0.1, 1.1));
+
+    std::vector<double> elevations;
+    for (auto const* node : mesh->getNodes())
+        elevations.push_back((*node)[2]);
+    double const outside(-100.0);
+    std::vector<double> const interpolated(
+        grid.interpolateNodeValuesXY(getPointers(pnts), elevations, outside));
+    ASSERT_EQ(pnts.size(), interpolated.size());
+
+    std::array<double, 4> weights;
+    for (std::size_t k(0); k < pnts.size(); ++k)
+    {
+        MathLib::Point3d const& p(pnts[k]);
+        bool in_mesh(false);
+        for (auto const* element : mesh->getElements())
+            in_mesh = in_mesh ||
+                      MeshLib::computeInterpolationWeightsXY(p, *element,
+                                                             weights);
+
+        auto const* element(grid.findElementContainingPointXY(p, weights));
+        ASSERT_EQ(in_mesh, element != nullptr) << p;
+        if (!in_mesh)
+        {
+            EXPECT_EQ(outside, interpolated[k]);
+            continue;
+        }
+        EXPECT_NEAR(1.0, weights[0] + weights[1] + weights[2] + weights[3],
+                    1e-12);
+        EXPECT_NEAR(std::cos(p[0] + p[1]), interpolated[k], 1e-3);
+        EXPECT_EQ(interpolated[k],
+                  grid.interpolateNodeValuesXY(p, elevations, outside));
+    }
+}
+
+// Linear functions are interpolated exactly in quad elements.
+TEST(MeshLibMeshElementGrid, QuadMeshLinearFunction)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(2.0, 1.0, 40, 7));
+    MeshLib::MeshElementGrid const grid(*mesh);
+    auto const pnts(createRandomPoints(0.0, 1.0));
+
+    auto f = [](MathLib::Point3d const& p) { return 2.0 * p[0] - 3.0 * p[1]; };
+    std::vector<double> node_values;
+    for (auto const* node : mesh->getNodes())
+        node_values.push_back(f(*node));
+    std::vector<double> const interpolated(
+        grid.interpolateNodeValuesXY(getPointers(pnts), node_values, 0.0));
+    for (std::size_t k(0); k < pnts.size(); ++k)
+        EXPECT_NEAR(f(pnts[k]), interpolated[k], 1e-12);
+}
+
+// The elements found for points in a 3d mesh contain the points.
+TEST(MeshLibMeshElementGrid, HexMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 10));
+    MeshLib::MeshElementGrid const grid(*mesh);
+    auto const pnts(createRandomPoints(-0.1, 1.1));
+
+    auto const elements(grid.findElementsContainingPoints(getPointers(pnts)));
+    ASSERT_EQ(pnts.size(), elements.size());
+    for (std::size_t k(0); k < pnts.size(); ++k)
+    {
+        MathLib::Point3d const& p(pnts[k]);
+        bool const in_mesh(0.0 <= p[0] && p[0] <= 1.0 && 0.0 <= p[1] &&
+                           p[1] <= 1.0 && 0.0 <= p[2] && p[2] <= 1.0);
+        ASSERT_EQ(in_mesh, elements[k] != nullptr) << p;
+        if (in_mesh)
+        {
+            EXPECT_TRUE(elements[k]->isPntInElement(p));
+        }
+    }
+}
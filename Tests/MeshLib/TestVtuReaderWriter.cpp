@@ -0,0 +1,255 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cstdio>
+#include <memory>
+#include <numeric>
+
+#include "gtest/gtest.h"
+
+#include <vtkBitArray.h>
+#include <vtkFloatArray.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkSignedCharArray.h>
+#include <vtkSmartPointer.h>
+#include <vtkUnstructuredGrid.h>
+#include <vtkXMLUnstructuredGridWriter.h>
+
+#include "BaseLib/BuildInfo.h"
+#include "MeshLib/Elements/Elements.h"
+#include "MeshLib/IO/VtkIO/VtuReader.h"
+#include "MeshLib/IO/VtkIO/VtuWriter.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/Vtk/VtkMappedMeshSource.h"
+
+// Creates a mesh of linear and quadratic elements of different types with
+// node, cell and integration point properties.
+class VtuReaderWriter : public ::testing::Test
+{
+public:
+    VtuReaderWriter()
+    {
+        // The elements do not share nodes.
+        std::vector<MeshLib::Node*> nodes;
+        for (std::size_t i = 0; i < 38; ++i)
+            nodes.push_back(new MeshLib::Node(0.5 * i, 1.0 / (i + 1), -1.0 * i,
+                                              i));
+
+        std::size_t next_node = 0;
+        auto element_nodes = [&](unsigned const n) {
+            auto** const e = new MeshLib::Node*[n];
+            for (unsigned k = 0; k < n; ++k)
+                e[k] = nodes[next_node++];
+            return e;
+        };
+
+        std::vector<MeshLib::Element*> elements;
+        elements.push_back(new MeshLib::Line(element_nodes(2)));
+        elements.push_back(new MeshLib::Tri(element_nodes(3)));
+        elements.push_back(new MeshLib::Quad(element_nodes(4)));
+        elements.push_back(new MeshLib::Prism(element_nodes(6)));
+        elements.push_back(new MeshLib::Hex(element_nodes(8)));
+        // The non-linear nodes are numbered last.
+        elements.push_back(new MeshLib::Prism15(element_nodes(15)));
+
+        _mesh.reset(new MeshLib::Mesh("VtuReaderWriter", nodes, elements));
+
+        auto& properties = _mesh->getProperties();
+        auto* const point_doubles = properties.createNewPropertyVector<double>(
+            "PointDoubleProperty", MeshLib::MeshItemType::Node, 3);
+        point_doubles->resize(3 * _mesh->getNumberOfNodes());
+        std::iota(point_doubles->begin(), point_doubles->end(), 0.25);
+
+        auto* const material_ids = properties.createNewPropertyVector<int>(
+            "MaterialIDs", MeshLib::MeshItemType::Cell, 1);
+        material_ids->resize(_mesh->getNumberOfElements());
+        std::iota(material_ids->begin(), material_ids->end(), -2);
+
+        auto* const cell_unsigned =
+            properties.createNewPropertyVector<unsigned>(
+                "CellUnsignedProperty", MeshLib::MeshItemType::Cell, 1);
+        cell_unsigned->resize(_mesh->getNumberOfElements());
+        std::iota(cell_unsigned->begin(), cell_unsigned->end(), 7u);
+
+        auto* const point_sizes =
+            properties.createNewPropertyVector<std::size_t>(
+                "PointSizeProperty", MeshLib::MeshItemType::Node, 1);
+        point_sizes->resize(_mesh->getNumberOfNodes());
+        std::iota(point_sizes->begin(), point_sizes->end(),
+                  std::size_t{4000000000u});
+
+        auto* const field_doubles = properties.createNewPropertyVector<double>(
+            "FieldDoubleProperty", MeshLib::MeshItemType::IntegrationPoint, 2);
+        field_doubles->resize(2 * 100000);
+        std::iota(field_doubles->begin(), field_doubles->end(), 1.5);
+    }
+
+    template <typename T>
+    void checkPropertyVector(MeshLib::Mesh const& mesh,
+                             std::string const& name) const
+    {
+        auto const& properties = _mesh->getProperties();
+        auto const& new_properties = mesh.getProperties();
+        ASSERT_TRUE(new_properties.existsPropertyVector<T>(name));
+        auto const* const p = properties.getPropertyVector<T>(name);
+        auto const* const new_p = new_properties.getPropertyVector<T>(name);
+        ASSERT_EQ(p->getMeshItemType(), new_p->getMeshItemType());
+        ASSERT_EQ(p->getNumberOfComponents(), new_p->getNumberOfComponents());
+        ASSERT_EQ(p->size(), new_p->size());
+        for (std::size_t i = 0; i < p->size(); ++i)
+            ASSERT_EQ((*p)[i], (*new_p)[i]);
+    }
+
+    void checkMesh(MeshLib::Mesh const& mesh) const
+    {
+        ASSERT_EQ(_mesh->getNumberOfNodes(), mesh.getNumberOfNodes());
+        for (std::size_t i = 0; i < _mesh->getNumberOfNodes(); ++i)
+            for (std::size_t c = 0; c < 3; ++c)
+                ASSERT_EQ((*_mesh->getNode(i))[c], (*mesh.getNode(i))[c]);
+
+        ASSERT_EQ(_mesh->getNumberOfElements(), mesh.getNumberOfElements());
+        for (std::size_t i = 0; i < _mesh->getNumberOfElements(); ++i)
+        {
+            auto const& e = *_mesh->getElement(i);
+            auto const& new_e = *mesh.getElement(i);
+            ASSERT_EQ(e.getCellType(), new_e.getCellType());
+            for (unsigned k = 0; k < e.getNumberOfNodes(); ++k)
+                ASSERT_EQ(e.getNodeIndex(k), new_e.getNodeIndex(k));
+        }
+
+        checkPropertyVector<double>(mesh, "PointDoubleProperty");
+        checkPropertyVector<int>(mesh, "MaterialIDs");
+        checkPropertyVector<unsigned>(mesh, "CellUnsignedProperty");
+        checkPropertyVector<std::size_t>(mesh, "PointSizeProperty");
+        checkPropertyVector<double>(mesh, "FieldDoubleProperty");
+    }
+
+protected:
+    std::unique_ptr<MeshLib::Mesh> _mesh;
+};
+
+TEST_F(VtuReaderWriter, Roundtrip)
+{
+    using DataMode = MeshLib::IO::VtuWriter::DataMode;
+    std::string const file_name =
+        BaseLib::BuildInfo::tests_tmp_path + "VtuReaderWriter.vtu";
+
+    for (auto const data_mode :
+         {DataMode::Binary, DataMode::Appended, DataMode::AppendedRaw})
+    {
+        for (bool const compress : {false, true})
+        {
+            MeshLib::IO::VtuWriter writer(*_mesh, data_mode, compress);
+            ASSERT_TRUE(writer.writeToFile(file_name));
+
+            std::unique_ptr<MeshLib::Mesh> mesh(
+                MeshLib::IO::VtuReader::readVTUFile(file_name));
+            ASSERT_TRUE(mesh != nullptr);
+            checkMesh(*mesh);
+        }
+    }
+    std::remove(file_name.c_str());
+}
+
+// Files written by VTK in the binary and appended data modes with zlib
+// compression are read by the native reader.
+TEST_F(VtuReaderWriter, ReadVtkOutput)
+{
+    std::string const file_name =
+        BaseLib::BuildInfo::tests_tmp_path + "VtuReaderWriterVtk.vtu";
+
+    vtkNew<MeshLib::VtkMappedMeshSource> source;
+    source->SetMesh(_mesh.get());
+
+    for (int const data_mode : {vtkXMLWriter::Binary, vtkXMLWriter::Appended})
+    {
+        for (bool const encode : {true, false})
+        {
+            if (data_mode == vtkXMLWriter::Binary && !encode)
+                continue;
+
+            auto writer = vtkSmartPointer<vtkXMLUnstructuredGridWriter>::New();
+            writer->SetInputConnection(source->GetOutputPort());
+            writer->SetDataMode(data_mode);
+            writer->SetEncodeAppendedData(encode);
+            writer->SetCompressorTypeToZLib();
+            writer->SetFileName(file_name.c_str());
+            ASSERT_EQ(1, writer->Write());
+
+            std::unique_ptr<MeshLib::Mesh> mesh(
+                MeshLib::IO::VtuReader::readVTUFile(file_name));
+            ASSERT_TRUE(mesh != nullptr);
+            checkMesh(*mesh);
+        }
+    }
+    std::remove(file_name.c_str());
+}
+
+// The arrays of files written by VTK are converted as by the
+// MeshLib::VtkMeshConverter: bit arrays become bool property vectors; arrays
+// of unsupported types, e.g., Float32 or Int8, are skipped.
+TEST_F(VtuReaderWriter, ReadVtkArrayTypes)
+{
+    std::string const file_name =
+        BaseLib::BuildInfo::tests_tmp_path + "VtuReaderWriterTypes.vtu";
+
+    vtkNew<MeshLib::VtkMappedMeshSource> source;
+    source->SetMesh(_mesh.get());
+    source->Update();
+    vtkNew<vtkUnstructuredGrid> grid;
+    grid->DeepCopy(source->GetOutput());
+
+    vtkIdType const n_nodes = _mesh->getNumberOfNodes();
+    vtkNew<vtkBitArray> bits;
+    bits->SetName("PointBitProperty");
+    bits->SetNumberOfTuples(n_nodes);
+    vtkNew<vtkFloatArray> floats;
+    floats->SetName("PointFloatProperty");
+    floats->SetNumberOfTuples(n_nodes);
+    vtkNew<vtkSignedCharArray> signed_chars;
+    signed_chars->SetName("PointSignedCharProperty");
+    signed_chars->SetNumberOfTuples(n_nodes);
+    for (vtkIdType i = 0; i < n_nodes; ++i)
+    {
+        bits->SetValue(i, i % 3 == 0);
+        floats->SetValue(i, 0.5f * i);
+        signed_chars->SetValue(i, static_cast<signed char>(i));
+    }
+    grid->GetPointData()->AddArray(bits.GetPointer());
+    grid->GetPointData()->AddArray(floats.GetPointer());
+    grid->GetPointData()->AddArray(signed_chars.GetPointer());
+
+    for (int const data_mode : {vtkXMLWriter::Binary, vtkXMLWriter::Appended})
+    {
+        auto writer = vtkSmartPointer<vtkXMLUnstructuredGridWriter>::New();
+        writer->SetInputData(grid.GetPointer());
+        writer->SetDataMode(data_mode);
+        writer->SetCompressorTypeToZLib();
+        writer->SetFileName(file_name.c_str());
+        ASSERT_EQ(1, writer->Write());
+
+        std::unique_ptr<MeshLib::Mesh> mesh(
+            MeshLib::IO::VtuReader::readVTUFile(file_name));
+        ASSERT_TRUE(mesh != nullptr);
+        checkMesh(*mesh);
+
+        auto const& properties = mesh->getProperties();
+        ASSERT_TRUE(properties.existsPropertyVector<bool>("PointBitProperty"));
+        auto const& read_bits =
+            *properties.getPropertyVector<bool>("PointBitProperty");
+        ASSERT_EQ(static_cast<std::size_t>(n_nodes), read_bits.size());
+        for (vtkIdType i = 0; i < n_nodes; ++i)
+            ASSERT_EQ(i % 3 == 0, read_bits[i]);
+        ASSERT_FALSE(properties.hasPropertyVector("PointFloatProperty"));
+        ASSERT_FALSE(properties.hasPropertyVector("PointSignedCharProperty"));
+    }
+    std::remove(file_name.c_str());
+}
@@ -0,0 +1,67 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "NumLib/NumericsConfig.h"
+
+#ifndef USE_PETSC
+
+namespace
+{
+//! Coefficients \f$c_{ik}\f$ of the componentwise polynomials
+//! \f$x_i(t) = \sum_k c_{ik} t^k\f$.
+using PolynomialCoefficients = std::vector<std::vector<double>>;
+
+//! Evaluates the polynomials at time \c t.
+GlobalVector evaluatePolynomials(PolynomialCoefficients const& coefficients,
+                                 double const t)
+{
+    GlobalVector x(coefficients.size());
+    for (std::size_t i = 0; i < coefficients.size(); ++i)
+    {
+        double value = 0.0;
+        for (auto c = coefficients[i].rbegin(); c != coefficients[i].rend();
+             ++c)
+            value = value * t + *c;
+        x[i] = value;
+    }
+    return x;
+}
+
+//! Evaluates the time derivatives of the polynomials at time \c t.
+GlobalVector evaluatePolynomialDerivatives(
+    PolynomialCoefficients const& coefficients, double const t)
+{
+    GlobalVector x(coefficients.size());
+    for (std::size_t i = 0; i < coefficients.size(); ++i)
+    {
+        double value = 0.0;
+        for (std::size_t k = coefficients[i].size(); k-- > 1;)
+            value = value * t + k * coefficients[i][k];
+        x[i] = value;
+    }
+    return x;
+}
+
+void expectNear(GlobalVector const& expected, GlobalVector const& x,
+                double const tolerance)
+{
+    ASSERT_EQ(expected.size(), x.size());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+        EXPECT_NEAR(expected[i], x[i], tolerance);
+}
+}  // namespace
+
+#endif  // USE_PETSC
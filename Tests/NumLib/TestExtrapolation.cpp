@@ -7,12 +7,27 @@
  *
  */
 
+#include <algorithm>
+#include <cmath>
+
 #include <gtest/gtest.h>
 
+#include <Eigen/SVD>
+
+#include "BaseLib/Error.h"
+
 #include "MathLib/LinAlg/LinAlg.h"
 
+#include "MeshLib/Elements/Line.h"
+#include "MeshLib/Elements/Quad.h"
+#include "MeshLib/Elements/Tri.h"
+#include "MeshLib/Mesh.h"
 #include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
 #include "MeshLib/IO/writeMeshToFile.h"
+#ifdef USE_PETSC
+#include "MeshLib/NodePartitionedMesh.h"
+#endif
 
 #include "NumLib/DOF/DOFTableUtil.h"
 #include "NumLib/DOF/MatrixProviderUser.h"
@@ -24,6 +39,7 @@
 #include "NumLib/Function/Interpolation.h"
 #include "NumLib/NumericsConfig.h"
 
+#include "ProcessLib/ProcessOutput.h"
 #include "ProcessLib/Utils/LocalDataInitializer.h"
 #include "ProcessLib/Utils/CreateLocalAssemblers.h"
 #include "ProcessLib/Utils/InitShapeMatrices.h"
@@ -46,6 +62,104 @@ void interpolateNodalValuesToIntegrationPoints(
     }
 }
 
+// Creates a mesh of quads and pairs of triangles, whose nodes are shifted such
+// that the elements are not rectangular.
+MeshLib::Mesh* createMixedElementMesh()
+{
+    std::size_t const nx = 30;
+    std::size_t const ny = 20;
+    std::vector<MeshLib::Node*> nodes;
+    for (std::size_t j = 0; j <= ny; ++j)
+        for (std::size_t i = 0; i <= nx; ++i)
+            nodes.push_back(
+                new MeshLib::Node(i, j + 0.1 * i, 0.0, nodes.size()));
+    auto node = [&](std::size_t const i, std::size_t const j) {
+        return nodes[(nx + 1) * j + i];
+    };
+    std::vector<MeshLib::Element*> elements;
+    for (std::size_t j = 0; j < ny; ++j)
+    {
+        for (std::size_t i = 0; i < nx; ++i)
+        {
+            auto** const e = new MeshLib::Node*[4]{
+                node(i, j), node(i + 1, j), node(i + 1, j + 1),
+                node(i, j + 1)};
+            if ((i + j) % 3 != 0)
+            {
+                elements.push_back(new MeshLib::Quad(e));
+                continue;
+            }
+            elements.push_back(
+                new MeshLib::Tri(new MeshLib::Node*[3]{e[0], e[1], e[2]}));
+            elements.push_back(
+                new MeshLib::Tri(new MeshLib::Node*[3]{e[0], e[2], e[3]}));
+            delete[] e;
+        }
+    }
+    return new MeshLib::Mesh("MixedElements", nodes, elements);
+}
+
+// A constant per element, which depends on the position of its center only,
+// i.e., not on the element ids, which differ between a mesh and its partitions.
+double getElementShift(MathLib::Point3d const& center)
+{
+    return std::fmod(std::floor(3 * center[0] + 7 * center[1]), 5.0);
+}
+
+#ifdef USE_PETSC
+// Creates the partition of this rank of a line mesh of elements of unit
+// length. The ranks own contiguous ranges of the nodes, and the partition
+// contains all elements adjacent to its own nodes.
+MeshLib::NodePartitionedMesh* createLineMeshPartition(
+    std::size_t const n_elements)
+{
+    int rank;
+    MPI_Comm_rank(PETSC_COMM_WORLD, &rank);
+    int size;
+    MPI_Comm_size(PETSC_COMM_WORLD, &size);
+
+    std::size_t const n_nodes = n_elements + 1;
+    std::size_t const begin = n_nodes * rank / size;
+    std::size_t const end = n_nodes * (rank + 1) / size;
+
+    // The own nodes are followed by the ghost nodes.
+    std::vector<std::size_t> global_ids;
+    for (std::size_t i = begin; i < end; ++i)
+        global_ids.push_back(i);
+    if (begin > 0)
+        global_ids.push_back(begin - 1);
+    if (end < n_nodes)
+        global_ids.push_back(end);
+
+    std::vector<MeshLib::Node*> nodes;
+    for (std::size_t k = 0; k < global_ids.size(); ++k)
+        nodes.push_back(new MeshLib::Node(global_ids[k], 0.0, 0.0, k));
+    auto node = [&](std::size_t const global_id) {
+        return nodes[std::find(global_ids.begin(), global_ids.end(),
+                               global_id) -
+                     global_ids.begin()];
+    };
+
+    // The elements without ghost nodes come first.
+    std::vector<MeshLib::Element*> elements;
+    auto add_element = [&](std::size_t const left) {
+        elements.push_back(new MeshLib::Line(
+            new MeshLib::Node*[2]{node(left), node(left + 1)}));
+    };
+    for (std::size_t i = begin; i + 1 < end; ++i)
+        add_element(i);
+    if (begin > 0)
+        add_element(begin - 1);
+    if (end < n_nodes)
+        add_element(end - 1);
+
+    std::size_t const n_own = end - begin;
+    return new MeshLib::NodePartitionedMesh(
+        "LineMeshPartition", nodes, global_ids, elements,
+        MeshLib::Properties{}, n_nodes, n_nodes, nodes.size(), n_own, n_own);
+}
+#endif
+
 } // anonymous namespace
 
 class LocalAssemblerDataInterface : public NumLib::ExtrapolatableElement
@@ -59,6 +173,11 @@ public:
 
     virtual std::vector<double> const& getDerivedQuantity(
         std::vector<double>& cache) const = 0;
+
+    virtual std::vector<double> const& getElementwiseShiftedQuantity(
+        std::vector<double>& cache) const = 0;
+    virtual std::vector<double> const& getFailingQuantity(
+        std::vector<double>& cache) const = 0;
 };
 
 using IntegrationPointValuesMethod = std::vector<double> const& (
@@ -81,7 +200,9 @@ public:
                                             IntegrationMethod, GlobalDim>(
                   e, is_axially_symmetric,
                   IntegrationMethod{integration_order})),
-          _int_pt_values(_shape_matrices.size())
+          _int_pt_values(_shape_matrices.size()),
+          _element_id(e.getID()),
+          _shift(getElementShift(e.getCenterOfGravity()))
     {
     }
 
@@ -109,6 +230,27 @@ public:
         return cache;
     }
 
+    // The stored values shifted by a constant per element, i.e., not
+    // continuous between the elements.
+    std::vector<double> const& getElementwiseShiftedQuantity(
+        std::vector<double>& cache) const override
+    {
+        cache.clear();
+        for (auto value : _int_pt_values)
+            cache.push_back(value + _shift);
+        return cache;
+    }
+
+    // The stored values, except for one element failing to provide them.
+    std::vector<double> const& getFailingQuantity(
+        std::vector<double>& cache) const override
+    {
+        if (_element_id == 3)
+            OGS_FATAL("The values of element %zu are not available.",
+                      _element_id);
+        return getStoredQuantity(cache);
+    }
+
     void interpolateNodalValuesToIntegrationPoints(
         std::vector<double> const& local_nodal_values) override
     {
@@ -120,6 +262,8 @@ private:
     std::vector<ShapeMatrices, Eigen::aligned_allocator<ShapeMatrices>>
         _shape_matrices;
     std::vector<double> _int_pt_values;
+    std::size_t const _element_id;
+    double const _shift;
 };
 
 class TestProcess
@@ -131,7 +275,8 @@ public:
     using ExtrapolatorImplementation =
         NumLib::LocalLinearLeastSquaresExtrapolator;
 
-    TestProcess(MeshLib::Mesh const& mesh, unsigned const integration_order)
+    TestProcess(MeshLib::Mesh const& mesh, unsigned const integration_order,
+                bool const concurrent = false)
         : _integration_order(integration_order)
         , _mesh_subset_all_nodes(mesh, &mesh.getNodes())
     {
@@ -144,17 +289,27 @@ public:
 
         // Passing _dof_table works, because this process has only one variable
         // and the variable has exactly one component.
-        _extrapolator.reset(new ExtrapolatorImplementation(*_dof_table));
+        _extrapolator.reset(
+            new ExtrapolatorImplementation(*_dof_table, concurrent));
 
         // createAssemblers(mesh);
         ProcessLib::createLocalAssemblers<LocalAssemblerData>(
             mesh.getDimension(), mesh.getElements(), *_dof_table, 1,
-            _local_assemblers, mesh.isAxiallySymmetric(), _integration_order);
+            _local_assemblers, concurrent, mesh.isAxiallySymmetric(),
+            _integration_order);
+    }
+
+    NumLib::LocalToGlobalIndexMap const& getDOFTable() const
+    {
+        return *_dof_table;
     }
 
     void interpolateNodalValuesToIntegrationPoints(
         GlobalVector const& global_nodal_values) const
     {
+        MathLib::LinAlg::ScopedLocalAccess<GlobalVector> const local_access(
+            {&global_nodal_values});
+
         auto cb = [](std::size_t id, LocalAssembler& loc_asm,
                      NumLib::LocalToGlobalIndexMap const& dof_table,
                      GlobalVector const& x) {
@@ -181,7 +336,66 @@ public:
                 &_extrapolator->getElementResiduals()};
     }
 
+    // Solves the least squares problem in each element separately and averages
+    // the results at the nodes. Returns the nodal values and the residuals.
+    std::pair<std::vector<double>, std::vector<double>> extrapolateElementwise(
+        IntegrationPointValuesMethod method) const
+    {
+        auto const extrapolatables =
+            NumLib::makeExtrapolatable(_local_assemblers, method);
+
+        std::vector<double> nodal_values(_dof_table->dofSizeWithGhosts());
+        std::vector<double> counts(_dof_table->dofSizeWithGhosts());
+        std::vector<double> cache;
+        for (std::size_t e = 0; e < extrapolatables.size(); ++e)
+        {
+            auto const& values =
+                extrapolatables.getIntegrationPointValues(e, cache);
+            Eigen::MatrixXd const A = getInterpolationMatrix(e, values.size());
+            Eigen::VectorXd const local_nodal_values =
+                A.jacobiSvd(Eigen::ComputeThinU | Eigen::ComputeThinV)
+                    .solve(Eigen::Map<const Eigen::VectorXd>(values.data(),
+                                                             values.size()));
+            auto const& indices = (*_dof_table)(e, 0).rows;
+            for (std::size_t k = 0; k < indices.size(); ++k)
+            {
+                nodal_values[indices[k]] += local_nodal_values[k];
+                counts[indices[k]] += 1.0;
+            }
+        }
+        for (std::size_t i = 0; i < nodal_values.size(); ++i)
+            nodal_values[i] /= counts[i];
+
+        std::vector<double> residuals;
+        for (std::size_t e = 0; e < extrapolatables.size(); ++e)
+        {
+            auto const& values =
+                extrapolatables.getIntegrationPointValues(e, cache);
+            auto const& indices = (*_dof_table)(e, 0).rows;
+            Eigen::VectorXd local_nodal_values(indices.size());
+            for (std::size_t k = 0; k < indices.size(); ++k)
+                local_nodal_values[k] = nodal_values[indices[k]];
+            Eigen::VectorXd const difference =
+                getInterpolationMatrix(e, values.size()) * local_nodal_values -
+                Eigen::Map<const Eigen::VectorXd>(values.data(),
+                                                  values.size());
+            residuals.push_back(
+                std::sqrt(difference.squaredNorm() / values.size()));
+        }
+        return {nodal_values, residuals};
+    }
+
 private:
+    Eigen::MatrixXd getInterpolationMatrix(std::size_t const element_id,
+                                           std::size_t const num_int_pts) const
+    {
+        auto const& loc_asm = *_local_assemblers[element_id];
+        Eigen::MatrixXd A(num_int_pts, loc_asm.getShapeMatrix(0).size());
+        for (unsigned ip = 0; ip < num_int_pts; ++ip)
+            A.row(ip) = loc_asm.getShapeMatrix(ip);
+        return A;
+    }
+
     unsigned const _integration_order;
 
     MeshLib::MeshSubset _mesh_subset_all_nodes;
@@ -278,3 +492,204 @@ TEST(NumLib, DISABLED_Extrapolation)
                     *two_x, nnodes, nelements);
     }
 }
+
+#ifndef USE_PETSC
+TEST(NumLib, ExtrapolationMixedElements)
+#else
+TEST(NumLib, DISABLED_ExtrapolationMixedElements)
+#endif
+{
+    /* The elements of the mesh fall into two groups, triangles and quads,
+     * whose pseudo-inverses are applied to all elements of the group at once.
+     * The grouping is computed in the first extrapolation and reused for new
+     * nodal values. The concurrent extrapolation yields the same result.
+     */
+    std::unique_ptr<MeshLib::Mesh> const mesh(createMixedElementMesh());
+    auto const nnodes = mesh->getNumberOfNodes();
+    auto const nelements = mesh->getNumberOfElements();
+
+    TestProcess pcs(*mesh, 2);
+    TestProcess concurrent_pcs(*mesh, 2, true);
+
+    MathLib::MatrixSpecifications spec{nnodes, nnodes, nullptr, nullptr};
+    auto x = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(spec);
+    for (int k = 0; k < 3; ++k)
+    {
+        fillVectorRandomly(*x);
+        pcs.interpolateNodalValuesToIntegrationPoints(*x);
+        concurrent_pcs.interpolateNodalValuesToIntegrationPoints(*x);
+
+        extrapolate(pcs, &LocalAssemblerDataInterface::getStoredQuantity, *x,
+                    nnodes, nelements);
+
+        auto const result = pcs.extrapolate(
+            &LocalAssemblerDataInterface::getDerivedQuantity);
+        auto const concurrent_result = concurrent_pcs.extrapolate(
+            &LocalAssemblerDataInterface::getDerivedQuantity);
+        for (std::size_t i = 0; i < nnodes; ++i)
+            ASSERT_DOUBLE_EQ((*result.first)[i],
+                             (*concurrent_result.first)[i]);
+        for (std::size_t i = 0; i < nelements; ++i)
+            ASSERT_DOUBLE_EQ((*result.second)[i],
+                             (*concurrent_result.second)[i]);
+    }
+}
+
+#ifndef USE_PETSC
+TEST(NumLib, ExtrapolationElementwiseReference)
+#else
+TEST(NumLib, DISABLED_ExtrapolationElementwiseReference)
+#endif
+{
+    /* The integration point values are shifted by a constant per element, so
+     * the least squares solutions of neighbouring elements differ at the common
+     * nodes and the residuals do not vanish. The extrapolation applying the
+     * pseudo-inverses to the groups of elements yields the same nodal values
+     * and residuals as solving the least squares problem in each element.
+     */
+    std::unique_ptr<MeshLib::Mesh> const mesh(createMixedElementMesh());
+
+    MathLib::MatrixSpecifications spec{mesh->getNumberOfNodes(),
+                                       mesh->getNumberOfNodes(), nullptr,
+                                       nullptr};
+    auto x = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(spec);
+    fillVectorRandomly(*x);
+
+    for (bool const concurrent : {false, true})
+    {
+        TestProcess pcs(*mesh, 2, concurrent);
+        pcs.interpolateNodalValuesToIntegrationPoints(*x);
+
+        auto const method =
+            &LocalAssemblerDataInterface::getElementwiseShiftedQuantity;
+        auto const result = pcs.extrapolate(method);
+        auto const expected = pcs.extrapolateElementwise(method);
+
+        ASSERT_EQ(expected.first.size(), result.first->size());
+        for (std::size_t i = 0; i < expected.first.size(); ++i)
+            EXPECT_NEAR(expected.first[i], (*result.first)[i], 1e-12);
+
+        ASSERT_EQ(expected.second.size(), result.second->size());
+        double max_residual = 0;
+        for (std::size_t i = 0; i < expected.second.size(); ++i)
+        {
+            EXPECT_NEAR(expected.second[i], (*result.second)[i], 1e-12);
+            max_residual = std::max(max_residual, expected.second[i]);
+        }
+        // The test is not trivial.
+        EXPECT_LT(0.1, max_residual);
+    }
+}
+
+#ifndef USE_PETSC
+TEST(NumLib, ExtrapolationConcurrentError)
+#else
+TEST(NumLib, DISABLED_ExtrapolationConcurrentError)
+#endif
+{
+    /* An error of a single element during the concurrent extrapolation
+     * reaches the caller instead of terminating the program.
+     */
+    std::unique_ptr<MeshLib::Mesh> const mesh(createMixedElementMesh());
+
+    MathLib::MatrixSpecifications spec{mesh->getNumberOfNodes(),
+                                       mesh->getNumberOfNodes(), nullptr,
+                                       nullptr};
+    auto x = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(spec);
+    fillVectorRandomly(*x);
+
+    TestProcess pcs(*mesh, 2, true);
+    pcs.interpolateNodalValuesToIntegrationPoints(*x);
+
+    // The first extrapolation groups the elements one after another, the
+    // following ones gather the integration point values concurrently.
+    pcs.extrapolate(&LocalAssemblerDataInterface::getStoredQuantity);
+    EXPECT_THROW(
+        pcs.extrapolate(&LocalAssemblerDataInterface::getFailingQuantity),
+        std::runtime_error);
+}
+
+#ifdef USE_PETSC
+TEST(MPITest_NumLib, ExtrapolationPartitionedMesh)
+{
+    /* The integration point values are shifted by a constant per element, so
+     * the nodal averages at the partition boundaries depend on the elements of
+     * both partitions. Each rank extrapolates on its partition of a line mesh.
+     * The nodal values of the own and of the ghost nodes and the residuals,
+     * copied as for the output, equal those of a serial extrapolation, which
+     * are given in closed form.
+     */
+    std::size_t const n_elements = 30;
+    std::unique_ptr<MeshLib::NodePartitionedMesh> const mesh(
+        createLineMeshPartition(n_elements));
+
+    auto shift = [](std::size_t const left) {
+        return getElementShift(MathLib::Point3d{{left + 0.5, 0.0, 0.0}});
+    };
+    // Average of the shifts of the elements adjacent to a node.
+    auto mean_shift = [&](std::size_t const global_id) {
+        double sum = 0;
+        unsigned n = 0;
+        if (global_id > 0)
+        {
+            sum += shift(global_id - 1);
+            ++n;
+        }
+        if (global_id < n_elements)
+        {
+            sum += shift(global_id);
+            ++n;
+        }
+        return sum / n;
+    };
+
+    for (bool const concurrent : {false, true})
+    {
+        TestProcess pcs(*mesh, 2, concurrent);
+        auto const& dof_table = pcs.getDOFTable();
+
+        MathLib::MatrixSpecifications const spec{
+            dof_table.dofSizeWithoutGhosts(), dof_table.dofSizeWithoutGhosts(),
+            &dof_table.getGhostIndices(), nullptr};
+        auto x = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(spec);
+        for (std::size_t i = 0; i < mesh->getNumberOfNodes(); ++i)
+        {
+            if (mesh->isGhostNode(i))
+                continue;
+            auto const global_id = mesh->getGlobalNodeID(i);
+            x->set(global_id, std::sin(global_id));
+        }
+        MathLib::LinAlg::finalizeAssembly(*x);
+
+        pcs.interpolateNodalValuesToIntegrationPoints(*x);
+        auto const result = pcs.extrapolate(
+            &LocalAssemblerDataInterface::getElementwiseShiftedQuantity);
+
+        std::vector<double> node_values(mesh->getNumberOfNodes());
+        ProcessLib::copyNodalValues(*result.first, dof_table, node_values);
+        for (std::size_t i = 0; i < mesh->getNumberOfNodes(); ++i)
+        {
+            auto const global_id = mesh->getGlobalNodeID(i);
+            EXPECT_NEAR(std::sin(global_id) + mean_shift(global_id),
+                        node_values[i], 1e-12);
+        }
+
+        // The differences of the averaged and the element's nodal values are
+        // interpolated to the two integration points.
+        std::vector<double> residuals(mesh->getNumberOfElements());
+        ProcessLib::copyElementResiduals(*result.second, residuals);
+        double const a = (1 + 1 / std::sqrt(3.0)) / 2;
+        for (std::size_t e = 0; e < mesh->getNumberOfElements(); ++e)
+        {
+            auto const left =
+                mesh->getGlobalNodeID(mesh->getElement(e)->getNodeIndex(0));
+            double const d0 = mean_shift(left) - shift(left);
+            double const d1 = mean_shift(left + 1) - shift(left);
+            double const r0 = a * d0 + (1 - a) * d1;
+            double const r1 = (1 - a) * d0 + a * d1;
+            EXPECT_NEAR(std::sqrt((r0 * r0 + r1 * r1) / 2), residuals[e],
+                        1e-12);
+        }
+    }
+}
+#endif
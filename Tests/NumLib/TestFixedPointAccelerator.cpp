@@ -0,0 +1,126 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Core>
+
+#include "MathLib/LinAlg/LinAlg.h"
+#include "NumLib/ODESolver/FixedPointAccelerator.h"
+
+#ifndef USE_PETSC
+
+namespace
+{
+/// Linear fixed-point map G(x) = M x + c. The unknowns are split into two
+/// blocks of two entries each, like the solutions of two coupled processes.
+class LinearMap
+{
+public:
+    LinearMap()
+    {
+        _M << 0.9, 0.05, 0.0, 0.0,
+              0.05, 0.8, 0.1, 0.0,
+              0.0, 0.1, 0.8, 0.05,
+              0.0, 0.0, 0.05, 0.9;
+        _c << 1.0, -2.0, 0.5, 3.0;
+    }
+
+    /// Applies the map blockwise in Gauss-Seidel fashion, i.e., the second
+    /// block uses the already updated first block.
+    void apply(std::vector<GlobalVector*> const& x) const
+    {
+        Eigen::Vector4d y;
+        y << x[0]->getRawVector(), x[1]->getRawVector();
+        y.head<2>() = _M.topRows<2>() * y + _c.head<2>();
+        y.tail<2>() = _M.bottomRows<2>() * y + _c.tail<2>();
+        x[0]->getRawVector() = y.head<2>();
+        x[1]->getRawVector() = y.tail<2>();
+    }
+
+    Eigen::Vector4d fixedPoint() const
+    {
+        return (Eigen::Matrix4d::Identity() - _M).lu().solve(_c);
+    }
+
+private:
+    Eigen::Matrix4d _M;
+    Eigen::Vector4d _c;
+};
+
+/// Returns the number of iterations needed to reduce the fixed-point residual
+/// below the tolerance.
+unsigned iterate(LinearMap const& G, NumLib::FixedPointAccelerator* accelerator,
+                 Eigen::Vector4d& solution)
+{
+    GlobalVector x0(2), x1(2), r0(2), r1(2);
+    std::vector<GlobalVector*> const x{&x0, &x1};
+    std::vector<GlobalVector*> const r{&r0, &r1};
+    std::vector<GlobalVector const*> const residual{&r0, &r1};
+
+    if (accelerator)
+        accelerator->reset();
+
+    unsigned const max_iterations = 1000;
+    unsigned iteration = 1;
+    for (; iteration <= max_iterations; ++iteration)
+    {
+        for (std::size_t i = 0; i < x.size(); ++i)
+            MathLib::LinAlg::copy(*x[i], *r[i]);
+        G.apply(x);
+
+        double residual_norm = 0.0;
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            MathLib::LinAlg::aypx(*r[i], -1.0, *x[i]);
+            residual_norm += MathLib::LinAlg::dot(*r[i], *r[i]);
+        }
+        if (residual_norm < 1e-24)
+            break;
+
+        if (accelerator)
+            accelerator->accelerate(x, residual);
+    }
+
+    solution << x0.getRawVector(), x1.getRawVector();
+    return iteration;
+}
+}  // namespace
+
+TEST(NumLibFixedPointAccelerator, LinearMap)
+{
+    LinearMap const G;
+    auto const x_expected = G.fixedPoint();
+    Eigen::Vector4d x;
+
+    auto const n_plain = iterate(G, nullptr, x);
+    EXPECT_TRUE(x.isApprox(x_expected, 1e-9));
+
+    NumLib::AitkenRelaxation aitken(0.5);
+    auto const n_aitken = iterate(G, &aitken, x);
+    EXPECT_TRUE(x.isApprox(x_expected, 1e-9));
+    EXPECT_LT(n_aitken, n_plain);
+
+    NumLib::AndersonMixing anderson(4, 1.0);
+    auto const n_anderson = iterate(G, &anderson, x);
+    EXPECT_TRUE(x.isApprox(x_expected, 1e-9));
+    EXPECT_LT(n_anderson, n_aitken);
+
+    // The history is forgotten after a reset, the same number of iterations
+    // is needed again.
+    EXPECT_EQ(n_anderson, iterate(G, &anderson, x));
+
+    // A short history still accelerates the iteration.
+    NumLib::AndersonMixing anderson_short(1, 0.8);
+    auto const n_anderson_short = iterate(G, &anderson_short, x);
+    EXPECT_TRUE(x.isApprox(x_expected, 1e-9));
+    EXPECT_LT(n_anderson_short, n_plain);
+}
+
+#endif  // USE_PETSC
@@ -47,6 +47,94 @@ createLinearSolver()
 }
 #endif
 
+//! Implements the time discretized assembly of the wrapped ODE in terms of its
+//! global matrices \c M, \c K and vector \c b. The results must be the same
+//! as those obtained with the matrix translators.
+template <typename ODE>
+class TimeDiscretizedAssemblyODE final
+    : public NumLib::ODESystem<
+          NumLib::ODESystemTag::FirstOrderImplicitQuasilinear,
+          NumLib::NonlinearSolverTag::Newton>
+{
+public:
+    void assemble(const double t, GlobalVector const& x, GlobalMatrix& M,
+                  GlobalMatrix& K, GlobalVector& b,
+                  ProcessLib::StaggeredCouplingTerm const& coupling_term)
+        override
+    {
+        _ode.assemble(t, x, M, K, b, coupling_term);
+    }
+
+    void assembleWithJacobian(
+        const double t, GlobalVector const& x, GlobalVector const& xdot,
+        const double dxdot_dx, const double dx_dx, GlobalMatrix& M,
+        GlobalMatrix& K, GlobalVector& b, GlobalMatrix& Jac,
+        ProcessLib::StaggeredCouplingTerm const& coupling_term) override
+    {
+        _ode.assembleWithJacobian(t, x, xdot, dxdot_dx, dx_dx, M, K, b, Jac,
+                                  coupling_term);
+    }
+
+    bool hasTimeDiscretizedAssembly() const override { return true; }
+
+    void assembleTimeDiscretized(
+        const double t, GlobalVector const& x, const double dxdot_dx,
+        GlobalVector const& weighted_old_x, GlobalMatrix& A, GlobalVector& rhs,
+        ProcessLib::StaggeredCouplingTerm const& coupling_term) override
+    {
+        namespace LinAlg = MathLib::LinAlg;
+        auto M = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(
+            getMatrixSpecifications());
+
+        // K and b are assembled directly into A and rhs.
+        _ode.assemble(t, x, *M, A, rhs, coupling_term);
+        LinAlg::finalizeAssembly(*M);
+        LinAlg::finalizeAssembly(A);
+        LinAlg::finalizeAssembly(rhs);
+
+        LinAlg::axpy(A, dxdot_dx, *M);
+        LinAlg::matMultAdd(*M, weighted_old_x, rhs, rhs);
+    }
+
+    void assembleResidualWithJacobian(
+        const double t, GlobalVector const& x, GlobalVector const& xdot,
+        const double dxdot_dx, const double dx_dx, GlobalVector& res,
+        GlobalMatrix& Jac,
+        ProcessLib::StaggeredCouplingTerm const& coupling_term) override
+    {
+        namespace LinAlg = MathLib::LinAlg;
+        auto const& ms = getMatrixSpecifications();
+        auto M = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(ms);
+        auto K = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(ms);
+        auto b = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(ms);
+
+        _ode.assembleWithJacobian(t, x, xdot, dxdot_dx, dx_dx, *M, *K, *b, Jac,
+                                  coupling_term);
+        LinAlg::finalizeAssembly(*M);
+        LinAlg::finalizeAssembly(*K);
+        LinAlg::finalizeAssembly(*b);
+
+        LinAlg::matMult(*M, xdot, res);
+        LinAlg::matMultAdd(*K, x, res, res);
+        LinAlg::axpy(res, -1.0, *b);
+    }
+
+    MathLib::MatrixSpecifications getMatrixSpecifications() const override
+    {
+        return _ode.getMatrixSpecifications();
+    }
+
+    bool isLinear() const override { return _ode.isLinear(); }
+
+private:
+    ODE _ode;
+};
+
+template <typename ODE>
+class ODETraits<TimeDiscretizedAssemblyODE<ODE>> : public ODETraits<ODE>
+{
+};
+
 struct Solution
 {
     std::vector<double> ts;
@@ -279,6 +367,36 @@ TYPED_TEST(NumLibODEIntTyped, T1)
     TestFixture::test();
 }
 
+TYPED_TEST(NumLibODEIntTyped, TimeDiscretizedAssembly)
+{
+    using ODE = typename TypeParam::ODE;
+    using TimeDisc = typename TypeParam::TimeDisc;
+    using NLTag = NumLib::NonlinearSolverTag;
+
+    const unsigned num_timesteps = 100;
+
+    auto const compare = [](Solution const& expected, Solution const& sol) {
+        ASSERT_EQ(expected.ts.size(), sol.ts.size());
+        for (std::size_t i = 0; i < expected.ts.size(); ++i)
+        {
+            ASSERT_EQ(expected.ts[i], sol.ts[i]);
+            for (std::size_t comp = 0; comp < sol.solutions[i].size(); ++comp)
+            {
+                EXPECT_NEAR(expected.solutions[i][comp],
+                            sol.solutions[i][comp],
+                            TypeParam::tol_picard_newton);
+            }
+        }
+    };
+
+    compare(run_test_case<TimeDisc, ODE, NLTag::Picard>(num_timesteps),
+            run_test_case<TimeDisc, TimeDiscretizedAssemblyODE<ODE>,
+                          NLTag::Picard>(num_timesteps));
+    compare(run_test_case<TimeDisc, ODE, NLTag::Newton>(num_timesteps),
+            run_test_case<TimeDisc, TimeDiscretizedAssemblyODE<ODE>,
+                          NLTag::Newton>(num_timesteps));
+}
+
 
 /* TODO Other possible test cases:
  *
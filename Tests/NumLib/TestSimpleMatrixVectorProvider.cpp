@@ -0,0 +1,88 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "NumLib/DOF/SimpleMatrixVectorProvider.h"
+
+#ifndef USE_PETSC
+
+TEST(NumLibSimpleMatrixVectorProvider, ReuseByShape)
+{
+    NumLib::SimpleMatrixVectorProvider provider;
+    MathLib::MatrixSpecifications const ms(10, 10, nullptr, nullptr);
+    MathLib::MatrixSpecifications const ms_other(20, 20, nullptr, nullptr);
+
+    auto& x = provider.getVector(ms);
+    auto* const y = &provider.getVector(ms);
+    EXPECT_EQ(2u, provider.getNumberOfObjects());
+    EXPECT_EQ(20 * sizeof(double), provider.getMemoryUsage());
+
+    // A released vector is handed out again for the same shape only.
+    provider.releaseVector(*y);
+    auto& z = provider.getVector(ms_other);
+    EXPECT_EQ(20u, z.size());
+    EXPECT_EQ(y, &provider.getVector(ms));
+    EXPECT_EQ(3u, provider.getNumberOfObjects());
+
+    // Copies of managed vectors are pooled with them.
+    provider.releaseVector(*y);
+    x.getRawVector().setConstant(2.0);
+    auto& x_copy = provider.getVector(x);
+    EXPECT_EQ(y, &x_copy);
+    EXPECT_EQ(2.0, x_copy[5]);
+    EXPECT_EQ(3u, provider.getNumberOfObjects());
+
+    // Copies of unmanaged vectors are freed on release.
+    GlobalVector const unmanaged(5);
+    auto& u = provider.getVector(unmanaged);
+    EXPECT_EQ(4u, provider.getNumberOfObjects());
+    provider.releaseVector(u);
+    EXPECT_EQ(3u, provider.getNumberOfObjects());
+    EXPECT_EQ(45 * sizeof(double), provider.getPeakMemoryUsage());
+
+    provider.releaseVector(z);
+    provider.releaseVector(x_copy);
+    provider.shrink();
+    EXPECT_EQ(1u, provider.getNumberOfObjects());
+    EXPECT_EQ(10 * sizeof(double), provider.getMemoryUsage());
+    provider.releaseVector(x);
+}
+
+TEST(NumLibSimpleMatrixVectorProvider, ReuseById)
+{
+    NumLib::SimpleMatrixVectorProvider provider;
+    MathLib::MatrixSpecifications const ms(10, 10, nullptr, nullptr);
+
+    std::size_t id_a = 0;
+    std::size_t id_b = 0;
+    auto* const a = &provider.getMatrix(ms, id_a);
+    auto* const b = &provider.getMatrix(ms, id_b);
+    EXPECT_NE(id_a, id_b);
+
+    provider.releaseMatrix(*a);
+    provider.releaseMatrix(*b);
+
+    // The same object is returned for the same id, even if others of the
+    // same shape are available.
+    EXPECT_EQ(a, &provider.getMatrix(ms, id_a));
+    EXPECT_EQ(b, &provider.getMatrix(ms, id_b));
+
+    // Without a free object of that id, another one of the same shape is
+    // returned and the id is updated.
+    provider.releaseMatrix(*b);
+    std::size_t id_c = id_a;
+    EXPECT_EQ(b, &provider.getMatrix(ms, id_c));
+    EXPECT_EQ(id_b, id_c);
+
+    provider.releaseMatrix(*a);
+    provider.releaseMatrix(*b);
+}
+
+#endif  // USE_PETSC
@@ -0,0 +1,89 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "NumLib/ODESolver/SolutionPredictor.h"
+#include "PolynomialTestFunctions.h"
+
+#ifndef USE_PETSC
+
+namespace
+{
+// Componentwise quadratic function of time.
+PolynomialCoefficients const quadratic{
+    {1.0, 2.0}, {0.0, 0.0, -1.0}, {3.0, -1.0, 0.5}};
+
+GlobalVector f(double const t)
+{
+    return evaluatePolynomials(quadratic, t);
+}
+
+GlobalVector dfdt(double const t)
+{
+    return evaluatePolynomialDerivatives(quadratic, t);
+}
+}  // namespace
+
+TEST(NumLibSolutionPredictor, Linear)
+{
+    NumLib::SolutionPredictor predictor(NumLib::SolutionPredictor::Type::Linear);
+
+    // Not enough solutions, x is left unchanged.
+    GlobalVector x = f(0.0);
+    predictor.pushSolution(0.0, x);
+    predictor.predict(0.5, x);
+    expectNear(f(0.0), x, 1e-12);
+
+    predictor.pushSolution(0.5, f(0.5));
+    predictor.predict(1.25, x);
+    // Exact for the linear first component only.
+    EXPECT_NEAR(f(1.25)[0], x[0], 1e-12);
+    auto const x0 = f(0.5);
+    auto const x1 = f(0.0);
+    for (std::size_t i = 0; i < x.size(); ++i)
+        EXPECT_NEAR(x0[i] + 1.5 * (x0[i] - x1[i]), x[i], 1e-12);
+}
+
+TEST(NumLibSolutionPredictor, Quadratic)
+{
+    NumLib::SolutionPredictor predictor(
+        NumLib::SolutionPredictor::Type::Quadratic);
+
+    GlobalVector x(3);
+    predictor.pushSolution(0.0, f(0.0));
+    predictor.pushSolution(0.3, f(0.3));
+    predictor.pushSolution(1.0, f(1.0));
+    predictor.predict(1.7, x);
+    expectNear(f(1.7), x, 1e-12);
+
+    // A solution pushed again at the same time replaces the newest one.
+    predictor.pushSolution(1.7, f(2.0));
+    predictor.pushSolution(1.7, f(1.7));
+    predictor.predict(2.5, x);
+    expectNear(f(2.5), x, 1e-12);
+}
+
+TEST(NumLibSolutionPredictor, ExplicitEuler)
+{
+    NumLib::SolutionPredictor predictor(
+        NumLib::SolutionPredictor::Type::ExplicitEuler);
+    ASSERT_TRUE(predictor.needsXdot());
+
+    auto const xdot = dfdt(1.0);
+    predictor.pushSolution(1.0, f(1.0), &xdot);
+
+    GlobalVector x(3);
+    predictor.predict(1.5, x);
+    auto const x0 = f(1.0);
+    for (std::size_t i = 0; i < x.size(); ++i)
+        EXPECT_NEAR(x0[i] + 0.5 * xdot[i], x[i], 1e-12);
+}
+
+#endif  // USE_PETSC
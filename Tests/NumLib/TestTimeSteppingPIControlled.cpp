@@ -0,0 +1,130 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "NumLib/TimeStepping/TimeStep.h"
+#include "NumLib/TimeStepping/Algorithms/PIControlledTimeStepping.h"
+
+#include "TimeSteppingTestingTools.h"
+
+TEST(NumLib, TimeSteppingPIControlled)
+{
+    NumLib::PIControlledTimeStepping alg(0.0, 10.0, 1.0, 0.1, 4.0, 1e-3, 0.0,
+                                         MathLib::VecNormType::NORM2);
+
+    ASSERT_TRUE(alg.next());
+    NumLib::TimeStep ts = alg.getTimeStep();
+    ASSERT_EQ(1u, ts.steps());
+    ASSERT_EQ(1., ts.current());
+
+    // Without an error estimate the step size is kept.
+    ASSERT_TRUE(alg.accepted());
+    ASSERT_TRUE(alg.next());
+    ts = alg.getTimeStep();
+    ASSERT_EQ(2., ts.current());
+    ASSERT_EQ(1., ts.dt());
+
+    // A large error rejects the step and reduces the step size.
+    alg.setError(100.0, 1);
+    ASSERT_FALSE(alg.accepted());
+    ASSERT_TRUE(alg.next());
+    ts = alg.getTimeStep();
+    ASSERT_EQ(2u, ts.steps());
+    ASSERT_EQ(1., ts.previous());
+    ASSERT_NEAR(1.0 + 0.2, ts.current(), 1e-14);
+    ASSERT_EQ(1u, alg.getNumberOfRejectedSteps());
+
+    // The step size is not increased directly after a rejection.
+    alg.setError(1e-3, 1);
+    ASSERT_TRUE(alg.accepted());
+    ASSERT_TRUE(alg.next());
+    ts = alg.getTimeStep();
+    ASSERT_NEAR(0.2, ts.dt(), 1e-14);
+
+    // A small error increases the step size, bounded by the maximum ratio.
+    alg.setError(1e-6, 1);
+    ASSERT_TRUE(alg.next());
+    ts = alg.getTimeStep();
+    ASSERT_NEAR(5 * 0.2, ts.dt(), 1e-14);
+
+    // PI formula
+    alg.setError(1e-4, 2);
+    ASSERT_TRUE(alg.next());
+    ts = alg.getTimeStep();
+    ASSERT_NEAR(
+        1.0 * 0.9 * std::pow(1e-4, -0.7 / 3) * std::pow(1e-6, 0.4 / 3),
+        ts.dt(), 1e-14);
+
+    // Steps with the minimum step size are always accepted.
+    alg.setError(1e3, 1);
+    ASSERT_TRUE(alg.next());
+    alg.setError(1e3, 1);
+    ASSERT_TRUE(alg.next());
+    ts = alg.getTimeStep();
+    ASSERT_NEAR(0.1, ts.dt(), 1e-14);
+    alg.setError(1e3, 1);
+    ASSERT_TRUE(alg.accepted());
+}
+
+TEST(NumLib, TimeSteppingPIControlledExponentialDecay)
+{
+    // Backward Euler for x' = -x, x(0) = 1, with the local error estimated
+    // by the difference to the linear extrapolation of the last two solutions.
+    NumLib::PIControlledTimeStepping alg(0.0, 5.0, 0.01, 1e-6, 1.0, 1e-4, 0.0,
+                                         MathLib::VecNormType::NORM2);
+
+    struct ImplicitEuler
+    {
+        void operator()(NumLib::PIControlledTimeStepping& alg)
+        {
+            auto const ts = alg.getTimeStep();
+            double const x = x_prev / (1.0 + ts.dt());
+            if (!has_two_solutions)
+            {
+                accept(ts, x);
+                return;
+            }
+            double const x_pred =
+                x_prev + ts.dt() / (ts.previous() - t_prevprev) *
+                             (x_prev - x_prevprev);
+            double const error = std::abs(x - x_pred) * ts.dt() /
+                                 (ts.current() - t_prevprev);
+            alg.setError(error / 1e-4, 1);
+            if (alg.accepted())
+                accept(ts, x);
+        }
+
+        void accept(NumLib::TimeStep const& ts, double const x)
+        {
+            t_prevprev = ts.previous();
+            x_prevprev = x_prev;
+            x_prev = x;
+            has_two_solutions = true;
+        }
+
+        double x_prev = 1.0;
+        double x_prevprev = 1.0;
+        double t_prevprev = 0.0;
+        bool has_two_solutions = false;
+    };
+
+    ImplicitEuler solver;
+    std::vector<double> const ts = timeStepping(alg, &solver);
+
+    ASSERT_NEAR(5.0, ts.back(), 1e-12);
+    ASSERT_EQ(alg.getTimeStepSizeHistory().size() + 1, ts.size());
+    // The step size grows as the solution decays.
+    auto const& dts = alg.getTimeStepSizeHistory();
+    EXPECT_LT(5 * dts.front(), dts[dts.size() - 2]);
+    EXPECT_NEAR(std::exp(-5.0), solver.x_prev, 1e-2);
+}
@@ -0,0 +1,113 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include "NumLib/ODESolver/TimeDiscretization.h"
+#include "PolynomialTestFunctions.h"
+
+#ifndef USE_PETSC
+
+namespace
+{
+// Componentwise cubic function of time.
+PolynomialCoefficients const cubic{{1.0, -1.0, 0.0, 2.0},
+                                   {0.0, 0.0, 3.0, -1.0}};
+
+GlobalVector f(double const t)
+{
+    return evaluatePolynomials(cubic, t);
+}
+
+GlobalVector dfdt(double const t)
+{
+    return evaluatePolynomialDerivatives(cubic, t);
+}
+
+struct DummyMatrixStorage final : public NumLib::InternalMatrixStorage
+{
+    void pushMatrices() const override {}
+};
+}  // namespace
+
+TEST(NumLibVariableStepBDF, CubicSolution)
+{
+    NumLib::VariableStepBDF bdf(3);
+    DummyMatrixStorage const mat_strg;
+
+    std::vector<double> const times{0.0, 0.1, 0.25, 0.3, 0.7, 1.2, 1.3};
+    std::vector<unsigned> const orders{1, 1, 2, 3, 3, 3};
+
+    bdf.setInitialState(times[0], f(times[0]));
+
+    GlobalVector xdot(2), error(2);
+    for (std::size_t i = 1; i < times.size(); ++i)
+    {
+        double const t = times[i];
+        bdf.nextTimestep(t, t - times[i - 1]);
+        ASSERT_EQ(orders[i - 1], bdf.getOrder());
+
+        auto const x = f(t);
+        bdf.getXdot(x, xdot);
+        if (bdf.getOrder() == 3)
+        {
+            // Exact for cubic polynomials, also with varying step sizes.
+            expectNear(dfdt(t), xdot, 1e-10);
+        }
+
+        // The predictor is exact for polynomials up to the order, hence the
+        // error estimate vanishes only for order 3.
+        bool const has_estimate = bdf.getErrorEstimate(x, error);
+        EXPECT_EQ(i > 1, has_estimate);
+        if (has_estimate)
+        {
+            if (bdf.getOrder() == 3)
+                EXPECT_NEAR(0.0, error.getRawVector().norm(), 1e-10);
+            else
+                EXPECT_LT(1e-6, error.getRawVector().norm());
+        }
+
+        bdf.pushState(t, x, mat_strg);
+    }
+
+    // A timestep computed anew after its state has been pushed, e.g., in a
+    // coupling iteration, does not use that state.
+    bdf.pushState(1.3, f(2.0), mat_strg);
+    bdf.nextTimestep(1.3, 0.1);
+    auto const x = f(1.3);
+    bdf.getXdot(x, xdot);
+    expectNear(dfdt(1.3), xdot, 1e-10);
+}
+
+TEST(NumLibVariableStepBDF, ConstantStepBDF2)
+{
+    // With constant step sizes the classical BDF2 coefficients are obtained.
+    NumLib::VariableStepBDF bdf(2);
+    DummyMatrixStorage const mat_strg;
+
+    double const dt = 0.5;
+    bdf.setInitialState(0.0, f(0.0));
+    for (int i = 1; i <= 3; ++i)
+    {
+        bdf.nextTimestep(i * dt, dt);
+        bdf.pushState(i * dt, f(i * dt), mat_strg);
+    }
+    bdf.nextTimestep(4 * dt, dt);
+    ASSERT_EQ(2u, bdf.getOrder());
+    EXPECT_NEAR(1.5 / dt, bdf.getNewXWeight(), 1e-12);
+
+    GlobalVector y(2);
+    bdf.getWeightedOldX(y);
+    auto const x1 = f(3 * dt);
+    auto const x2 = f(2 * dt);
+    for (std::size_t c = 0; c < y.size(); ++c)
+        EXPECT_NEAR((2.0 * x1[c] - 0.5 * x2[c]) / dt, y[c], 1e-12);
+}
+
+#endif  // USE_PETSC
@@ -0,0 +1,407 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "BaseLib/BuildInfo.h"
+#include "BaseLib/ConfigTree.h"
+#include "BaseLib/Error.h"
+#include "BaseLib/FileTools.h"
+#include "BaseLib/PerThread.h"
+#include "GeoLib/GEOObjects.h"
+#include "MathLib/LinAlg/Eigen/EigenMapTools.h"
+#include "MathLib/LinAlg/MatrixVectorTraits.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "NumLib/ODESolver/NonlinearSolver.h"
+#include "ProcessLib/AnalyticalJacobianAssembler.h"
+#include "ProcessLib/LocalAssemblerInterface.h"
+#include "ProcessLib/Parameter/ConstantParameter.h"
+#include "ProcessLib/Process.h"
+#include "ProcessLib/ProcessVariable.h"
+#include "ProcessLib/StaggeredCouplingTerm.h"
+#include "ProcessLib/UncoupledProcessesTimeLoop.h"
+#include "Tests/TestTools.h"
+
+namespace
+{
+/* Local assembler of a linear element of the reaction-diffusion equation
+ * u_t - D u_xx + rate u = source with a lumped mass matrix and a source
+ * depending on the element. The assembly of a failing element raises an error.
+ */
+class LocalAssembler final : public ProcessLib::LocalAssemblerInterface
+{
+public:
+    LocalAssembler(MeshLib::Element const& e, double const rate,
+                   bool const fails)
+        : _half_length(0.5 * e.getContent()),
+          _rate(rate),
+          _source(1.0 + e.getID()),
+          _fails(fails)
+    {
+    }
+
+    void assemble(double const /*t*/, std::vector<double> const& local_x,
+                  std::vector<double>& local_M_data,
+                  std::vector<double>& local_K_data,
+                  std::vector<double>& local_b_data) override
+    {
+        if (_fails)
+            OGS_FATAL("The constitutive update failed.");
+
+        auto const n = local_x.size();
+        auto local_M = MathLib::createZeroedMatrix(local_M_data, n, n);
+        auto local_K = MathLib::createZeroedMatrix(local_K_data, n, n);
+        auto local_b =
+            MathLib::createZeroedVector<Eigen::VectorXd>(local_b_data, n);
+
+        double const diffusion = 0.1 / (2 * _half_length);
+        local_M.diagonal().setConstant(_half_length);
+        local_K.setConstant(-diffusion);
+        local_K.diagonal().setConstant(diffusion + _rate * _half_length);
+        local_b.setConstant(_source * _half_length);
+    }
+
+private:
+    double const _half_length;
+    double const _rate;
+    double const _source;
+    bool const _fails;
+};
+
+//! The solution of a process passed to its post-processing.
+struct PostTimestepRecord
+{
+    std::string process;
+    std::vector<double> x;
+};
+
+class TestProcess final : public ProcessLib::Process
+{
+public:
+    TestProcess(
+        std::string name, MeshLib::Mesh& mesh,
+        std::vector<std::unique_ptr<ProcessLib::ParameterBase>> const&
+            parameters,
+        std::vector<std::reference_wrapper<ProcessLib::ProcessVariable>>&&
+            process_variables,
+        double const rate, std::vector<PostTimestepRecord>& records,
+        std::size_t const failing_element_id =
+            std::numeric_limits<std::size_t>::max())
+        : Process(mesh,
+                  std::unique_ptr<ProcessLib::AbstractJacobianAssembler>{
+                      new ProcessLib::AnalyticalJacobianAssembler},
+                  parameters, 1, std::move(process_variables),
+                  ProcessLib::SecondaryVariableCollection{},
+                  NumLib::NamedFunctionCaller{{name + "_u"}}),
+          _name(std::move(name)),
+          _rate(rate),
+          _records(records),
+          _failing_element_id(failing_element_id)
+    {
+    }
+
+    bool isLinear() const override { return true; }
+
+    //! True if this process has been assembled within a parallel region.
+    bool assembledInParallelRegion() const
+    {
+        return _assembled_in_parallel_region;
+    }
+
+private:
+    void initializeConcreteProcess(
+        NumLib::LocalToGlobalIndexMap const& /*dof_table*/,
+        MeshLib::Mesh const& mesh,
+        unsigned const /*integration_order*/) override
+    {
+        for (auto const* e : mesh.getElements())
+            _local_assemblers.emplace_back(new LocalAssembler(
+                *e, _rate, e->getID() == _failing_element_id));
+    }
+
+    void assembleConcreteProcess(
+        const double t, GlobalVector const& x, GlobalMatrix& M,
+        GlobalMatrix& K, GlobalVector& b,
+        ProcessLib::StaggeredCouplingTerm const& coupling_term) override
+    {
+        if (BaseLib::isInParallelRegion())
+            _assembled_in_parallel_region = true;
+        assembleElements(&ProcessLib::VectorMatrixAssembler::assemble,
+                         _local_assemblers, *_local_to_global_index_map, t, x,
+                         M, K, b, coupling_term);
+    }
+
+    void assembleWithJacobianConcreteProcess(
+        const double /*t*/, GlobalVector const& /*x*/,
+        GlobalVector const& /*xdot*/, const double /*dxdot_dx*/,
+        const double /*dx_dx*/, GlobalMatrix& /*M*/, GlobalMatrix& /*K*/,
+        GlobalVector& /*b*/, GlobalMatrix& /*Jac*/,
+        ProcessLib::StaggeredCouplingTerm const& /*coupling_term*/) override
+    {
+        OGS_FATAL("The test process is solved by Picard iterations only.");
+    }
+
+    void postTimestepConcreteProcess(GlobalVector const& x) override
+    {
+        std::vector<double> values(x.size());
+        for (std::size_t i = 0; i < values.size(); ++i)
+            values[i] = x.get(i);
+        _records.push_back({_name, std::move(values)});
+    }
+
+    std::string const _name;
+    double const _rate;
+    std::vector<PostTimestepRecord>& _records;
+    std::size_t const _failing_element_id;
+    std::vector<std::unique_ptr<LocalAssembler>> _local_assemblers;
+    bool _assembled_in_parallel_region = false;
+};
+
+std::unique_ptr<ProcessLib::ProcessVariable> createProcessVariable(
+    std::string const& name, MeshLib::Mesh& mesh,
+    GeoLib::GEOObjects& geometries,
+    std::vector<std::unique_ptr<ProcessLib::ParameterBase>> const& parameters)
+{
+    std::string const xml =
+        "<process_variable>"
+        "<name>" + name + "</name>"
+        "<components>1</components>"
+        "<order>1</order>"
+        "<initial_condition>u0</initial_condition>"
+        "</process_variable>";
+    auto const ptree = readXml(xml.c_str());
+    BaseLib::ConfigTree config(ptree, "", BaseLib::ConfigTree::onerror,
+                               BaseLib::ConfigTree::onwarning);
+    return std::unique_ptr<ProcessLib::ProcessVariable>{
+        new ProcessLib::ProcessVariable(
+            config.getConfigSubtree("process_variable"), mesh, geometries,
+            parameters)};
+}
+
+std::string readFile(std::string const& file_name)
+{
+    std::ifstream file(file_name, std::ios::binary);
+    EXPECT_TRUE(file.good()) << "Could not read " << file_name;
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+/* Solves two uncoupled processes, each with its own nonlinear and linear
+ * solver, in a single time loop, and writes their output with the given
+ * prefix.
+ */
+class ConcurrentProcesses
+{
+public:
+    static const unsigned number_of_timesteps = 5;
+
+    ConcurrentProcesses(bool const concurrent, std::string const& prefix)
+        : _mesh(MeshLib::MeshGenerator::generateLineMesh(1.0, 20))
+    {
+        _parameters.emplace_back(
+            new ProcessLib::ConstantParameter<double>("u0", 0.0));
+
+        std::vector<std::string> const names{"A", "B"};
+        std::vector<double> const rates{1.0, 10.0};
+        for (std::size_t i = 0; i < names.size(); ++i)
+        {
+            _process_variables.push_back(createProcessVariable(
+                names[i] + "_u", *_mesh, _geometries, _parameters));
+
+            std::vector<std::reference_wrapper<ProcessLib::ProcessVariable>>
+                process_variables{*_process_variables.back()};
+            std::unique_ptr<TestProcess> process{
+                new TestProcess(names[i], *_mesh, _parameters,
+                                std::move(process_variables), rates[i],
+                                records)};
+            process->initialize();
+            _test_processes.push_back(process.get());
+            _processes.emplace(names[i], std::move(process));
+
+            _linear_solvers.emplace_back(new GlobalLinearSolver{"", nullptr});
+            auto const nl_ptree = readXml(
+                "<nonlinear_solver><type>Picard</type><max_iter>10</max_iter>"
+                "</nonlinear_solver>");
+            BaseLib::ConfigTree nl_config(nl_ptree, "",
+                                          BaseLib::ConfigTree::onerror,
+                                          BaseLib::ConfigTree::onwarning);
+            _nonlinear_solvers.emplace(
+                names[i], NumLib::createNonlinearSolver(
+                              *_linear_solvers.back(),
+                              nl_config.getConfigSubtree("nonlinear_solver"))
+                              .first);
+        }
+
+        std::string processes_xml;
+        for (auto const& name : names)
+        {
+            processes_xml +=
+                "<process ref=\"" + name + "\">"
+                "<nonlinear_solver>" + name + "</nonlinear_solver>"
+                "<convergence_criterion><type>DeltaX</type>"
+                "<norm_type>NORM2</norm_type><abstol>1e-14</abstol>"
+                "</convergence_criterion>"
+                "<time_discretization><type>BackwardEuler</type>"
+                "</time_discretization>"
+                "<output><variables><variable>" + name + "_u</variable>"
+                "</variables></output>"
+                "</process>";
+        }
+        std::string const xml =
+            "<time_loop>"
+            "<processes>" + processes_xml + "</processes>"
+            "<concurrent_processes>" +
+            (concurrent ? "true" : "false") +
+            "</concurrent_processes>"
+            "<time_stepping><type>FixedTimeStepping</type>"
+            "<t_initial>0</t_initial><t_end>0.5</t_end>"
+            "<timesteps><pair><repeat>" + std::to_string(number_of_timesteps) +
+            "</repeat><delta_t>0.1</delta_t></pair></timesteps>"
+            "</time_stepping>"
+            "<output><type>VTK</type><prefix>" + prefix + "</prefix></output>"
+            "</time_loop>";
+        auto const ptree = readXml(xml.c_str());
+        BaseLib::ConfigTree config(ptree, "", BaseLib::ConfigTree::onerror,
+                                   BaseLib::ConfigTree::onwarning);
+        _time_loop = ProcessLib::createUncoupledProcessesTimeLoop(
+            config.getConfigSubtree("time_loop"),
+            BaseLib::BuildInfo::tests_tmp_path, _processes,
+            _nonlinear_solvers);
+    }
+
+    bool loop() { return _time_loop->loop(); }
+
+    bool assembledInParallelRegion() const
+    {
+        for (auto const* process : _test_processes)
+            if (!process->assembledInParallelRegion())
+                return false;
+        return true;
+    }
+
+    std::vector<PostTimestepRecord> records;
+
+private:
+    std::unique_ptr<MeshLib::Mesh> _mesh;
+    GeoLib::GEOObjects _geometries;
+    std::vector<std::unique_ptr<ProcessLib::ParameterBase>> _parameters;
+    std::vector<std::unique_ptr<ProcessLib::ProcessVariable>>
+        _process_variables;
+    std::map<std::string, std::unique_ptr<ProcessLib::Process>> _processes;
+    std::vector<TestProcess const*> _test_processes;
+    std::vector<std::unique_ptr<GlobalLinearSolver>> _linear_solvers;
+    std::map<std::string, std::unique_ptr<NumLib::NonlinearSolverBase>>
+        _nonlinear_solvers;
+    std::unique_ptr<ProcessLib::UncoupledProcessesTimeLoop> _time_loop;
+};
+}  // namespace
+
+// The processes solved concurrently are post-processed and written in the same
+// order and with the same results as the processes solved one after another.
+#ifndef USE_PETSC
+TEST(ProcessLib, ConcurrentProcesses)
+#else
+TEST(ProcessLib, DISABLED_ConcurrentProcesses)
+#endif
+{
+    std::string const serial_prefix = "ConcurrentProcesses_serial";
+    std::string const concurrent_prefix = "ConcurrentProcesses_concurrent";
+
+    ConcurrentProcesses serial(false, serial_prefix);
+    ASSERT_TRUE(serial.loop());
+    ConcurrentProcesses concurrent(true, concurrent_prefix);
+    ASSERT_TRUE(concurrent.loop());
+
+    EXPECT_FALSE(serial.assembledInParallelRegion());
+    if (BaseLib::getMaxNumberOfThreads() > 1)
+    {
+        EXPECT_TRUE(concurrent.assembledInParallelRegion());
+    }
+
+    // The processes alternate in each timestep.
+    ASSERT_EQ(2 * ConcurrentProcesses::number_of_timesteps,
+              serial.records.size());
+    ASSERT_EQ(serial.records.size(), concurrent.records.size());
+    for (std::size_t i = 0; i < serial.records.size(); ++i)
+    {
+        EXPECT_EQ(i % 2 == 0 ? "A" : "B", serial.records[i].process);
+        EXPECT_EQ(serial.records[i].process, concurrent.records[i].process);
+        EXPECT_EQ(serial.records[i].x, concurrent.records[i].x);
+    }
+    // The processes decay at different rates.
+    EXPECT_NE(serial.records[0].x, serial.records[1].x);
+
+    // Each output file contains the mesh with the most recently written
+    // variables of both processes. Hence, the files are only equal if the
+    // output is written in the same order.
+    for (unsigned pcs_idx = 0; pcs_idx < 2; ++pcs_idx)
+    {
+        for (unsigned ts = 0; ts <= ConcurrentProcesses::number_of_timesteps;
+             ++ts)
+        {
+            auto const file_name = [&](std::string const& prefix) {
+                return BaseLib::joinPaths(
+                    BaseLib::BuildInfo::tests_tmp_path,
+                    prefix + "_pcs_" + std::to_string(pcs_idx) + "_ts_" +
+                        std::to_string(ts) + "_t_" +
+                        std::to_string(0.1 * ts) + ".vtu");
+            };
+            EXPECT_EQ(readFile(file_name(serial_prefix)),
+                      readFile(file_name(concurrent_prefix)))
+                << "process " << pcs_idx << ", timestep " << ts;
+        }
+    }
+}
+
+// An error of a local assembler during the concurrent assembly reaches the
+// caller instead of terminating the program.
+#ifndef USE_PETSC
+TEST(ProcessLib, ConcurrentAssemblyError)
+#else
+TEST(ProcessLib, DISABLED_ConcurrentAssemblyError)
+#endif
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateLineMesh(1.0, 1000));
+    GeoLib::GEOObjects geometries;
+    std::vector<std::unique_ptr<ProcessLib::ParameterBase>> parameters;
+    parameters.emplace_back(
+        new ProcessLib::ConstantParameter<double>("u0", 0.0));
+    auto const process_variable =
+        createProcessVariable("C_u", *mesh, geometries, parameters);
+
+    std::vector<PostTimestepRecord> records;
+    TestProcess process("C", *mesh, parameters, {*process_variable}, 1.0,
+                        records, 500);
+    process.setConcurrentAssembly(true);
+    process.initialize();
+
+    auto const spec = process.getMatrixSpecifications();
+    auto const x = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(spec);
+    auto const M = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(spec);
+    auto const K = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(spec);
+    auto const b = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(spec);
+
+    EXPECT_THROW(
+        process.assemble(0.0, *x, *M, *K, *b,
+                         ProcessLib::createVoidStaggeredCouplingTerm()),
+        std::runtime_error);
+}
@@ -0,0 +1,114 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "ProcessLib/LocalAssemblerInterface.h"
+#include "ProcessLib/Utils/ConstructLocalAssemblers.h"
+
+namespace
+{
+class DummyLocalAssembler final : public ProcessLib::LocalAssemblerInterface
+{
+public:
+    explicit DummyLocalAssembler(std::size_t const id) : _id(id) {}
+
+    void assemble(double const /*t*/, std::vector<double> const& /*local_x*/,
+                  std::vector<double>& /*local_M_data*/,
+                  std::vector<double>& /*local_K_data*/,
+                  std::vector<double>& /*local_b_data*/) override
+    {
+    }
+
+    std::size_t getId() const { return _id; }
+
+private:
+    std::size_t const _id;
+    double _padding[5];
+};
+
+//! Constructs dummy local assemblers, failing for the given element.
+struct DummyInitializer
+{
+    void operator()(
+        std::size_t const id, MeshLib::Element const& /*e*/,
+        std::unique_ptr<ProcessLib::LocalAssemblerInterface>& local_assembler)
+        const
+    {
+        if (id == failing_element_id)
+            throw std::runtime_error("unsupported element");
+        local_assembler.reset(new DummyLocalAssembler(id));
+    }
+
+    std::size_t failing_element_id;
+};
+}  // namespace
+
+TEST(ProcessLibLocalAssemblerInterface, ConcurrentAllocation)
+{
+    OPENMP_LOOP_TYPE const n = 10000;
+    std::vector<std::unique_ptr<ProcessLib::LocalAssemblerInterface>>
+        local_assemblers(n);
+
+#pragma omp parallel for
+    for (OPENMP_LOOP_TYPE i = 0; i < n; ++i)
+        local_assemblers[i].reset(new DummyLocalAssembler(i));
+
+    for (OPENMP_LOOP_TYPE i = 0; i < n; ++i)
+    {
+        auto const& local_assembler =
+            static_cast<DummyLocalAssembler const&>(*local_assemblers[i]);
+        ASSERT_EQ(static_cast<std::size_t>(i), local_assembler.getId());
+        ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(&local_assembler) %
+                          alignof(std::max_align_t));
+    }
+
+    // Free the local assemblers in another order than they were allocated.
+#pragma omp parallel for
+    for (OPENMP_LOOP_TYPE i = 0; i < n; ++i)
+        local_assemblers[n - 1 - i].reset();
+}
+
+// An error of a single element reaches the caller also if the local assemblers
+// are constructed concurrently.
+TEST(ProcessLibLocalAssemblerInterface, ConstructionError)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateLineMesh(1.0, 1000));
+    auto const& elements = mesh->getElements();
+
+    for (bool const concurrent : {false, true})
+    {
+        std::vector<std::unique_ptr<ProcessLib::LocalAssemblerInterface>>
+            local_assemblers;
+        ProcessLib::detail::constructLocalAssemblers(
+            DummyInitializer{elements.size()}, elements, local_assemblers,
+            concurrent);
+        ASSERT_EQ(elements.size(), local_assemblers.size());
+        for (std::size_t i = 0; i < elements.size(); ++i)
+        {
+            ASSERT_EQ(i, static_cast<DummyLocalAssembler const&>(
+                             *local_assemblers[i])
+                             .getId());
+        }
+
+        EXPECT_THROW(ProcessLib::detail::constructLocalAssemblers(
+                         DummyInitializer{500}, elements, local_assemblers,
+                         concurrent),
+                     std::runtime_error);
+    }
+}
@@ -23,6 +23,7 @@
 #include "MeshLib/MeshGenerators/MeshGenerator.h"
 
 #include "ProcessLib/Parameter/GroupBasedParameter.h"
+#include "ProcessLib/Parameter/IntegrationPointParameterCache.h"
 
 TEST(ProcessLib_Parameter, GroupBasedParameterElement)
 {
@@ -103,3 +104,62 @@ TEST(ProcessLib_Parameter, GroupBasedParameterNode)
     ASSERT_ANY_THROW((*parameter)(t, x));
 }
 
+namespace
+{
+/// Counts how often it has been evaluated; its value is t + element id +
+/// integration point.
+struct CountingParameter final : public ProcessLib::Parameter<double>
+{
+    explicit CountingParameter(bool const is_time_dependent)
+        : ProcessLib::Parameter<double>(""),
+          _is_time_dependent(is_time_dependent)
+    {
+    }
+
+    bool isTimeDependent() const override { return _is_time_dependent; }
+
+    unsigned getNumberOfComponents() const override { return 1; }
+
+    std::vector<double> const& operator()(
+        double const t, ProcessLib::SpatialPosition const& pos) const override
+    {
+        ++number_of_evaluations;
+        _cache[0] = t + *pos.getElementID() + *pos.getIntegrationPoint();
+        return _cache;
+    }
+
+    mutable std::size_t number_of_evaluations = 0;
+
+private:
+    bool const _is_time_dependent;
+    mutable std::vector<double> _cache = std::vector<double>(1);
+};
+}  // anonymous namespace
+
+TEST(ProcessLib_Parameter, IntegrationPointParameterCacheTimeIndependent)
+{
+    CountingParameter const parameter(false);
+    ProcessLib::IntegrationPointParameterCache<double> cache(parameter, 2, 4);
+
+    for (double const t : {0.0, 0.0, 1.0, 2.0})
+    {
+        for (unsigned ip = 0; ip < 4; ++ip)
+            ASSERT_EQ(2.0 + ip, cache.getValue(t, ip));
+    }
+    ASSERT_EQ(4u, parameter.number_of_evaluations);
+}
+
+TEST(ProcessLib_Parameter, IntegrationPointParameterCacheTimeDependent)
+{
+    CountingParameter const parameter(true);
+    ProcessLib::IntegrationPointParameterCache<double> cache(parameter, 2, 4);
+
+    for (double const t : {0.0, 0.0, 1.0, 1.0, 2.0})
+    {
+        auto const& values = cache.getValues(t);
+        ASSERT_EQ(4u, values.size());
+        for (unsigned ip = 0; ip < 4; ++ip)
+            ASSERT_EQ(t + 2.0 + ip, values[ip]);
+    }
+    ASSERT_EQ(12u, parameter.number_of_evaluations);
+}
@@ -0,0 +1,283 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "MathLib/LinAlg/Eigen/EigenMapTools.h"
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MathLib/LinAlg/MatrixSpecifications.h"
+#include "MathLib/LinAlg/MatrixVectorTraits.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshSubset.h"
+#include "MeshLib/MeshSubsets.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "ProcessLib/AnalyticalJacobianAssembler.h"
+#include "ProcessLib/LocalAssemblerInterface.h"
+#include "ProcessLib/VectorMatrixAssembler.h"
+
+namespace
+{
+/* Local assembler of the nonlinear ODE M_e xdot + K_e x = b_e(x) with
+ * element-dependent matrices M_e and K_e, and b_e(x) = sin(x).
+ */
+class LocalAssembler final : public ProcessLib::LocalAssemblerInterface
+{
+public:
+    LocalAssembler(std::size_t const element_id, std::size_t const num_nodes)
+        : _M(num_nodes, num_nodes), _K(num_nodes, num_nodes)
+    {
+        std::mt19937 gen(element_id);
+        std::uniform_real_distribution<double> rnd(-1.0, 1.0);
+        for (std::size_t i = 0; i < num_nodes; ++i)
+        {
+            for (std::size_t j = 0; j < num_nodes; ++j)
+            {
+                _M(i, j) = rnd(gen);
+                _K(i, j) = rnd(gen);
+            }
+        }
+    }
+
+    void assemble(double const /*t*/, std::vector<double> const& local_x,
+                  std::vector<double>& local_M_data,
+                  std::vector<double>& local_K_data,
+                  std::vector<double>& local_b_data) override
+    {
+        auto const n = local_x.size();
+        MathLib::createZeroedMatrix(local_M_data, n, n) = _M;
+        MathLib::createZeroedMatrix(local_K_data, n, n) = _K;
+        MathLib::createZeroedVector<Eigen::VectorXd>(local_b_data, n) =
+            MathLib::toVector(local_x).array().sin().matrix();
+    }
+
+    void assembleWithJacobian(double const t,
+                              std::vector<double> const& local_x,
+                              std::vector<double> const& /*local_xdot*/,
+                              const double dxdot_dx, const double dx_dx,
+                              std::vector<double>& local_M_data,
+                              std::vector<double>& local_K_data,
+                              std::vector<double>& local_b_data,
+                              std::vector<double>& local_Jac_data) override
+    {
+        assemble(t, local_x, local_M_data, local_K_data, local_b_data);
+
+        auto const n = local_x.size();
+        auto local_Jac = MathLib::createZeroedMatrix(local_Jac_data, n, n);
+        local_Jac = dxdot_dx * _M + dx_dx * _K;
+        local_Jac.diagonal() -=
+            MathLib::toVector(local_x).array().cos().matrix();
+    }
+
+private:
+    Eigen::MatrixXd _M;
+    Eigen::MatrixXd _K;
+};
+
+Eigen::MatrixXd toDense(GlobalMatrix const& A)
+{
+#ifdef USE_PETSC
+    (void)A;
+    return {};
+#else
+    return A.getRawMatrix();
+#endif
+}
+
+Eigen::VectorXd toDense(GlobalVector const& x)
+{
+#ifdef USE_PETSC
+    (void)x;
+    return {};
+#else
+    return x.getRawVector();
+#endif
+}
+
+void fillVectorRandomly(GlobalVector& x, unsigned const seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_real_distribution<double> rnd(-1.0, 1.0);
+    for (GlobalIndexType i = 0; i < static_cast<GlobalIndexType>(x.size());
+         ++i)
+        x.set(i, rnd(gen));
+}
+
+// Assembles all elements of a mesh with the VectorMatrixAssembler in the same
+// way as Process::assembleConcreteProcess() does.
+class VectorMatrixAssemblerTest : public ::testing::Test
+{
+public:
+    VectorMatrixAssemblerTest()
+        : _mesh(MeshLib::MeshGenerator::generateRegularQuadMesh(3.0, 3)),
+          _mesh_subset_all_nodes(*_mesh, &_mesh->getNodes()),
+          _global_assembler(std::unique_ptr<ProcessLib::AbstractJacobianAssembler>{
+              new ProcessLib::AnalyticalJacobianAssembler})
+    {
+        std::vector<std::unique_ptr<MeshLib::MeshSubsets>> all_mesh_subsets;
+        all_mesh_subsets.emplace_back(
+            new MeshLib::MeshSubsets{&_mesh_subset_all_nodes});
+        _dof_table.reset(new NumLib::LocalToGlobalIndexMap(
+            std::move(all_mesh_subsets), NumLib::ComponentOrder::BY_COMPONENT));
+
+        for (auto const* e : _mesh->getElements())
+            _local_assemblers.emplace_back(
+                new LocalAssembler(e->getID(), e->getNumberOfNodes()));
+
+        for (auto* v : {&_x, &_xdot, &_weighted_old_x})
+        {
+            *v = newVector();
+            fillVectorRandomly(**v, _seed++);
+        }
+    }
+
+protected:
+    std::unique_ptr<GlobalMatrix> newMatrix() const
+    {
+        return MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(
+            getMatrixSpecifications());
+    }
+
+    std::unique_ptr<GlobalVector> newVector() const
+    {
+        return MathLib::MatrixVectorTraits<GlobalVector>::newInstance(
+            getMatrixSpecifications());
+    }
+
+    void assemble(GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b)
+    {
+        ProcessLib::StaggeredCouplingTerm const coupling_term(
+            ProcessLib::createVoidStaggeredCouplingTerm());
+        for (std::size_t id = 0; id < _local_assemblers.size(); ++id)
+            _global_assembler.assemble(id, *_local_assemblers[id], *_dof_table,
+                                       _t, *_x, M, K, b, coupling_term);
+        MathLib::LinAlg::finalizeAssembly(M);
+        MathLib::LinAlg::finalizeAssembly(K);
+        MathLib::LinAlg::finalizeAssembly(b);
+    }
+
+    void assembleWithJacobian(GlobalMatrix& M, GlobalMatrix& K,
+                              GlobalVector& b, GlobalMatrix& Jac)
+    {
+        ProcessLib::StaggeredCouplingTerm const coupling_term(
+            ProcessLib::createVoidStaggeredCouplingTerm());
+        for (std::size_t id = 0; id < _local_assemblers.size(); ++id)
+            _global_assembler.assembleWithJacobian(
+                id, *_local_assemblers[id], *_dof_table, _t, *_x, *_xdot,
+                _dxdot_dx, _dx_dx, M, K, b, Jac, coupling_term);
+        MathLib::LinAlg::finalizeAssembly(M);
+        MathLib::LinAlg::finalizeAssembly(K);
+        MathLib::LinAlg::finalizeAssembly(b);
+        MathLib::LinAlg::finalizeAssembly(Jac);
+    }
+
+    MathLib::MatrixSpecifications getMatrixSpecifications() const
+    {
+        return {_dof_table->dofSizeWithoutGhosts(),
+                _dof_table->dofSizeWithoutGhosts(),
+                &_dof_table->getGhostIndices(), nullptr};
+    }
+
+    double const _t = 0.0;
+    double const _dxdot_dx = 7.0;
+    double const _dx_dx = 1.0;
+    unsigned _seed = 0;
+
+    std::unique_ptr<MeshLib::Mesh> _mesh;
+    MeshLib::MeshSubset _mesh_subset_all_nodes;
+    std::unique_ptr<NumLib::LocalToGlobalIndexMap> _dof_table;
+    std::vector<std::unique_ptr<LocalAssembler>> _local_assemblers;
+    ProcessLib::VectorMatrixAssembler _global_assembler;
+
+    std::unique_ptr<GlobalVector> _x;
+    std::unique_ptr<GlobalVector> _xdot;
+    std::unique_ptr<GlobalVector> _weighted_old_x;
+};
+}  // namespace
+
+// The Picard system A = dxdot_dx M + K, rhs = M weighted_old_x + b assembled
+// element by element equals the one computed from the global M, K and b.
+#ifndef USE_PETSC
+TEST_F(VectorMatrixAssemblerTest, TimeDiscretizedAssembly)
+#else
+TEST_F(VectorMatrixAssemblerTest, DISABLED_TimeDiscretizedAssembly)
+#endif
+{
+    auto M = newMatrix();
+    auto K = newMatrix();
+    auto b = newVector();
+    assemble(*M, *K, *b);
+
+    Eigen::MatrixXd const expected_A =
+        _dxdot_dx * toDense(*M) + toDense(*K);
+    Eigen::VectorXd const expected_rhs =
+        toDense(*M) * toDense(*_weighted_old_x) + toDense(*b);
+
+    auto unused_M = newMatrix();
+    auto A = newMatrix();
+    auto rhs = newVector();
+    _global_assembler.setTimeDiscretizedAssembly(_dxdot_dx,
+                                                 _weighted_old_x.get());
+    assemble(*unused_M, *A, *rhs);
+    _global_assembler.unsetTimeDiscretizedAssembly();
+
+    EXPECT_EQ(0.0, toDense(*unused_M).norm());
+    EXPECT_NEAR(0.0, (expected_A - toDense(*A)).norm(),
+                1e-14 * expected_A.norm());
+    EXPECT_NEAR(0.0, (expected_rhs - toDense(*rhs)).norm(),
+                1e-14 * expected_rhs.norm());
+
+    // The assembler is back in the M, K, b mode.
+    auto M2 = newMatrix();
+    auto K2 = newMatrix();
+    auto b2 = newVector();
+    assemble(*M2, *K2, *b2);
+    EXPECT_EQ(0.0, (toDense(*M) - toDense(*M2)).norm());
+    EXPECT_EQ(0.0, (toDense(*K) - toDense(*K2)).norm());
+    EXPECT_EQ(0.0, (toDense(*b) - toDense(*b2)).norm());
+}
+
+// The Newton residual M xdot + K x - b assembled element by element equals the
+// one computed from the global M, K and b; the Jacobian is the same.
+#ifndef USE_PETSC
+TEST_F(VectorMatrixAssemblerTest, ResidualWithJacobian)
+#else
+TEST_F(VectorMatrixAssemblerTest, DISABLED_ResidualWithJacobian)
+#endif
+{
+    auto M = newMatrix();
+    auto K = newMatrix();
+    auto b = newVector();
+    auto Jac = newMatrix();
+    assembleWithJacobian(*M, *K, *b, *Jac);
+
+    Eigen::VectorXd const expected_res = toDense(*M) * toDense(*_xdot) +
+                                         toDense(*K) * toDense(*_x) -
+                                         toDense(*b);
+
+    auto unused_M = newMatrix();
+    auto unused_K = newMatrix();
+    auto res = newVector();
+    auto Jac2 = newMatrix();
+    _global_assembler.setTimeDiscretizedAssembly(_dxdot_dx, nullptr);
+    assembleWithJacobian(*unused_M, *unused_K, *res, *Jac2);
+    _global_assembler.unsetTimeDiscretizedAssembly();
+
+    EXPECT_EQ(0.0, toDense(*unused_M).norm());
+    EXPECT_EQ(0.0, toDense(*unused_K).norm());
+    EXPECT_NEAR(0.0, (expected_res - toDense(*res)).norm(),
+                1e-14 * expected_res.norm());
+    EXPECT_EQ(0.0, (toDense(*Jac) - toDense(*Jac2)).norm());
+}
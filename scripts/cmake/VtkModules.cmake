@@ -1,6 +1,7 @@
 # CLI modules
 set(VTK_MODULES
     vtkIOXML
+    vtkzlib
     CACHE INTERNAL "Required VTK / ParaView modules"
 )
 